@@ -1,53 +1,85 @@
 #include "BT_solver.h"
 
-#include "stack.h"
 #include <stdlib.h>
 
 /**
  * The CallFrame struct contains the indices of the cell to be set in the current
- * simulated recursive call. 
+ * simulated recursive call. When searching by minimum remaining values, it also
+ * points to the candidate set of values yet to be tried in that cell.
  */
 typedef struct {
     int curRow;
     int curCol;
+    CandidateSetWord* remainingValues;
 } CallFrame;
 
+/**
+ * The EmptyCell struct contains the indices of a cell which was empty in the
+ * board the search started from, along with the number of block it is in.
+ */
+typedef struct {
+	int row;
+	int col;
+	int block;
+} EmptyCell;
+
 /**
  * The BacktrackSolverState struct represents the current intermediate
  * state of the algorithm: the call stack, the board on which the algorithm runs,
  * and the counter matrices for values in the board, by row, column and block. 
+ * The call stack is an array of frames allocated once, whose capacity is the number
+ * of empty cells in the board, since each simulated recursive call fills one more
+ * empty cell.
+ * For the minimum remaining values search, the state also holds the cells not yet
+ * filled by the call stack (the first numEmptyCells entries of emptyCells), and
+ * a candidate set per row, column and block of the values still free in it. These
+ * sets mirror the counter matrices: a value is free in a row iff its counter is zero.
+ * When propagating hidden singles, two more candidate sets per row, column and block
+ * collect the values which fit at least one, and at least two, of its empty cells.
+ * The sets of all units are kept rows first, then columns, then blocks, so that the
+ * set of unit u is at offset u * numCandidateSetWords.
+ * When trying values in random order, each value is drawn at random from the values
+ * yet to be tried in its cell, so that the first solution found is a random one.
  */
 typedef struct BacktrackSolverState {
 	int MN;	
+	int numCandidateSetWords;
 	Board puzzle;
-	Stack callStack;
+	CallFrame* callFrames;
+	int numCallFrames;
+	int callFramesCapacity;
+	CandidateSetWord* callFramesRemainingValues;
+	EmptyCell* emptyCells;
+	int numEmptyCells;
 	int** rowsCellsValuesCounters;
 	int** columnsCellsValuesCounters;
 	int** blocksCellsValuesCounters;
+	CandidateSetWord* freeValues;
+	CandidateSetWord* rowsFreeValues;
+	CandidateSetWord* columnsFreeValues;
+	CandidateSetWord* blocksFreeValues;
+	CandidateSetWord* scratchValues;
+	CandidateSetWord* unitsValuesFittingOnce;
+	CandidateSetWord* unitsValuesFittingTwice;
+	bool isPropagatingHiddenSingles;
+	bool isTryingValuesInRandomOrder;
 } BacktrackSolverState;
 
 /**
  * Push a new call frame to the call stack.
+ * pre-condition: the call stack is not full. This holds as long as every pushed frame
+ * refers to an empty cell that no other frame in the stack refers to.
  * 
  * @param state 	[in, out] Current state of the solver
  * @param curRow 	[in] The row number of the cell being filled
  * @param curCol 	[in] The column number of the cell being filled
- * @return true 	iff the procedure was successful
- * @return false 	iff a memory error occurred
  */
-bool pushCallFrame(BacktrackSolverState* state, int curRow, int curCol) {
-    CallFrame* frame = (CallFrame*)calloc(1, sizeof(CallFrame));
-    if (frame == NULL) {
-        return false;
-    }
+void pushCallFrame(BacktrackSolverState* state, int curRow, int curCol) {
+    CallFrame* frame = &(state->callFrames[state->numCallFrames]);
     frame->curRow = curRow;
     frame->curCol = curCol;
-    if (!pushStack(&(state->callStack), frame)) {
-        free(frame);
-        return false;
-    }
-
-    return true;
+    frame->remainingValues = state->callFramesRemainingValues + state->numCallFrames * state->numCandidateSetWords;
+    state->numCallFrames++;
 }
 
 /**
@@ -63,16 +95,30 @@ bool pushCallFrame(BacktrackSolverState* state, int curRow, int curCol) {
  */
 bool peekCallFrame(BacktrackSolverState* state, int* curRow, int* curCol) {
     const CallFrame* frame;
-    if (isStackEmpty(&(state->callStack))) {
+    if (state->numCallFrames == 0) {
         return false;
     }
     
-    frame = (const CallFrame*)peekStack(&(state->callStack));
+    frame = &(state->callFrames[state->numCallFrames - 1]);
     *curRow = frame->curRow;
     *curCol = frame->curCol;
     return true;
 }
 
+/**
+ * Get the top call frame in the stack.
+ * 
+ * @param state 		[in] Current state of the solver
+ * @return CallFrame* 	The top call frame, or NULL if the stack is empty
+ */
+CallFrame* getTopCallFrame(BacktrackSolverState* state) {
+	if (state->numCallFrames == 0) {
+		return NULL;
+	}
+
+	return &(state->callFrames[state->numCallFrames - 1]);
+}
+
 /**
  * Pop the top call frame.
  * 
@@ -81,24 +127,95 @@ bool peekCallFrame(BacktrackSolverState* state, int* curRow, int* curCol) {
  * @return false 	iff the stack is empty
  */
 bool popCallFrame(BacktrackSolverState* state) {
-    CallFrame* frame = (CallFrame*) popStack(&(state->callStack));
-    if (frame == NULL) {
+    if (state->numCallFrames == 0) {
         return false;
     }
 
-    free(frame);
+    state->numCallFrames--;
     return true;
 }
 
 /**
- * Empties the call stack.
+ * Frees the call stack.
  * 
  * @param state 	[in, out] Current state of the solver
  */
-void clearCallFrames(BacktrackSolverState* state) {
-    while(!isStackEmpty(&(state->callStack))) {
-        popCallFrame(state);
+void freeCallFrames(BacktrackSolverState* state) {
+    if (state->callFrames != NULL) {
+        free(state->callFrames);
+        state->callFrames = NULL;
+    }
+    if (state->callFramesRemainingValues != NULL) {
+        free(state->callFramesRemainingValues);
+        state->callFramesRemainingValues = NULL;
     }
+    state->numCallFrames = 0;
+    state->callFramesCapacity = 0;
+}
+
+/**
+ * Allocates the call stack, with room for a frame per empty cell of the provided board.
+ * 
+ * @param state 	[in, out] Current state of the solver
+ * @param boardIn 	[in] The board the search starts from
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool createCallFrames(BacktrackSolverState* state, const Board* boardIn) {
+	int capacity = countNumEmptyCells(boardIn);
+	if (capacity == 0)
+		capacity = 1;
+
+	state->numCallFrames = 0;
+	state->callFramesCapacity = capacity;
+	state->callFrames = calloc(capacity, sizeof(CallFrame));
+	state->callFramesRemainingValues = calloc(capacity * state->numCandidateSetWords, sizeof(CandidateSetWord));
+	if ((state->callFrames == NULL) || (state->callFramesRemainingValues == NULL)) {
+		freeCallFrames(state);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Frees the list of empty cells.
+ * 
+ * @param state 	[in, out] Current state of the solver
+ */
+void freeEmptyCells(BacktrackSolverState* state) {
+	if (state->emptyCells != NULL) {
+		free(state->emptyCells);
+		state->emptyCells = NULL;
+	}
+	state->numEmptyCells = 0;
+}
+
+/**
+ * Creates the list of empty cells of the board contained in the provided state.
+ * 
+ * @param state 	[in, out] Current state of the solver
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool createEmptyCells(BacktrackSolverState* state) {
+	int row = 0, col = 0;
+
+	state->numEmptyCells = 0;
+	state->emptyCells = calloc(state->callFramesCapacity, sizeof(EmptyCell));
+	if (state->emptyCells == NULL)
+		return false;
+
+	for (row = 0; row < state->MN; row++)
+		for (col = 0; col < state->MN; col++)
+			if (isBoardCellEmpty(viewBoardCellByRow(&(state->puzzle), row, col))) {
+				EmptyCell* emptyCell = &(state->emptyCells[state->numEmptyCells++]);
+				emptyCell->row = row;
+				emptyCell->col = col;
+				emptyCell->block = whichBlock(&(state->puzzle), row, col);
+			}
+
+	return true;
 }
 
 /**
@@ -129,9 +246,9 @@ void freeSolverCellsValuesCounters(BacktrackSolverState* state) {
  * @return false 	iff a memory error occured
  */
 bool createSolverCellsValuesCounters(BacktrackSolverState* state) {
-	state->rowsCellsValuesCounters = createCellsValuesCountersByCategory(&(state->puzzle), viewBoardCellByRow);
-	state->columnsCellsValuesCounters = createCellsValuesCountersByCategory(&(state->puzzle), viewBoardCellByColumn);
-	state->blocksCellsValuesCounters = createCellsValuesCountersByCategory(&(state->puzzle), viewBoardCellByBlock);
+	state->rowsCellsValuesCounters = createCellsValuesCountersByCategory(&(state->puzzle), BOARD_CATEGORY_ROW);
+	state->columnsCellsValuesCounters = createCellsValuesCountersByCategory(&(state->puzzle), BOARD_CATEGORY_COLUMN);
+	state->blocksCellsValuesCounters = createCellsValuesCountersByCategory(&(state->puzzle), BOARD_CATEGORY_BLOCK);
 
 	if ((state->rowsCellsValuesCounters != NULL) &&
 		(state->columnsCellsValuesCounters != NULL) &&
@@ -143,6 +260,63 @@ bool createSolverCellsValuesCounters(BacktrackSolverState* state) {
 	return false;
 }
 
+/**
+ * Frees all memory allocated to the free values candidate sets.
+ * 
+ * @param state 	[in, out] Current state of the solver
+ */
+void freeSolverFreeValues(BacktrackSolverState* state) {
+	if (state->freeValues != NULL) {
+		free(state->freeValues);
+		state->freeValues = NULL;
+	}
+	state->rowsFreeValues = NULL;
+	state->columnsFreeValues = NULL;
+	state->blocksFreeValues = NULL;
+	state->scratchValues = NULL;
+	state->unitsValuesFittingOnce = NULL;
+	state->unitsValuesFittingTwice = NULL;
+}
+
+/**
+ * Creates the free values candidate sets of every row, column and block, according to
+ * the value counter matrices. All sets reside in a single memory allocation, along
+ * with a scratch set and the sets used to find hidden singles.
+ * 
+ * @param state 	[in, out] Current state of the solver, whose counter matrices are
+ * 					already created
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occured
+ */
+bool createSolverFreeValues(BacktrackSolverState* state) {
+	int MN = state->MN;
+	int numWords = state->numCandidateSetWords;
+	int categoryNo = 0, value = 0;
+
+	state->freeValues = calloc((9 * MN + 1) * numWords, sizeof(CandidateSetWord));
+	if (state->freeValues == NULL)
+		return false;
+
+	state->rowsFreeValues = state->freeValues;
+	state->columnsFreeValues = state->freeValues + MN * numWords;
+	state->blocksFreeValues = state->freeValues + 2 * MN * numWords;
+	state->scratchValues = state->freeValues + 3 * MN * numWords;
+	state->unitsValuesFittingOnce = state->scratchValues + numWords;
+	state->unitsValuesFittingTwice = state->unitsValuesFittingOnce + 3 * MN * numWords;
+
+	for (categoryNo = 0; categoryNo < MN; categoryNo++)
+		for (value = 1; value <= MN; value++) {
+			if (state->rowsCellsValuesCounters[categoryNo][value] == 0)
+				addValueToCandidateSet(state->rowsFreeValues + categoryNo * numWords, value);
+			if (state->columnsCellsValuesCounters[categoryNo][value] == 0)
+				addValueToCandidateSet(state->columnsFreeValues + categoryNo * numWords, value);
+			if (state->blocksCellsValuesCounters[categoryNo][value] == 0)
+				addValueToCandidateSet(state->blocksFreeValues + categoryNo * numWords, value);
+		}
+
+	return true;
+}
+
 /**
  * Initializes the solver's state, given an inital read-only pointer to a board.
  * 
@@ -155,17 +329,36 @@ bool initSolverState(BacktrackSolverState* state, const Board* boardIn) {
 	state->rowsCellsValuesCounters = NULL;
 	state->columnsCellsValuesCounters = NULL;
 	state->blocksCellsValuesCounters = NULL;
+	state->freeValues = NULL;
+	state->emptyCells = NULL;
+	state->isPropagatingHiddenSingles = false;
 	state->MN = getBoardBlockSize_MN(boardIn);
+	state->numCandidateSetWords = getNumCandidateSetWords(boardIn);
+
+	if (!createCallFrames(state, boardIn)) {
+		/* memory error */
+		return false;
+	}
 
-	initStack(&state->callStack);
 	if (!copyBoard(boardIn, &(state->puzzle))) {
 		/* memory error */
+		freeCallFrames(state);
 		return false;
 	}
 	
 	if (!createSolverCellsValuesCounters(state)) {
 		/* memory error */
 		cleanupBoard(&(state->puzzle));
+		freeCallFrames(state);
+		return false;
+	}
+
+	if (!createSolverFreeValues(state) || !createEmptyCells(state)) {
+		/* memory error */
+		freeSolverFreeValues(state);
+		freeSolverCellsValuesCounters(state);
+		cleanupBoard(&(state->puzzle));
+		freeCallFrames(state);
 		return false;
 	}
 
@@ -178,9 +371,11 @@ bool initSolverState(BacktrackSolverState* state, const Board* boardIn) {
  * @param state 	[in, out] Current state of the solver
  */
 void cleanupSolverState(BacktrackSolverState* state) {
-	clearCallFrames(state);
-	cleanupBoard(&(state->puzzle));
+	freeCallFrames(state);
+	freeEmptyCells(state);
+	freeSolverFreeValues(state);
 	freeSolverCellsValuesCounters(state);
+	cleanupBoard(&(state->puzzle));
 }
 
 /**
@@ -222,83 +417,506 @@ int setSolverPuzzleCell(BacktrackSolverState* state, int row, int col, int value
 	block = whichBlock(&(state->puzzle), row, col);
 
 	if (prevValue != EMPTY_CELL_VALUE) {
-		state->rowsCellsValuesCounters[row][prevValue]--;
-		state->columnsCellsValuesCounters[col][prevValue]--;
-		state->blocksCellsValuesCounters[block][prevValue]--;
+		if (--state->rowsCellsValuesCounters[row][prevValue] == 0)
+			addValueToCandidateSet(state->rowsFreeValues + row * state->numCandidateSetWords, prevValue);
+		if (--state->columnsCellsValuesCounters[col][prevValue] == 0)
+			addValueToCandidateSet(state->columnsFreeValues + col * state->numCandidateSetWords, prevValue);
+		if (--state->blocksCellsValuesCounters[block][prevValue] == 0)
+			addValueToCandidateSet(state->blocksFreeValues + block * state->numCandidateSetWords, prevValue);
 	}
 
 	if (value != EMPTY_CELL_VALUE) {
-		state->rowsCellsValuesCounters[row][value]++;
-		state->columnsCellsValuesCounters[col][value]++;
-		state->blocksCellsValuesCounters[block][value]++;
+		if (state->rowsCellsValuesCounters[row][value]++ == 0)
+			removeValueFromCandidateSet(state->rowsFreeValues + row * state->numCandidateSetWords, value);
+		if (state->columnsCellsValuesCounters[col][value]++ == 0)
+			removeValueFromCandidateSet(state->columnsFreeValues + col * state->numCandidateSetWords, value);
+		if (state->blocksCellsValuesCounters[block][value]++ == 0)
+			removeValueFromCandidateSet(state->blocksFreeValues + block * state->numCandidateSetWords, value);
 	}
 
 	setBoardCellValue(&(state->puzzle), row, col, value);
 	return prevValue;
 }
 
-bool calculateNumSolutions(const Board* boardIn, int* numSolutions) {
-	BacktrackSolverState state = {0};
+/**
+ * Computes the candidate set of the values which may be legally placed in an empty cell,
+ * that is, the values free in its row, column and block.
+ * 
+ * @param state 			[in] Current state of the solver
+ * @param emptyCell 		[in] The empty cell whose values are computed
+ * @param valuesOut 		[in, out] The candidate set to be assigned with the values
+ * @return int 				The number of values in the set
+ */
+int getSolverEmptyCellLegalValues(const BacktrackSolverState* state, const EmptyCell* emptyCell, CandidateSetWord* valuesOut) {
+	int numWords = state->numCandidateSetWords;
+	const CandidateSetWord* rowFreeValues = state->rowsFreeValues + emptyCell->row * numWords;
+	const CandidateSetWord* columnFreeValues = state->columnsFreeValues + emptyCell->col * numWords;
+	const CandidateSetWord* blockFreeValues = state->blocksFreeValues + emptyCell->block * numWords;
+	int wordIndex = 0;
 
-	int curCol, curRow;
-	int sum = 0;
-	
-	if (!getNextEmptyBoardCell(boardIn, 0, 0, &curRow, &curCol)) {
-		*numSolutions = 1; /* board is full and has no errors (pre-condition) */
-		return true;
-	}
+	for (wordIndex = 0; wordIndex < numWords; wordIndex++)
+		valuesOut[wordIndex] = rowFreeValues[wordIndex] & columnFreeValues[wordIndex] & blockFreeValues[wordIndex];
 
-	if (!initSolverState(&state, boardIn)) {
+	return countCandidateSetValues(valuesOut, numWords);
+}
+
+/**
+ * Finds the empty cell with the fewest legal values, among the cells not yet filled by
+ * the call stack. The search stops early once a cell with at most one legal value is found.
+ * 
+ * @param state 				[in] Current state of the solver
+ * @param emptyCellIndexOut 	[in, out] A pointer to an integer to be assigned with the
+ * 								index of the chosen cell in the list of empty cells
+ * @param numValuesOut 			[in, out] A pointer to an integer to be assigned with the
+ * 								number of legal values of the chosen cell
+ * @return true 				iff there is an empty cell left and values have been assigned
+ * 								to the pointers
+ * @return false 				otherwise
+ */
+bool findMostConstrainedSolverEmptyCell(BacktrackSolverState* state, int* emptyCellIndexOut, int* numValuesOut) {
+	int index = 0;
+
+	if (state->numEmptyCells == 0)
 		return false;
+
+	*emptyCellIndexOut = 0;
+	*numValuesOut = state->MN + 1;
+	for (index = 0; index < state->numEmptyCells; index++) {
+		int numValues = getSolverEmptyCellLegalValues(state, &(state->emptyCells[index]), state->scratchValues);
+		if (numValues < *numValuesOut) {
+			*emptyCellIndexOut = index;
+			*numValuesOut = numValues;
+			if (numValues <= 1)
+				break;
+		}
 	}
 
-	/* push initial empty cell */
-	if (!pushCallFrame(&state, curRow, curCol)) {
-		/* memory error */
-		cleanupSolverState(&state);
+	return true;
+}
+
+/**
+ * The outcomes of looking for a hidden single: a value which, in some row, column or
+ * block, fits only one of its empty cells.
+ */
+typedef enum {
+	HIDDEN_SINGLE_SEARCH_NOT_FOUND,
+	HIDDEN_SINGLE_SEARCH_FOUND,
+	HIDDEN_SINGLE_SEARCH_DEAD_END
+} HiddenSingleSearchResult;
+
+/**
+ * Looks for a hidden single among the cells not yet filled by the call stack. Along the
+ * way, it detects a dead end: a value still free in some row, column or block, which
+ * fits none of its empty cells.
+ * 
+ * @param state 				[in, out] Current state of the solver
+ * @param emptyCellIndexOut 	[in, out] A pointer to an integer to be assigned with the
+ * 								index of the hidden single's cell in the list of empty cells
+ * @param valueOut 				[in, out] A pointer to an integer to be assigned with the
+ * 								value the hidden single's cell must hold
+ * @return HiddenSingleSearchResult 	Whether a hidden single or a dead end was found.
+ * 										The pointers are only assigned if a hidden single was
+ */
+HiddenSingleSearchResult findHiddenSingleSolverEmptyCell(BacktrackSolverState* state, int* emptyCellIndexOut, int* valueOut) {
+	int MN = state->MN;
+	int numWords = state->numCandidateSetWords;
+	CandidateSetWord* once = state->unitsValuesFittingOnce;
+	CandidateSetWord* twice = state->unitsValuesFittingTwice;
+	int index = 0, unit = 0, wordIndex = 0;
+
+	for (wordIndex = 0; wordIndex < 3 * MN * numWords; wordIndex++) {
+		once[wordIndex] = 0;
+		twice[wordIndex] = 0;
+	}
+
+	for (index = 0; index < state->numEmptyCells; index++) {
+		const EmptyCell* emptyCell = &(state->emptyCells[index]);
+		int units[3];
+		int i = 0;
+
+		units[0] = emptyCell->row;
+		units[1] = MN + emptyCell->col;
+		units[2] = 2 * MN + emptyCell->block;
+		getSolverEmptyCellLegalValues(state, emptyCell, state->scratchValues);
+		for (i = 0; i < 3; i++)
+			for (wordIndex = 0; wordIndex < numWords; wordIndex++) {
+				twice[units[i] * numWords + wordIndex] |= once[units[i] * numWords + wordIndex] & state->scratchValues[wordIndex];
+				once[units[i] * numWords + wordIndex] |= state->scratchValues[wordIndex];
+			}
+	}
+
+	for (unit = 0; unit < 3 * MN; unit++) {
+		int value = EMPTY_CELL_VALUE;
+
+		for (wordIndex = 0; wordIndex < numWords; wordIndex++) {
+			if ((state->freeValues[unit * numWords + wordIndex] & ~once[unit * numWords + wordIndex]) != 0)
+				return HIDDEN_SINGLE_SEARCH_DEAD_END;
+			state->scratchValues[wordIndex] = once[unit * numWords + wordIndex] & ~twice[unit * numWords + wordIndex];
+		}
+
+		value = getNextValueInCandidateSet(state->scratchValues, numWords, EMPTY_CELL_VALUE);
+		if (value == EMPTY_CELL_VALUE)
+			continue;
+
+		for (index = 0; index < state->numEmptyCells; index++) {
+			const EmptyCell* emptyCell = &(state->emptyCells[index]);
+			if ((emptyCell->row == unit) || (MN + emptyCell->col == unit) || (2 * MN + emptyCell->block == unit)) {
+				getSolverEmptyCellLegalValues(state, emptyCell, state->scratchValues);
+				if (isValueInCandidateSet(state->scratchValues, value)) {
+					*emptyCellIndexOut = index;
+					*valueOut = value;
+					return HIDDEN_SINGLE_SEARCH_FOUND;
+				}
+			}
+		}
+	}
+
+	return HIDDEN_SINGLE_SEARCH_NOT_FOUND;
+}
+
+/**
+ * Draws a value at random from the provided candidate set.
+ * 
+ * @param candidateSet 	[in] The candidate set to draw a value from
+ * @param numWords 		[in] The number of words in the candidate set
+ * @return int 			The value drawn, or EMPTY_CELL_VALUE if the set is empty
+ */
+int getRandomValueInCandidateSet(const CandidateSetWord* candidateSet, int numWords) {
+	int numValues = countCandidateSetValues(candidateSet, numWords);
+	int value = EMPTY_CELL_VALUE;
+	int valueNo = 0;
+
+	if (numValues == 0)
+		return EMPTY_CELL_VALUE;
+
+	value = getNextValueInCandidateSet(candidateSet, numWords, EMPTY_CELL_VALUE);
+	for (valueNo = rand() % numValues; valueNo > 0; valueNo--)
+		value = getNextValueInCandidateSet(candidateSet, numWords, value);
+
+	return value;
+}
+
+/**
+ * Finds the empty cell to branch on next, among the cells not yet filled by the call stack:
+ * the one with the fewest legal values. When propagating hidden singles, and no cell has
+ * fewer than two legal values, a hidden single is preferred, with its value forced.
+ * 
+ * @param state 				[in, out] Current state of the solver
+ * @param emptyCellIndexOut 	[in, out] A pointer to an integer to be assigned with the
+ * 								index of the chosen cell in the list of empty cells
+ * @param numValuesOut 			[in, out] A pointer to an integer to be assigned with the
+ * 								number of values to try in the chosen cell, 0 in a dead end
+ * @param forcedValueOut 		[in, out] A pointer to an integer to be assigned with the
+ * 								only value to try in the chosen cell if it is a hidden single,
+ * 								or with EMPTY_CELL_VALUE otherwise
+ * @return true 				iff there is an empty cell left and values have been assigned
+ * 								to the pointers
+ * @return false 				otherwise
+ */
+bool findSolverEmptyCellToBranchOn(BacktrackSolverState* state, int* emptyCellIndexOut, int* numValuesOut, int* forcedValueOut) {
+	*forcedValueOut = EMPTY_CELL_VALUE;
+
+	if (!findMostConstrainedSolverEmptyCell(state, emptyCellIndexOut, numValuesOut))
 		return false;
+
+	if (!state->isPropagatingHiddenSingles || (*numValuesOut <= 1))
+		return true;
+
+	switch (findHiddenSingleSolverEmptyCell(state, emptyCellIndexOut, forcedValueOut)) {
+	case HIDDEN_SINGLE_SEARCH_FOUND:
+		*numValuesOut = 1;
+		break;
+	case HIDDEN_SINGLE_SEARCH_DEAD_END:
+		*numValuesOut = 0;
+		break;
+	case HIDDEN_SINGLE_SEARCH_NOT_FOUND:
+		break;
+	}
+
+	return true;
+}
+
+/**
+ * Push a new call frame for an empty cell to the call stack, removing the cell from
+ * the list of cells not yet filled, and setting the frame's remaining values to the
+ * cell's legal values, or to its forced value alone. The cell is moved to the end of
+ * the list, right past the cells not yet filled, so that popping the frame only needs
+ * to extend the list by one.
+ * 
+ * @param state 			[in, out] Current state of the solver
+ * @param emptyCellIndex 	[in] The index of the cell in the list of empty cells
+ * @param forcedValue 		[in] The only value to try in the cell, or EMPTY_CELL_VALUE
+ * 							to try all of its legal values
+ */
+void pushEmptyCellCallFrame(BacktrackSolverState* state, int emptyCellIndex, int forcedValue) {
+	EmptyCell emptyCell = state->emptyCells[emptyCellIndex];
+	CallFrame* frame = NULL;
+	int wordIndex = 0;
+
+	state->numEmptyCells--;
+	state->emptyCells[emptyCellIndex] = state->emptyCells[state->numEmptyCells];
+	state->emptyCells[state->numEmptyCells] = emptyCell;
+
+	pushCallFrame(state, emptyCell.row, emptyCell.col);
+	frame = getTopCallFrame(state);
+	if (forcedValue == EMPTY_CELL_VALUE) {
+		getSolverEmptyCellLegalValues(state, &emptyCell, frame->remainingValues);
+		return;
+	}
+
+	for (wordIndex = 0; wordIndex < state->numCandidateSetWords; wordIndex++)
+		frame->remainingValues[wordIndex] = 0;
+	addValueToCandidateSet(frame->remainingValues, forcedValue);
+}
+
+/**
+ * Pop the top call frame pushed by pushEmptyCellCallFrame, emptying its cell and
+ * returning the cell to the list of cells not yet filled.
+ * 
+ * @param state 	[in, out] Current state of the solver
+ */
+void popEmptyCellCallFrame(BacktrackSolverState* state) {
+	CallFrame* frame = getTopCallFrame(state);
+
+	setSolverPuzzleCell(state, frame->curRow, frame->curCol, EMPTY_CELL_VALUE);
+	popCallFrame(state);
+	state->numEmptyCells++;
+}
+
+/**
+ * Counts the solutions of the board contained in the provided state, by the exhaustive
+ * backtracking algorithm, always branching on the empty cell with the fewest legal values
+ * and trying only those values. When the state propagates hidden singles, they are
+ * branched on first, trying only their forced values. When the state tries values in
+ * random order, they are drawn at random rather than tried in ascending order.
+ * 
+ * @param state 			[in, out] Current state of the solver, freshly initialized
+ * @param maxNumSolutions 	[in] The number of solutions at which the search stops, or 0
+ * 							to exhaust the search
+ * @param numNodesOut 		[in, out] A pointer to a long to be assigned with the number of
+ * 							values tried
+ * @return int 				The number of solutions, up to maxNumSolutions
+ */
+int countSolutionsByMinimumRemainingValues(BacktrackSolverState* state, int maxNumSolutions, long* numNodesOut) {
+	int sum = 0;
+	long numNodes = 0;
+	int emptyCellIndex = 0, numValues = 0, forcedValue = EMPTY_CELL_VALUE;
+	CallFrame* frame = NULL;
+
+	if (!findSolverEmptyCellToBranchOn(state, &emptyCellIndex, &numValues, &forcedValue)) {
+		*numNodesOut = 0;
+		return 1; /* board is full and has no errors (pre-condition) */
+	}
+
+	if (numValues > 0)
+		pushEmptyCellCallFrame(state, emptyCellIndex, forcedValue);
+
+	while ((frame = getTopCallFrame(state)) != NULL) {
+		int newValue = state->isTryingValuesInRandomOrder ?
+					   getRandomValueInCandidateSet(frame->remainingValues, state->numCandidateSetWords) :
+					   getNextValueInCandidateSet(frame->remainingValues, state->numCandidateSetWords, EMPTY_CELL_VALUE);
+
+		if (newValue == EMPTY_CELL_VALUE) {
+			/* back track */
+			popEmptyCellCallFrame(state);
+			continue;
+		}
+
+		numNodes++;
+
+		/* values are legal by construction */
+		removeValueFromCandidateSet(frame->remainingValues, newValue);
+		setSolverPuzzleCell(state, frame->curRow, frame->curCol, newValue);
+
+		if (!findSolverEmptyCellToBranchOn(state, &emptyCellIndex, &numValues, &forcedValue)) {
+			/* no more empty cells, count as solved */
+			sum++;
+			if (sum == maxNumSolutions)
+				break;
+			continue;
+		}
+
+		if (numValues == 0) {
+			/* dead end, try next value */
+			continue;
+		}
+
+		/* count solutions for the most constrained empty cell given current board */
+		pushEmptyCellCallFrame(state, emptyCellIndex, forcedValue);
 	}
 
-	while (peekCallFrame(&state, &curRow, &curCol)) {
+	*numNodesOut = numNodes;
+	return sum;
+}
+
+/**
+ * Counts the solutions of the board contained in the provided state, by the exhaustive
+ * backtracking algorithm, filling the empty cells in row-major order and trying every
+ * value in each.
+ * 
+ * @param state 			[in, out] Current state of the solver, freshly initialized
+ * @param maxNumSolutions 	[in] The number of solutions at which the search stops, or 0
+ * 							to exhaust the search
+ * @param numNodesOut 		[in, out] A pointer to a long to be assigned with the number of
+ * 							values tried
+ * @return int 				The number of solutions, up to maxNumSolutions
+ */
+int countSolutionsInRowMajorOrder(BacktrackSolverState* state, int maxNumSolutions, long* numNodesOut) {
+	int curCol, curRow;
+	int sum = 0;
+	long numNodes = 0;
+
+	if (!getNextEmptyBoardCell(&(state->puzzle), 0, 0, &curRow, &curCol)) {
+		*numNodesOut = 0;
+		return 1; /* board is full and has no errors (pre-condition) */
+	}
+
+	/* push initial empty cell */
+	pushCallFrame(state, curRow, curCol);
+
+	while (peekCallFrame(state, &curRow, &curCol)) {
 		int nextRow, nextCol, newValue;
 		bool isLegalValue;
-		const Cell* cell = viewBoardCellByRow(&(state.puzzle), curRow, curCol);
+		const Cell* cell = viewBoardCellByRow(&(state->puzzle), curRow, curCol);
 
 		/* increment value, not assuming EMPTY_CELL_VALUE == 0 */
 		newValue = isBoardCellEmpty(cell) ? 1 : getBoardCellValue(cell) + 1;
 
-		if (newValue == state.MN + 1) { /* max value */
+		if (newValue == state->MN + 1) { /* max value */
 			/* back track */
-			setSolverPuzzleCell(&state, curRow, curCol, EMPTY_CELL_VALUE);
-			popCallFrame(&state);
+			setSolverPuzzleCell(state, curRow, curCol, EMPTY_CELL_VALUE);
+			popCallFrame(state);
 			continue;
 		}
 
+		numNodes++;
+
 		/* check if board is valid after incrementing value*/
-		isLegalValue = isValueLegalForSolverCell(&state, curRow, curCol, newValue);
+		isLegalValue = isValueLegalForSolverCell(state, curRow, curCol, newValue);
 		/* set value anyway (after checking legality) */
-		setSolverPuzzleCell(&state, curRow, curCol, newValue);
+		setSolverPuzzleCell(state, curRow, curCol, newValue);
 
 		if (!isLegalValue) {
 			/* illegal, try next value */
 			continue;
 		}
 
-		if (!getNextEmptyBoardCell(&(state.puzzle), curRow, curCol, &nextRow, &nextCol)) {
+		if (!getNextEmptyBoardCell(&(state->puzzle), curRow, curCol, &nextRow, &nextCol)) {
 			/* no more empty cells, count as solved */
 			sum++;
+			if (sum == maxNumSolutions)
+				break;
 			continue;
 		}
 
 		/* count solutions for next empty cell given current board */
-		if (!pushCallFrame(&state, nextRow, nextCol)) {
-			/* memory error */
-			cleanupSolverState(&state);
-			return false;
-		}
+		pushCallFrame(state, nextRow, nextCol);
+	}
+
+	*numNodesOut = numNodes;
+	return sum;
+}
+
+bool calculateNumSolutionsUsingMethod(const Board* boardIn, BacktrackSolverMethod method, int maxNumSolutions, int* numSolutions, BacktrackSolverStatistics* statisticsOut) {
+	BacktrackSolverState state = {0};
+	long numNodes = 0;
+
+	if (!initSolverState(&state, boardIn)) {
+		return false;
+	}
+
+	switch (method) {
+	case BACKTRACK_SOLVER_METHOD_ORDERED:
+		*numSolutions = countSolutionsInRowMajorOrder(&state, maxNumSolutions, &numNodes);
+		break;
+	case BACKTRACK_SOLVER_METHOD_PROPAGATION:
+		state.isPropagatingHiddenSingles = true;
+		*numSolutions = countSolutionsByMinimumRemainingValues(&state, maxNumSolutions, &numNodes);
+		break;
+	case BACKTRACK_SOLVER_METHOD_MRV:
+	default:
+		*numSolutions = countSolutionsByMinimumRemainingValues(&state, maxNumSolutions, &numNodes);
+		break;
 	}
 
 	cleanupSolverState(&state);
-	*numSolutions = sum;
+	if (statisticsOut != NULL)
+		statisticsOut->numNodes = numNodes;
 	return true;
 }
+
+bool calculateNumSolutions(const Board* boardIn, int* numSolutions) {
+	return calculateNumSolutionsUsingMethod(boardIn, BACKTRACK_SOLVER_METHOD_MRV, 0, numSolutions, NULL);
+}
+
+bool calculateNumSolutionsUpToLimit(const Board* boardIn, int maxNumSolutions, int* numSolutions) {
+	return calculateNumSolutionsUsingMethod(boardIn, BACKTRACK_SOLVER_METHOD_MRV, maxNumSolutions, numSolutions, NULL);
+}
+
+/**
+ * Checks whether some value appears more than once in a row, column or block of the
+ * board contained in the provided state.
+ * 
+ * @param state 	[in] Current state of the solver, freshly initialized
+ * @return true 	iff the board has conflicting cells
+ * @return false 	otherwise
+ */
+bool hasSolverPuzzleConflicts(const BacktrackSolverState* state) {
+	int categoryNo = 0, value = 0;
+
+	for (categoryNo = 0; categoryNo < state->MN; categoryNo++)
+		for (value = 1; value <= state->MN; value++)
+			if ((state->rowsCellsValuesCounters[categoryNo][value] > 1) ||
+				(state->columnsCellsValuesCounters[categoryNo][value] > 1) ||
+				(state->blocksCellsValuesCounters[categoryNo][value] > 1))
+				return true;
+
+	return false;
+}
+
+/**
+ * Finds a solution to the provided sudoku board, if there is any, by the backtracking
+ * search with hidden singles propagation, stopped at the first solution.
+ * 
+ * @param boardIn 					[in] Board to be solved
+ * @param isTryingValuesInRandomOrder 	[in] Whether values are tried in random order, so
+ * 									that a random solution is found
+ * @param solutionOut 				[in, out] Pointer to a board to be created as a copy
+ * 									of the solution found, if there is any
+ * @param isSolvableOut 			[in, out] Pointer to a boolean to be assigned with true
+ * 									iff the board has a solution
+ * @return true 					iff the procedure was successful
+ * @return false 					iff a memory error occurred
+ */
+bool findSolverPuzzleSolution(const Board* boardIn, bool isTryingValuesInRandomOrder, Board* solutionOut, bool* isSolvableOut) {
+	BacktrackSolverState state = {0};
+	long numNodes = 0;
+
+	if (!initSolverState(&state, boardIn)) {
+		return false;
+	}
+
+	*isSolvableOut = false;
+	if (!hasSolverPuzzleConflicts(&state)) {
+		state.isPropagatingHiddenSingles = true;
+		state.isTryingValuesInRandomOrder = isTryingValuesInRandomOrder;
+		/* the search stops right after filling the last empty cell, leaving the solution in place */
+		*isSolvableOut = countSolutionsByMinimumRemainingValues(&state, 1, &numNodes) == 1;
+	}
+
+	if (*isSolvableOut && !copyBoard(&(state.puzzle), solutionOut)) {
+		cleanupSolverState(&state);
+		return false;
+	}
+
+	cleanupSolverState(&state);
+	return true;
+}
+
+bool findSolutionUsingBacktracking(const Board* boardIn, Board* solutionOut, bool* isSolvableOut) {
+	return findSolverPuzzleSolution(boardIn, false, solutionOut, isSolvableOut);
+}
+
+bool findRandomSolutionUsingBacktracking(const Board* boardIn, Board* solutionOut, bool* isSolvableOut) {
+	return findSolverPuzzleSolution(boardIn, true, solutionOut, isSolvableOut);
+}
@@ -6,12 +6,39 @@
 
 /* This module is designed to calculate the number of solution to a provided sudoku board
 using the exhaustive backtracking algorithm, using a stack to simulate the recursion instead
-of making explicit recursive calls */
+of making explicit recursive calls. The stack is an array of frames allocated once per search,
+so no memory is allocated or freed while searching.
+By default, the search branches on the empty cell with the fewest legal values, and tries
+only those values (minimum remaining values). It may also propagate hidden singles: when a
+value fits only one empty cell of some row, column or block, that cell is filled with it
+first. The original order, filling the empty cells row after row and trying every value in
+each, remains available for comparison. The same search, stopped at the first solution,
+serves as an exact solver for boards, with no need for linear programming. Trying values
+in random order, it completes boards into random solutions, as generating boards requires */
+
+/**
+ * The methods by which the backtracking search picks the cell to branch on.
+ */
+typedef enum {
+	BACKTRACK_SOLVER_METHOD_MRV,
+	BACKTRACK_SOLVER_METHOD_PROPAGATION,
+	BACKTRACK_SOLVER_METHOD_ORDERED
+} BacktrackSolverMethod;
+
+/**
+ * BacktrackSolverStatistics struct holds figures gathered while searching: the number of
+ * search nodes, i.e. of values tried in cells. Note that the ordered method tries illegal
+ * values as well, while the minimum remaining values method only tries legal ones.
+ */
+typedef struct {
+	long numNodes;
+} BacktrackSolverStatistics;
 
 /**
  * Calculates the number of possible solutions to the provided suduko board. 
  * It employs the exhaustive backtracking algorithm, trying every legal value
  * for each cell, and backtrack when the board is solved to find all other solutions.
+ * The minimum remaining values method is used.
  * pre-condition: the input board is not erroneous.
  * 
  * @param board             [in] Board to calculate the number of solutions for
@@ -22,4 +49,69 @@ of making explicit recursive calls */
 
 bool calculateNumSolutions(const Board* board, int* numSolutions);
 
+/**
+ * Calculates the number of possible solutions to the provided suduko board, as
+ * calculateNumSolutions does, but stops searching once a provided number of solutions is
+ * found. Thus checking whether a board has a unique solution only takes a limit of 2.
+ * pre-condition: the input board is not erroneous.
+ * 
+ * @param board             [in] Board to calculate the number of solutions for
+ * @param maxNumSolutions   [in] The number of solutions at which the search stops, or 0
+ *                          to exhaust the search
+ * @param numSolutions      [in, out] Pointer to an integer to be assigned with the result:
+ *                          the number of solutions, or maxNumSolutions if there are at
+ *                          least as many
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool calculateNumSolutionsUpToLimit(const Board* board, int maxNumSolutions, int* numSolutions);
+
+/**
+ * Calculates the number of possible solutions to the provided suduko board, as
+ * calculateNumSolutionsUpToLimit does, using the requested method, and reports statistics
+ * gathered during the search. All methods yield the same number of solutions.
+ * pre-condition: the input board is not erroneous.
+ * 
+ * @param board             [in] Board to calculate the number of solutions for
+ * @param method            [in] The method by which cells to branch on are picked
+ * @param maxNumSolutions   [in] The number of solutions at which the search stops, or 0
+ *                          to exhaust the search
+ * @param numSolutions      [in, out] Pointer to an integer to be assigned with the result
+ * @param statisticsOut     [in, out] Pointer to a BacktrackSolverStatistics struct to be
+ *                          filled with the search's statistics, or NULL
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool calculateNumSolutionsUsingMethod(const Board* board, BacktrackSolverMethod method, int maxNumSolutions, int* numSolutions, BacktrackSolverStatistics* statisticsOut);
+
+/**
+ * Finds a solution to the provided sudoku board, if there is any, by the backtracking
+ * search with hidden singles propagation, stopped at the first solution.
+ * A board whose filled cells conflict has no solution.
+ * 
+ * @param board             [in] Board to be solved
+ * @param solutionOut       [in, out] Pointer to a board to be created as a copy of the
+ *                          solution found. It is only created if there is a solution
+ * @param isSolvableOut     [in, out] Pointer to a boolean to be assigned with true iff the
+ *                          board has a solution
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool findSolutionUsingBacktracking(const Board* board, Board* solutionOut, bool* isSolvableOut);
+
+/**
+ * Finds a random solution to the provided sudoku board, if there is any, as
+ * findSolutionUsingBacktracking does, but trying the values of each cell in random order.
+ * Values are drawn with rand(), so the caller is expected to have seeded it.
+ * 
+ * @param board             [in] Board to be solved
+ * @param solutionOut       [in, out] Pointer to a board to be created as a copy of the
+ *                          solution found. It is only created if there is a solution
+ * @param isSolvableOut     [in, out] Pointer to a boolean to be assigned with true iff the
+ *                          board has a solution
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool findRandomSolutionUsingBacktracking(const Board* board, Board* solutionOut, bool* isSolvableOut);
+
 #endif /* BT_SOLVER_H */
@@ -0,0 +1,619 @@
+#include "DLX_solver.h"
+
+#include <stdlib.h>
+
+#define UNUSED(x) (void)(x)
+
+/**
+ * The number of constraint kinds of a sudoku board: a value in each cell, and each
+ * value in each row, column and block.
+ */
+#define DANCING_LINKS_NUM_CONSTRAINT_KINDS (1 + BOARD_NUM_CATEGORIES)
+
+/**
+ * The number of constraints each placement of a value in a cell satisfies: one of each kind.
+ */
+#define DANCING_LINKS_NUM_NODES_IN_ROW (DANCING_LINKS_NUM_CONSTRAINT_KINDS)
+
+/**
+ * Marks a constraint which is already satisfied by the filled cells of the board, and
+ * thus has no column in the matrix.
+ */
+#define DANCING_LINKS_SATISFIED_CONSTRAINT (-1)
+
+/**
+ * The index of the root node, whose horizontal list holds the headers of the columns
+ * which are not covered.
+ */
+#define DANCING_LINKS_ROOT (0)
+
+/**
+ * The DancingLinksNode struct is a node of the sparse cover matrix, linked to its neighbours
+ * in its row and in its column by their indices in the nodes arena. Column headers are nodes
+ * as well, whose column is themselves and whose row is -1.
+ */
+typedef struct {
+	int left;
+	int right;
+	int up;
+	int down;
+	int column;
+	int row;
+} DancingLinksNode;
+
+/**
+ * The DancingLinksMatrix struct represents the cover matrix of a board and the state of
+ * its search: the nodes (the root first, then the column headers, then the nodes of each
+ * row in turn), the number of rows in each column, the cell and value of each row, and the
+ * stack of nodes whose rows were chosen at each search level. All of these reside in a
+ * single memory allocation. The struct also holds a copy of the board, on which solutions
+ * are written as they are found.
+ */
+typedef struct {
+	int MN;
+	Board puzzle;
+	void* arena;
+	DancingLinksNode* nodes;
+	int numColumns;
+	int* columnsSizes;
+	int numRows;
+	int* rowsCells;
+	int* rowsValues;
+	int* choices;
+	int maxNumChoices;
+} DancingLinksMatrix;
+
+/**
+ * Get the index of the constraint of a particular kind satisfied by placing a value in
+ * a cell. Constraints are numbered kind after kind: first the cells, then the values in
+ * each row, column and block.
+ *
+ * @param MN 			[in] The number of cells in a board block
+ * @param kind 			[in] 0 for the cell's constraint, or 1 plus a BoardCategory for the
+ * 						constraint of the value in the cell's row, column or block
+ * @param cell 			[in] The index of the cell in the board (row * MN + column)
+ * @param categoryNo 	[in] The number of row, column or block the cell is in, according
+ * 						to the kind (unused for the cell's constraint)
+ * @param value 		[in] The value placed in the cell (unused for the cell's constraint)
+ * @return int 			The index of the constraint
+ */
+int getDancingLinksConstraint(int MN, int kind, int cell, int categoryNo, int value) {
+	if (kind == 0)
+		return cell;
+
+	return kind * MN * MN + categoryNo * MN + (value - 1);
+}
+
+/**
+ * Get the indices of the constraints satisfied by placing a value in a cell.
+ *
+ * @param board 			[in] The board the cell belongs to
+ * @param row 				[in] The row number of the cell
+ * @param col 				[in] The column number of the cell
+ * @param value 			[in] The value placed in the cell
+ * @param constraintsOut 	[in, out] An array of DANCING_LINKS_NUM_NODES_IN_ROW integers to be
+ * 							assigned with the indices of the constraints
+ */
+void getDancingLinksPlacementConstraints(const Board* board, int row, int col, int value, int* constraintsOut) {
+	int MN = getBoardBlockSize_MN(board);
+	int cell = row * MN + col;
+
+	constraintsOut[0] = getDancingLinksConstraint(MN, 0, cell, 0, 0);
+	constraintsOut[1 + BOARD_CATEGORY_ROW] = getDancingLinksConstraint(MN, 1 + BOARD_CATEGORY_ROW, cell, row, value);
+	constraintsOut[1 + BOARD_CATEGORY_COLUMN] = getDancingLinksConstraint(MN, 1 + BOARD_CATEGORY_COLUMN, cell, col, value);
+	constraintsOut[1 + BOARD_CATEGORY_BLOCK] = getDancingLinksConstraint(MN, 1 + BOARD_CATEGORY_BLOCK, cell, whichBlock(board, row, col), value);
+}
+
+/**
+ * Checks whether placing a value in an empty cell satisfies only constraints which are
+ * not yet satisfied, that is, whether the value is legal for the cell.
+ *
+ * @param constraintsColumns 	[in] The column of each constraint, or
+ * 								DANCING_LINKS_SATISFIED_CONSTRAINT
+ * @param constraints 			[in] The constraints the placement satisfies
+ * @return true 				iff all the constraints are not yet satisfied
+ * @return false 				otherwise
+ */
+bool isDancingLinksPlacementLegal(const int* constraintsColumns, const int* constraints) {
+	int i = 0;
+
+	for (i = 0; i < DANCING_LINKS_NUM_NODES_IN_ROW; i++)
+		if (constraintsColumns[constraints[i]] == DANCING_LINKS_SATISFIED_CONSTRAINT)
+			return false;
+
+	return true;
+}
+
+/**
+ * Marks the constraints satisfied by the filled cells of a board, and numbers the column
+ * header nodes of the other constraints.
+ *
+ * @param board 				[in] The board whose constraints are examined
+ * @param constraintsColumns 	[in, out] An array with an entry per constraint, to be
+ * 								assigned with the index of the constraint's header node, or
+ * 								with DANCING_LINKS_SATISFIED_CONSTRAINT
+ * @return int 					The number of constraints not yet satisfied
+ */
+int markDancingLinksConstraints(const Board* board, int* constraintsColumns) {
+	int MN = getBoardBlockSize_MN(board);
+	int numConstraints = DANCING_LINKS_NUM_CONSTRAINT_KINDS * MN * MN;
+	int constraints[DANCING_LINKS_NUM_NODES_IN_ROW];
+	int numColumns = 0;
+	int row = 0, col = 0, constraint = 0, i = 0;
+
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++) {
+			const Cell* cell = viewBoardCellByRow(board, row, col);
+			if (isBoardCellEmpty(cell))
+				continue;
+
+			getDancingLinksPlacementConstraints(board, row, col, getBoardCellValue(cell), constraints);
+			for (i = 0; i < DANCING_LINKS_NUM_NODES_IN_ROW; i++)
+				constraintsColumns[constraints[i]] = DANCING_LINKS_SATISFIED_CONSTRAINT;
+		}
+
+	for (constraint = 0; constraint < numConstraints; constraint++)
+		if (constraintsColumns[constraint] != DANCING_LINKS_SATISFIED_CONSTRAINT)
+			constraintsColumns[constraint] = ++numColumns; /* Note: header nodes follow the root */
+
+	return numColumns;
+}
+
+/**
+ * Counts the legal placements of values in the empty cells of a board, that is, the rows
+ * of its cover matrix.
+ *
+ * @param board 				[in] The board whose placements are counted
+ * @param constraintsColumns 	[in] The column of each constraint, or
+ * 								DANCING_LINKS_SATISFIED_CONSTRAINT
+ * @return int 					The number of legal placements
+ */
+int countDancingLinksRows(const Board* board, const int* constraintsColumns) {
+	int MN = getBoardBlockSize_MN(board);
+	int constraints[DANCING_LINKS_NUM_NODES_IN_ROW];
+	int numRows = 0;
+	int row = 0, col = 0, value = 0;
+
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++) {
+			if (!isBoardCellEmpty(viewBoardCellByRow(board, row, col)))
+				continue;
+
+			for (value = 1; value <= MN; value++) {
+				getDancingLinksPlacementConstraints(board, row, col, value, constraints);
+				if (isDancingLinksPlacementLegal(constraintsColumns, constraints))
+					numRows++;
+			}
+		}
+
+	return numRows;
+}
+
+/**
+ * Allocates the arena of a cover matrix whose numbers of columns and rows are set, and
+ * divides it among the matrix's arrays.
+ *
+ * @param matrix 	[in, out] The matrix whose arena is allocated
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool allocateDancingLinksMatrixArena(DancingLinksMatrix* matrix) {
+	int numNodes = 1 + matrix->numColumns + DANCING_LINKS_NUM_NODES_IN_ROW * matrix->numRows;
+	int numInts = (1 + matrix->numColumns) + 2 * matrix->numRows + matrix->maxNumChoices;
+
+	matrix->arena = calloc(1, numNodes * sizeof(DancingLinksNode) + numInts * sizeof(int));
+	if (matrix->arena == NULL)
+		return false;
+
+	matrix->nodes = (DancingLinksNode*)matrix->arena;
+	matrix->columnsSizes = (int*)(matrix->nodes + numNodes);
+	matrix->rowsCells = matrix->columnsSizes + (1 + matrix->numColumns);
+	matrix->rowsValues = matrix->rowsCells + matrix->numRows;
+	matrix->choices = matrix->rowsValues + matrix->numRows;
+
+	return true;
+}
+
+/**
+ * Links the root and the column header nodes of a cover matrix, with all columns empty.
+ *
+ * @param matrix 	[in, out] The matrix whose headers are linked
+ */
+void linkDancingLinksHeaders(DancingLinksMatrix* matrix) {
+	int header = 0;
+
+	for (header = DANCING_LINKS_ROOT; header <= matrix->numColumns; header++) {
+		DancingLinksNode* node = &(matrix->nodes[header]);
+		node->left = (header == DANCING_LINKS_ROOT) ? matrix->numColumns : header - 1;
+		node->right = (header == matrix->numColumns) ? DANCING_LINKS_ROOT : header + 1;
+		node->up = header;
+		node->down = header;
+		node->column = header;
+		node->row = -1;
+	}
+}
+
+/**
+ * Appends a row to a cover matrix, for the placement of a value in a cell.
+ *
+ * @param matrix 				[in, out] The matrix to which the row is appended
+ * @param rowNo 				[in] The number of the new row
+ * @param cell 					[in] The index of the cell in the board (row * MN + column)
+ * @param value 				[in] The value placed in the cell
+ * @param constraintsColumns 	[in] The column of each constraint
+ * @param constraints 			[in] The constraints the placement satisfies
+ */
+void appendDancingLinksRow(DancingLinksMatrix* matrix, int rowNo, int cell, int value, const int* constraintsColumns, const int* constraints) {
+	int first = 1 + matrix->numColumns + rowNo * DANCING_LINKS_NUM_NODES_IN_ROW;
+	int i = 0;
+
+	matrix->rowsCells[rowNo] = cell;
+	matrix->rowsValues[rowNo] = value;
+
+	for (i = 0; i < DANCING_LINKS_NUM_NODES_IN_ROW; i++) {
+		int index = first + i;
+		int column = constraintsColumns[constraints[i]];
+		DancingLinksNode* node = &(matrix->nodes[index]);
+
+		node->left = first + (i + DANCING_LINKS_NUM_NODES_IN_ROW - 1) % DANCING_LINKS_NUM_NODES_IN_ROW;
+		node->right = first + (i + 1) % DANCING_LINKS_NUM_NODES_IN_ROW;
+		node->column = column;
+		node->row = rowNo;
+
+		/* append at the bottom of the column */
+		node->up = matrix->nodes[column].up;
+		node->down = column;
+		matrix->nodes[node->up].down = index;
+		matrix->nodes[column].up = index;
+		matrix->columnsSizes[column]++;
+	}
+}
+
+/**
+ * Frees all memory allocated to the provided DancingLinksMatrix struct.
+ *
+ * @param matrix 	[in, out] The matrix to be freed
+ */
+void cleanupDancingLinksMatrix(DancingLinksMatrix* matrix) {
+	if (matrix->arena != NULL) {
+		free(matrix->arena);
+		matrix->arena = NULL;
+	}
+	matrix->nodes = NULL;
+	matrix->columnsSizes = NULL;
+	matrix->rowsCells = NULL;
+	matrix->rowsValues = NULL;
+	matrix->choices = NULL;
+	cleanupBoard(&(matrix->puzzle));
+}
+
+/**
+ * Creates the cover matrix of a board, whose columns are the constraints not yet satisfied
+ * by the board's filled cells, and whose rows are the legal placements of values in its
+ * empty cells.
+ *
+ * @param board 	[in] The board whose matrix is created
+ * @param matrix 	[in, out] The matrix to be created
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool createDancingLinksMatrix(const Board* board, DancingLinksMatrix* matrix) {
+	int MN = getBoardBlockSize_MN(board);
+	int* constraintsColumns = NULL;
+	int constraints[DANCING_LINKS_NUM_NODES_IN_ROW];
+	int rowNo = 0;
+	int row = 0, col = 0, value = 0;
+
+	matrix->MN = MN;
+	matrix->arena = NULL;
+
+	constraintsColumns = calloc(DANCING_LINKS_NUM_CONSTRAINT_KINDS * MN * MN, sizeof(int));
+	if (constraintsColumns == NULL)
+		return false;
+
+	matrix->numColumns = markDancingLinksConstraints(board, constraintsColumns);
+	matrix->numRows = countDancingLinksRows(board, constraintsColumns);
+	matrix->maxNumChoices = countNumEmptyCells(board) + 1;
+
+	if (!allocateDancingLinksMatrixArena(matrix)) {
+		free(constraintsColumns);
+		return false;
+	}
+
+	if (!copyBoard(board, &(matrix->puzzle))) {
+		free(constraintsColumns);
+		free(matrix->arena);
+		matrix->arena = NULL;
+		return false;
+	}
+
+	linkDancingLinksHeaders(matrix);
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++) {
+			if (!isBoardCellEmpty(viewBoardCellByRow(board, row, col)))
+				continue;
+
+			for (value = 1; value <= MN; value++) {
+				getDancingLinksPlacementConstraints(board, row, col, value, constraints);
+				if (isDancingLinksPlacementLegal(constraintsColumns, constraints))
+					appendDancingLinksRow(matrix, rowNo++, row * MN + col, value, constraintsColumns, constraints);
+			}
+		}
+
+	free(constraintsColumns);
+	return true;
+}
+
+/**
+ * Covers a column: removes its header from the list of columns, and the rows it contains
+ * from all other columns.
+ *
+ * @param matrix 	[in, out] The matrix whose column is covered
+ * @param column 	[in] The index of the column's header node
+ */
+void coverDancingLinksColumn(DancingLinksMatrix* matrix, int column) {
+	DancingLinksNode* nodes = matrix->nodes;
+	int i = 0, j = 0;
+
+	nodes[nodes[column].right].left = nodes[column].left;
+	nodes[nodes[column].left].right = nodes[column].right;
+
+	for (i = nodes[column].down; i != column; i = nodes[i].down)
+		for (j = nodes[i].right; j != i; j = nodes[j].right) {
+			nodes[nodes[j].down].up = nodes[j].up;
+			nodes[nodes[j].up].down = nodes[j].down;
+			matrix->columnsSizes[nodes[j].column]--;
+		}
+}
+
+/**
+ * Uncovers a column, exactly reversing coverDancingLinksColumn.
+ *
+ * @param matrix 	[in, out] The matrix whose column is uncovered
+ * @param column 	[in] The index of the column's header node
+ */
+void uncoverDancingLinksColumn(DancingLinksMatrix* matrix, int column) {
+	DancingLinksNode* nodes = matrix->nodes;
+	int i = 0, j = 0;
+
+	for (i = nodes[column].up; i != column; i = nodes[i].up)
+		for (j = nodes[i].left; j != i; j = nodes[j].left) {
+			matrix->columnsSizes[nodes[j].column]++;
+			nodes[nodes[j].down].up = j;
+			nodes[nodes[j].up].down = j;
+		}
+
+	nodes[nodes[column].right].left = column;
+	nodes[nodes[column].left].right = column;
+}
+
+/**
+ * Chooses a row: covers the columns of all its other nodes, its own node's column being
+ * covered already.
+ *
+ * @param matrix 	[in, out] The matrix whose row is chosen
+ * @param node 		[in] The index of the node of the row in the covered column
+ */
+void coverDancingLinksRow(DancingLinksMatrix* matrix, int node) {
+	int j = 0;
+
+	for (j = matrix->nodes[node].right; j != node; j = matrix->nodes[j].right)
+		coverDancingLinksColumn(matrix, matrix->nodes[j].column);
+}
+
+/**
+ * Unchooses a row, exactly reversing coverDancingLinksRow.
+ *
+ * @param matrix 	[in, out] The matrix whose row is unchosen
+ * @param node 		[in] The index of the node of the row in the covered column
+ */
+void uncoverDancingLinksRow(DancingLinksMatrix* matrix, int node) {
+	int j = 0;
+
+	for (j = matrix->nodes[node].left; j != node; j = matrix->nodes[j].left)
+		uncoverDancingLinksColumn(matrix, matrix->nodes[j].column);
+}
+
+/**
+ * Finds the uncovered column with the fewest rows. The search stops early once a column
+ * with at most one row is found.
+ *
+ * @param matrix 	[in] The matrix whose columns are examined
+ * @return int 		The index of the column's header node, or DANCING_LINKS_ROOT if all
+ * 					columns are covered
+ */
+int findSmallestDancingLinksColumn(const DancingLinksMatrix* matrix) {
+	int best = DANCING_LINKS_ROOT;
+	int column = 0;
+
+	for (column = matrix->nodes[DANCING_LINKS_ROOT].right; column != DANCING_LINKS_ROOT; column = matrix->nodes[column].right)
+		if ((best == DANCING_LINKS_ROOT) || (matrix->columnsSizes[column] < matrix->columnsSizes[best])) {
+			best = column;
+			if (matrix->columnsSizes[best] <= 1)
+				break;
+		}
+
+	return best;
+}
+
+/**
+ * Writes the solution made of the rows chosen in the search stack onto the matrix's board.
+ *
+ * @param matrix 		[in, out] The matrix whose board is written
+ * @param numChoices 	[in] The number of rows chosen
+ */
+void writeDancingLinksSolution(DancingLinksMatrix* matrix, int numChoices) {
+	int level = 0;
+
+	for (level = 0; level < numChoices; level++) {
+		int rowNo = matrix->nodes[matrix->choices[level]].row;
+		int cell = matrix->rowsCells[rowNo];
+		setBoardCellValue(&(matrix->puzzle), cell / matrix->MN, cell % matrix->MN, matrix->rowsValues[rowNo]);
+	}
+}
+
+/**
+ * Searches the cover matrix for all exact covers, using Algorithm X. Rather than making
+ * recursive calls, the search keeps the node of the row chosen at each level in a stack.
+ *
+ * @param matrix 		[in, out] The matrix to be searched, freshly created
+ * @param handler 		[in] Function to be called with every solution found, or NULL
+ * @param context 		[in, out] Context to be passed to the handler
+ * @param numNodesOut 	[in, out] A pointer to a long to be assigned with the number of
+ * 						rows tried
+ * @return int 			The number of solutions found
+ */
+int searchDancingLinks(DancingLinksMatrix* matrix, DancingLinksSolutionHandler handler, void* context, long* numNodesOut) {
+	int sum = 0;
+	long numNodes = 0;
+	int level = 0;
+	bool shouldDescend = true;
+
+	while (true) {
+		if (shouldDescend) {
+			int column = findSmallestDancingLinksColumn(matrix);
+
+			if (column == DANCING_LINKS_ROOT) {
+				/* all constraints satisfied, count as solved */
+				sum++;
+				if (handler != NULL) {
+					writeDancingLinksSolution(matrix, level);
+					if (!handler(&(matrix->puzzle), context))
+						break;
+				}
+				shouldDescend = false;
+			} else if (matrix->columnsSizes[column] == 0) {
+				/* dead end */
+				shouldDescend = false;
+			} else {
+				coverDancingLinksColumn(matrix, column);
+				matrix->choices[level] = matrix->nodes[column].down;
+				coverDancingLinksRow(matrix, matrix->choices[level]);
+				numNodes++;
+				level++;
+			}
+			continue;
+		}
+
+		/* back track */
+		if (level == 0)
+			break;
+
+		level--;
+		uncoverDancingLinksRow(matrix, matrix->choices[level]);
+		matrix->choices[level] = matrix->nodes[matrix->choices[level]].down;
+		if (matrix->nodes[matrix->choices[level]].row < 0) {
+			/* the column's rows are exhausted */
+			uncoverDancingLinksColumn(matrix, matrix->choices[level]);
+			continue;
+		}
+
+		/* try the next row of the column */
+		coverDancingLinksRow(matrix, matrix->choices[level]);
+		numNodes++;
+		level++;
+		shouldDescend = true;
+	}
+
+	*numNodesOut = numNodes;
+	return sum;
+}
+
+bool enumerateSolutionsUsingDancingLinks(const Board* board, DancingLinksSolutionHandler handler, void* context, int* numSolutionsOut, DancingLinksStatistics* statisticsOut) {
+	DancingLinksMatrix matrix = {0};
+	long numNodes = 0;
+
+	if (!createDancingLinksMatrix(board, &matrix))
+		return false;
+
+	*numSolutionsOut = searchDancingLinks(&matrix, handler, context, &numNodes);
+
+	cleanupDancingLinksMatrix(&matrix);
+	if (statisticsOut != NULL)
+		statisticsOut->numNodes = numNodes;
+	return true;
+}
+
+bool calculateNumSolutionsUsingDancingLinks(const Board* board, int* numSolutions) {
+	return enumerateSolutionsUsingDancingLinks(board, NULL, NULL, numSolutions, NULL);
+}
+
+/**
+ * The SolutionsLimitContext struct is the context of an enumeration which stops once
+ * a number of solutions is found: that number, and the number of solutions found so far.
+ */
+typedef struct {
+	int maxNumSolutions;
+	int numSolutionsFound;
+} SolutionsLimitContext;
+
+/**
+ * A DancingLinksSolutionHandler which counts the solutions found and stops the
+ * enumeration once their number reaches the limit.
+ *
+ * @param solution 		[in] The solved board
+ * @param context 		[in, out] A SolutionsLimitContext, cast to a void pointer
+ * @return true 		iff fewer solutions than the limit were found
+ * @return false 		iff the limit was reached
+ */
+bool stopAtDancingLinksSolutionsLimit(const Board* solution, void* context) {
+	SolutionsLimitContext* limitContext = (SolutionsLimitContext*)context;
+
+	UNUSED(solution);
+
+	limitContext->numSolutionsFound++;
+	return limitContext->numSolutionsFound < limitContext->maxNumSolutions;
+}
+
+bool calculateNumSolutionsUsingDancingLinksUpToLimit(const Board* board, int maxNumSolutions, int* numSolutions) {
+	SolutionsLimitContext context = {0};
+
+	if (maxNumSolutions <= 0)
+		return calculateNumSolutionsUsingDancingLinks(board, numSolutions);
+
+	context.maxNumSolutions = maxNumSolutions;
+	context.numSolutionsFound = 0;
+
+	return enumerateSolutionsUsingDancingLinks(board, stopAtDancingLinksSolutionsLimit, &context, numSolutions, NULL);
+}
+
+/**
+ * The FirstSolutionContext struct is the context of the enumeration looking for the
+ * first solution of a board: where to copy it to, and whether copying it succeeded.
+ */
+typedef struct {
+	Board* solutionOut;
+	bool isCopied;
+} FirstSolutionContext;
+
+/**
+ * A DancingLinksSolutionHandler which copies the first solution found and stops the
+ * enumeration.
+ *
+ * @param solution 		[in] The solved board
+ * @param context 		[in, out] A FirstSolutionContext, cast to a void pointer
+ * @return false 		always, to stop the enumeration
+ */
+bool copyFirstDancingLinksSolution(const Board* solution, void* context) {
+	FirstSolutionContext* firstSolutionContext = (FirstSolutionContext*)context;
+
+	firstSolutionContext->isCopied = copyBoard(solution, firstSolutionContext->solutionOut);
+	return false;
+}
+
+bool findSolutionUsingDancingLinks(const Board* board, Board* solutionOut, bool* isSolvableOut) {
+	FirstSolutionContext context = {0};
+	int numSolutions = 0;
+
+	context.solutionOut = solutionOut;
+	context.isCopied = false;
+
+	if (!enumerateSolutionsUsingDancingLinks(board, copyFirstDancingLinksSolution, &context, &numSolutions, NULL))
+		return false;
+
+	if ((numSolutions > 0) && !context.isCopied)
+		return false; /* memory error while copying the solution */
+
+	*isSolvableOut = numSolutions > 0;
+	return true;
+}
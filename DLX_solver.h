@@ -0,0 +1,93 @@
+#ifndef DLX_SOLVER_H
+#define DLX_SOLVER_H
+
+#include <stdbool.h>
+#include "board.h"
+
+/* This module is designed to solve sudoku boards by reducing them to exact cover problems,
+solved with Knuth's Algorithm X over the dancing links representation of the cover matrix.
+The matrix has a column for each constraint of the board not yet satisfied by its filled
+cells: every empty cell must hold a value, and every value must appear in each row, column
+and block. It has a row for each legal placement of a value in an empty cell, covering the
+four constraints the placement satisfies. Each search step branches on the column with the
+fewest rows. All nodes of the matrix and the search stack are allocated once per search,
+so no memory is allocated or freed while searching, and the search itself is iterative */
+
+/**
+ * DancingLinksStatistics struct holds figures gathered while searching: the number of
+ * search nodes, i.e. of placements of values in cells tried.
+ */
+typedef struct {
+	long numNodes;
+} DancingLinksStatistics;
+
+/**
+ * Function pointer to a handler of solutions found while enumerating the solutions of a board.
+ *
+ * @param solution 		[in] The solved board. It is only valid during the call
+ * @param context 		[in, out] The context provided to the enumeration
+ * @return true 		iff the enumeration should go on
+ * @return false 		iff the enumeration should stop
+ */
+typedef bool (*DancingLinksSolutionHandler)(const Board* solution, void* context);
+
+/**
+ * Enumerates the solutions to the provided sudoku board, passing each of them to the
+ * provided handler, until they are exhausted or the handler asks to stop.
+ * pre-condition: the input board is not erroneous.
+ *
+ * @param board             [in] Board whose solutions are enumerated
+ * @param handler           [in] Function to be called with every solution found, or NULL
+ * @param context           [in, out] Context to be passed to the handler
+ * @param numSolutionsOut   [in, out] Pointer to an integer to be assigned with the number
+ *                          of solutions found
+ * @param statisticsOut     [in, out] Pointer to a DancingLinksStatistics struct to be
+ *                          filled with the search's statistics, or NULL
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool enumerateSolutionsUsingDancingLinks(const Board* board, DancingLinksSolutionHandler handler, void* context, int* numSolutionsOut, DancingLinksStatistics* statisticsOut);
+
+/**
+ * Calculates the number of possible solutions to the provided sudoku board.
+ * pre-condition: the input board is not erroneous.
+ *
+ * @param board             [in] Board to calculate the number of solutions for
+ * @param numSolutions      [in, out] Pointer to an integer to be assigned with the result
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool calculateNumSolutionsUsingDancingLinks(const Board* board, int* numSolutions);
+
+/**
+ * Calculates the number of possible solutions to the provided sudoku board, as
+ * calculateNumSolutionsUsingDancingLinks does, but stops searching once a provided number
+ * of solutions is found.
+ * pre-condition: the input board is not erroneous.
+ *
+ * @param board             [in] Board to calculate the number of solutions for
+ * @param maxNumSolutions   [in] The number of solutions at which the search stops, or 0
+ *                          to exhaust the search
+ * @param numSolutions      [in, out] Pointer to an integer to be assigned with the result:
+ *                          the number of solutions, or maxNumSolutions if there are at
+ *                          least as many
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool calculateNumSolutionsUsingDancingLinksUpToLimit(const Board* board, int maxNumSolutions, int* numSolutions);
+
+/**
+ * Finds the first solution to the provided sudoku board, if there is any.
+ * pre-condition: the input board is not erroneous.
+ *
+ * @param board             [in] Board to be solved
+ * @param solutionOut       [in, out] Pointer to a board to be created as a copy of the
+ *                          first solution found. It is only created if there is a solution
+ * @param isSolvableOut     [in, out] Pointer to a boolean to be assigned with true iff the
+ *                          board has a solution
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool findSolutionUsingDancingLinks(const Board* board, Board* solutionOut, bool* isSolvableOut);
+
+#endif /* DLX_SOLVER_H */
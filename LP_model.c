@@ -0,0 +1,627 @@
+#include <stdlib.h>
+
+#include "LP_model.h"
+#include "LP_solver.h"
+
+void freeVariablesMap(VariablesMap* variablesMap) {
+	free(variablesMap->cellsFirstVariable); /* Note: the arrays are allocated together */
+	variablesMap->cellsFirstVariable = NULL;
+	variablesMap->variablesValues = NULL;
+	variablesMap->cellsValuesVariables = NULL;
+}
+
+bool createVariablesMap(const Board* board, VariablesMap* variablesMapOut, bool* isThereUnsolvableCellOut) {
+	CellLegalValues* cellsLegalValues = NULL;
+	int* arrays = NULL;
+
+	int MN = getBoardBlockSize_MN(board);
+	int MN2 = getBoardSize_MN2(board);
+	int numWords = getNumCandidateSetWords(board);
+	int numVars = 0;
+	int cell = 0, var = 0;
+
+	if (!getSuperficiallyLegalValuesForAllBoardCells(board, &cellsLegalValues))
+		return false;
+
+	for (cell = 0; cell < MN2; cell++)
+		if (isBoardCellEmpty(&(board->cells[cell])))
+			numVars += cellsLegalValues[cell].numLegalValues;
+
+	/* Note: the three arrays are allocated together */
+	arrays = calloc((MN2 + 1) + numVars + MN2 * MN, sizeof(int));
+	if (arrays == NULL) {
+		freeCellsLegalValuesForAllBoardCells(board, cellsLegalValues);
+		return false;
+	}
+
+	variablesMapOut->MN = MN;
+	variablesMapOut->numVars = numVars;
+	variablesMapOut->cellsFirstVariable = arrays;
+	variablesMapOut->variablesValues = arrays + (MN2 + 1);
+	variablesMapOut->cellsValuesVariables = variablesMapOut->variablesValues + numVars;
+
+	for (cell = 0; cell < MN2; cell++) {
+		variablesMapOut->cellsFirstVariable[cell] = var;
+		if (isBoardCellEmpty(&(board->cells[cell]))) {
+			const CellLegalValues* cellLegalValues = &(cellsLegalValues[cell]);
+			int value = getNextValueInCandidateSet(cellLegalValues->legalValues, numWords, EMPTY_CELL_VALUE);
+
+			if (cellLegalValues->numLegalValues == 0)
+				*isThereUnsolvableCellOut = true;
+			while (value != EMPTY_CELL_VALUE) {
+				variablesMapOut->variablesValues[var] = value;
+				variablesMapOut->cellsValuesVariables[cell * MN + value - 1] = var + 1;
+				var++;
+				value = getNextValueInCandidateSet(cellLegalValues->legalValues, numWords, value);
+			}
+		}
+	}
+	variablesMapOut->cellsFirstVariable[MN2] = var;
+
+	freeCellsLegalValuesForAllBoardCells(board, cellsLegalValues);
+
+	return true;
+}
+
+/**
+ * PresolveState struct holds a board being presolved, along with the values placed so far in each of
+ * its rows, columns and blocks, as candidate sets: the set of instance categoryNo of a category is
+ * found at usedValues[category] + categoryNo * numWords. The other sets are scratch space.
+ */
+typedef struct {
+	Board* board;
+	int MN;
+	int numWords;
+	CandidateSetWord* usedValues[BOARD_NUM_CATEGORIES];
+	CandidateSetWord* allValues;
+	CandidateSetWord* candidates;
+	CandidateSetWord* seenOnce;
+	CandidateSetWord* seenTwice;
+} PresolveState;
+
+/**
+ * freePresolveState frees the sets of a PresolveState gotten from createPresolveState
+ *
+ * @param state	[in] the state to free
+ *
+ * @return void
+ */
+void freePresolveState(PresolveState* state) {
+	free(state->usedValues[BOARD_CATEGORY_ROW]); /* Note: the sets are allocated together */
+	state->usedValues[BOARD_CATEGORY_ROW] = NULL;
+}
+
+/**
+ * createPresolveState creates the state in which a board is presolved, with no value marked
+ * 					   as placed yet.
+ *
+ * @param board		[in] the board to presolve
+ * @param stateOut	[out] the state to fill. It must later be freed using freePresolveState.
+ *
+ * @return bool		true when succeeds, false otherwise (due to memory allocation failure)
+ */
+bool createPresolveState(Board* board, PresolveState* stateOut) {
+	CandidateSetWord* sets = NULL;
+
+	int MN = getBoardBlockSize_MN(board);
+	int numWords = getNumCandidateSetWords(board);
+	int category = 0, value = 0;
+
+	sets = calloc((BOARD_NUM_CATEGORIES * MN + 4) * numWords, sizeof(CandidateSetWord));
+	if (sets == NULL)
+		return false;
+
+	stateOut->board = board;
+	stateOut->MN = MN;
+	stateOut->numWords = numWords;
+	for (category = 0; category < BOARD_NUM_CATEGORIES; category++)
+		stateOut->usedValues[category] = sets + category * MN * numWords;
+	stateOut->allValues = sets + BOARD_NUM_CATEGORIES * MN * numWords;
+	stateOut->candidates = stateOut->allValues + numWords;
+	stateOut->seenOnce = stateOut->candidates + numWords;
+	stateOut->seenTwice = stateOut->seenOnce + numWords;
+
+	for (value = 1; value <= MN; value++)
+		addValueToCandidateSet(stateOut->allValues, value);
+
+	return true;
+}
+
+/**
+ * placePresolveValue places a value in an empty cell of the board being presolved, and marks it
+ * 					  as placed in the cell's row, column and block.
+ *
+ * @param state		[in, out] the presolve state
+ * @param cell		[in] the cell's index (i.e., row * MN + col)
+ * @param value		[in] the value to place
+ *
+ * @return void
+ */
+void placePresolveValue(PresolveState* state, int cell, int value) {
+	const BoardGeometry* geometry = state->board->geometry;
+
+	int category = 0;
+
+	setBoardCellValue(state->board, cell / state->MN, cell % state->MN, value);
+	for (category = 0; category < BOARD_NUM_CATEGORIES; category++)
+		addValueToCandidateSet(state->usedValues[category] + geometry->cellsCategories[category][cell] * state->numWords, value);
+}
+
+/**
+ * markPresolveGivenValues marks the values already in the board being presolved as placed.
+ *
+ * @param state		[in, out] the presolve state
+ *
+ * @return bool		true when succeeds, false if a value appears twice in the same row, column or block
+ */
+bool markPresolveGivenValues(PresolveState* state) {
+	const BoardGeometry* geometry = state->board->geometry;
+	int MN2 = getBoardSize_MN2(state->board);
+
+	int cell = 0;
+	for (cell = 0; cell < MN2; cell++) {
+		const Cell* boardCell = &(state->board->cells[cell]);
+		if (!isBoardCellEmpty(boardCell)) {
+			int value = getBoardCellValue(boardCell);
+			int category = 0;
+			for (category = 0; category < BOARD_NUM_CATEGORIES; category++) {
+				CandidateSetWord* usedValues = state->usedValues[category] + geometry->cellsCategories[category][cell] * state->numWords;
+				if (isValueInCandidateSet(usedValues, value))
+					return false;
+				addValueToCandidateSet(usedValues, value);
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * getPresolveCellCandidates gets the values which may still be placed in an empty cell of the board being
+ * 							 presolved (i.e., those not yet placed in its row, column or block) into state->candidates.
+ *
+ * @param state		[in, out] the presolve state
+ * @param cell		[in] the cell's index (i.e., row * MN + col)
+ *
+ * @return int		the number of such values
+ */
+int getPresolveCellCandidates(PresolveState* state, int cell) {
+	const BoardGeometry* geometry = state->board->geometry;
+	int numWords = state->numWords;
+
+	int wordIndex = 0;
+	for (wordIndex = 0; wordIndex < numWords; wordIndex++)
+		state->candidates[wordIndex] = state->allValues[wordIndex] &
+			~state->usedValues[BOARD_CATEGORY_ROW][geometry->cellsCategories[BOARD_CATEGORY_ROW][cell] * numWords + wordIndex] &
+			~state->usedValues[BOARD_CATEGORY_COLUMN][geometry->cellsCategories[BOARD_CATEGORY_COLUMN][cell] * numWords + wordIndex] &
+			~state->usedValues[BOARD_CATEGORY_BLOCK][geometry->cellsCategories[BOARD_CATEGORY_BLOCK][cell] * numWords + wordIndex];
+
+	return countCandidateSetValues(state->candidates, numWords);
+}
+
+/**
+ * placeNakedSingles places the value of each empty cell which has a single candidate left.
+ *
+ * @param state			[in, out] the presolve state
+ * @param hasPlacedOut	[out] set to true if a value was placed
+ *
+ * @return presolveBoardErrorCode	PRESOLVE_BOARD_BOARD_ISNT_SOLVABLE if an empty cell has no candidates
+ * 									left, PRESOLVE_BOARD_SUCCESS otherwise
+ */
+presolveBoardErrorCode placeNakedSingles(PresolveState* state, bool* hasPlacedOut) {
+	int MN2 = getBoardSize_MN2(state->board);
+
+	int cell = 0;
+	for (cell = 0; cell < MN2; cell++)
+		if (isBoardCellEmpty(&(state->board->cells[cell]))) {
+			switch (getPresolveCellCandidates(state, cell)) {
+			case 0:
+				return PRESOLVE_BOARD_BOARD_ISNT_SOLVABLE;
+			case 1:
+				placePresolveValue(state, cell, getNextValueInCandidateSet(state->candidates, state->numWords, EMPTY_CELL_VALUE));
+				*hasPlacedOut = true;
+				break;
+			default:
+				break;
+			}
+		}
+
+	return PRESOLVE_BOARD_SUCCESS;
+}
+
+/**
+ * placeHiddenSingles places each value which may only go in a single cell of some instance of a category.
+ *
+ * @param state			[in, out] the presolve state
+ * @param category		[in] the category (rows, columns or blocks)
+ * @param hasPlacedOut	[out] set to true if a value was placed
+ *
+ * @return presolveBoardErrorCode	PRESOLVE_BOARD_BOARD_ISNT_SOLVABLE if a value missing from an instance of
+ * 									the category may go in none of its cells, PRESOLVE_BOARD_SUCCESS otherwise
+ */
+presolveBoardErrorCode placeHiddenSingles(PresolveState* state, BoardCategory category, bool* hasPlacedOut) {
+	const BoardGeometry* geometry = state->board->geometry;
+	int MN = state->MN;
+	int numWords = state->numWords;
+
+	int categoryNo = 0;
+	for (categoryNo = 0; categoryNo < MN; categoryNo++) {
+		const int* categoryCells = geometry->categoriesCells[category] + categoryNo * MN;
+		const CandidateSetWord* usedValues = state->usedValues[category] + categoryNo * numWords;
+		int indexInCategory = 0, wordIndex = 0, value = 0;
+
+		for (wordIndex = 0; wordIndex < numWords; wordIndex++) {
+			state->seenOnce[wordIndex] = 0;
+			state->seenTwice[wordIndex] = 0;
+		}
+
+		for (indexInCategory = 0; indexInCategory < MN; indexInCategory++)
+			if (isBoardCellEmpty(&(state->board->cells[categoryCells[indexInCategory]]))) {
+				getPresolveCellCandidates(state, categoryCells[indexInCategory]);
+				for (wordIndex = 0; wordIndex < numWords; wordIndex++) {
+					state->seenTwice[wordIndex] |= state->seenOnce[wordIndex] & state->candidates[wordIndex];
+					state->seenOnce[wordIndex] |= state->candidates[wordIndex];
+				}
+			}
+
+		for (wordIndex = 0; wordIndex < numWords; wordIndex++) {
+			if (state->allValues[wordIndex] & ~usedValues[wordIndex] & ~state->seenOnce[wordIndex])
+				return PRESOLVE_BOARD_BOARD_ISNT_SOLVABLE;
+			state->seenOnce[wordIndex] &= ~state->seenTwice[wordIndex];
+		}
+
+		/* Note: a cell which is the only place of two values is left to the next pass to fail on */
+		value = getNextValueInCandidateSet(state->seenOnce, numWords, EMPTY_CELL_VALUE);
+		while (value != EMPTY_CELL_VALUE) {
+			for (indexInCategory = 0; indexInCategory < MN; indexInCategory++) {
+				int cell = categoryCells[indexInCategory];
+				if (isBoardCellEmpty(&(state->board->cells[cell]))) {
+					getPresolveCellCandidates(state, cell);
+					if (isValueInCandidateSet(state->candidates, value)) {
+						placePresolveValue(state, cell, value);
+						*hasPlacedOut = true;
+						break;
+					}
+				}
+			}
+			value = getNextValueInCandidateSet(state->seenOnce, numWords, value);
+		}
+	}
+
+	return PRESOLVE_BOARD_SUCCESS;
+}
+
+presolveBoardErrorCode presolveBoard(Board* board) {
+	presolveBoardErrorCode retVal = PRESOLVE_BOARD_SUCCESS;
+
+	PresolveState state = {0};
+	bool hasPlaced = true;
+
+	if (!createPresolveState(board, &state))
+		return PRESOLVE_BOARD_MEMORY_ALLOCATION_FAILURE;
+
+	if (markPresolveGivenValues(&state))
+		while ((retVal == PRESOLVE_BOARD_SUCCESS) && hasPlaced) {
+			int category = 0;
+			hasPlaced = false;
+			retVal = placeNakedSingles(&state, &hasPlaced);
+			for (category = 0; (retVal == PRESOLVE_BOARD_SUCCESS) && (category < BOARD_NUM_CATEGORIES); category++)
+				retVal = placeHiddenSingles(&state, (BoardCategory)category, &hasPlaced);
+		}
+
+	freePresolveState(&state);
+
+	return retVal;
+}
+
+/**
+ * getIndexOfSpecificLegalValueOfCertainCell get the index (in the list of variables created in the Gurobi model)
+ * 											 of a certain legal value of a certain cell
+ *
+ * @param row						[in] the cell's row
+ * @param col						[in] the cell's column
+ * @param value						[in] the legal value for the cell in (row, col)
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ *
+ * @return int	the sought after index, or -1 if cell (row, col) in relevant board isn't empty or if value isn't
+ * 				legal for the cell.
+ */
+int getIndexOfSpecificLegalValueOfCertainCell(int row, int col, int value, const VariablesMap* variablesMap) {
+	int MN = variablesMap->MN;
+
+	return variablesMap->cellsValuesVariables[(row * MN + col) * MN + value - 1] - 1; /* Note: 0 (i.e., no variable) becomes -1 */
+}
+
+void freeModelConstraints(ModelConstraints* constraints) {
+	free(constraints->beg);
+	free(constraints->ind);
+	free(constraints->val);
+	free(constraints->rhs);
+}
+
+/**
+ * allocateModelConstraints allocates room for the constraints of a model. Each cell and each
+ * value of each row, column and block yields at most one constraint, and each variable belongs
+ * to exactly four of them (its cell's, and those of its value in the cell's row, column and block).
+ *
+ * @param constraints	[out] the constraints to allocate
+ * @param board			[in] the board to be solved
+ * @param numVars		[in] the number of variables in the model
+ *
+ * @return bool			true when succeeds, false otherwise (due to memory allocation failure)
+ */
+bool allocateModelConstraints(ModelConstraints* constraints, const Board* board, int numVars) {
+	int maxNumConstrs = 4 * getBoardSize_MN2(board);
+	int maxNumNonZeros = 4 * numVars;
+
+	constraints->numConstrs = 0;
+	constraints->numNonZeros = 0;
+	constraints->beg = calloc(maxNumConstrs + 1, sizeof(int));
+	constraints->ind = calloc(maxNumNonZeros + 1, sizeof(int));
+	constraints->val = calloc(maxNumNonZeros + 1, sizeof(double));
+	constraints->rhs = calloc(maxNumConstrs + 1, sizeof(double));
+	if ((constraints->beg == NULL) || (constraints->ind == NULL) || (constraints->val == NULL) || (constraints->rhs == NULL)) {
+		freeModelConstraints(constraints);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * appendVariableToConstraint appends a variable, with a coefficient of 1.0, to the constraint
+ * being assembled at the end of constraints (i.e., the one to be closed by closeConstraint).
+ *
+ * @param constraints	[in, out] the constraints
+ * @param index			[in] the index of the variable
+ *
+ * @return void
+ */
+void appendVariableToConstraint(ModelConstraints* constraints, int index) {
+	constraints->ind[constraints->numNonZeros] = index;
+	constraints->val[constraints->numNonZeros] = 1.0;
+	constraints->numNonZeros++;
+}
+
+/**
+ * closeConstraint closes the constraint being assembled at the end of constraints, requiring its
+ * variables to together amount to exactly 1.0. A constraint with no variables is dropped.
+ *
+ * @param constraints	[in, out] the constraints
+ *
+ * @return void
+ */
+void closeConstraint(ModelConstraints* constraints) {
+	int begin = constraints->beg[constraints->numConstrs];
+
+	if (constraints->numNonZeros == begin)
+		return;
+
+	constraints->rhs[constraints->numConstrs] = 1.0;
+	constraints->numConstrs++;
+	constraints->beg[constraints->numConstrs] = constraints->numNonZeros;
+}
+
+/**
+ * addCellConstraints adds the constraint pertaining to a cell (of the board to solve) to the model's constraints.
+ * Constraint: all variables of a certain cell must together amount to exactly 1.0.
+ *
+ * @param constraints				[in, out] the constraints of the model
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ * @param cell						[in] the cell's index (i.e., row * MN + col)
+ *
+ * @return void
+ */
+void addCellConstraints(ModelConstraints* constraints, const VariablesMap* variablesMap, int cell) {
+	int var = 0;
+	for (var = variablesMap->cellsFirstVariable[cell]; var < variablesMap->cellsFirstVariable[cell + 1]; var++)
+		appendVariableToConstraint(constraints, var);
+
+	closeConstraint(constraints);
+}
+
+/**
+ * addCellsConstraints adds constraints pertaining to all cells (of the board to solve) to the model's constraints
+ *
+ * @param constraints				[in, out] the constraints of the model
+ * @param board						[in] the board to be solved
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ *
+ * @return void
+ */
+void addCellsConstraints(ModelConstraints* constraints, const Board* board, const VariablesMap* variablesMap) {
+	int MN2 = getBoardSize_MN2(board);
+	int cell = 0;
+	for (cell = 0; cell < MN2; cell++)
+		addCellConstraints(constraints, variablesMap, cell);
+}
+
+/**
+ * addCategoryInstanceValueConstraints adds the constraint pertaining to a certain value in a certain instance
+ * 									   of a certain category (of the board to solve) to the model's constraints.
+ * Constraint: all variables of a certain value in a certain instance of a certain category must together
+ * 			   amount to exactly 1.0.
+ *
+ * @param constraints				[in, out] the constraints of the model
+ * @param board						[in] the board to be solved
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ * @param categoryNo				[in] no. of category
+ * @param value						[in] the value
+ * @param getRowBasedIDfunc			[in] a function translating category-based cell ID to row-based cell ID
+ *
+ * @return void
+ */
+void addCategoryInstanceValueConstraints(ModelConstraints* constraints, const Board* board, const VariablesMap* variablesMap, int categoryNo, int value, getCategory1BasedIDByCategory2BasedIDFunc getRowBasedIDfunc) {
+	int MN = getBoardBlockSize_MN(board);
+
+	int indexInCategory = 0;
+	for (indexInCategory = 0; indexInCategory < MN; indexInCategory++) {
+		int row = 0, col = 0;
+		int index = 0;
+		getRowBasedIDfunc(board, categoryNo, indexInCategory, &row, &col);
+		index = getIndexOfSpecificLegalValueOfCertainCell(row, col, value, variablesMap);
+		if (index >= 0)
+			appendVariableToConstraint(constraints, index);
+	}
+
+	closeConstraint(constraints);
+}
+
+/**
+ * addCategoryConstraints adds constraints pertaining to a certain category (of the board to solve)
+ * 						  to the model's constraints, for each of its instances and each value
+ *
+ * @param constraints				[in, out] the constraints of the model
+ * @param board						[in] the board to be solved
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ * @param getRowBasedIDfunc			[in] a function translating category-based cell ID to row-based cell ID
+ *
+ * @return void
+ */
+void addCategoryConstraints(ModelConstraints* constraints, const Board* board, const VariablesMap* variablesMap, getCategory1BasedIDByCategory2BasedIDFunc getRowBasedIDfunc) {
+	int MN = getBoardBlockSize_MN(board);
+
+	int categoryNo = 0;
+	for (categoryNo = 0; categoryNo < MN; categoryNo++) {
+		int value = 1;
+		for (value = 1; value <= MN; value++)
+			addCategoryInstanceValueConstraints(constraints, board, variablesMap, categoryNo, value, getRowBasedIDfunc);
+	}
+}
+
+bool buildModelConstraints(ModelConstraints* constraintsOut, const Board* board, const VariablesMap* variablesMap) {
+	if (!allocateModelConstraints(constraintsOut, board, variablesMap->numVars))
+		return false;
+
+	addCellsConstraints(constraintsOut, board, variablesMap);
+	addCategoryConstraints(constraintsOut, board, variablesMap, getRowBasedIDGivenRowBasedID);
+	addCategoryConstraints(constraintsOut, board, variablesMap, getRowBasedIDGivenColumnBasedID);
+	addCategoryConstraints(constraintsOut, board, variablesMap, getRowBasedIDGivenBlockBasedID);
+
+	return true;
+}
+
+double getRandomObjectiveCoefficient(const Board* board) {
+	int MN = getBoardBlockSize_MN(board);
+
+	return (rand() % (MN * MN)) + 1; /* Note: this factor (MN^2) seems to be effective */
+}
+
+void applySolutionToBoard(double* sol, const VariablesMap* variablesMap, Board* boardSolution) {
+	int MN = getBoardBlockSize_MN(boardSolution);
+	int MN2 = getBoardSize_MN2(boardSolution);
+
+	int cell = 0;
+	for (cell = 0; cell < MN2; cell++) {
+		int var = 0;
+		for (var = variablesMap->cellsFirstVariable[cell]; var < variablesMap->cellsFirstVariable[cell + 1]; var++)
+			if (sol[var] == 1.0) {
+				setBoardCellValue(boardSolution, cell / MN, cell % MN, variablesMap->variablesValues[var]);
+				break;
+			}
+	}
+}
+
+void applySolutionToValuesScoresArray(double* sol, const VariablesMap* variablesMap, const Board* board, double*** allCellsValuesScores) {
+	int MN = getBoardBlockSize_MN(board);
+	int MN2 = getBoardSize_MN2(board);
+
+	int cell = 0;
+	for (cell = 0; cell < MN2; cell++) {
+		if (isBoardCellEmpty(&(board->cells[cell]))) {
+			double* cellValuesScores = allCellsValuesScores[cell / MN][cell % MN];
+			int value = 1, var = 0;
+
+			for (value = 1; value <= MN; value++)
+				cellValuesScores[value] = 0;
+
+			for (var = variablesMap->cellsFirstVariable[cell]; var < variablesMap->cellsFirstVariable[cell + 1]; var++)
+				cellValuesScores[variablesMap->variablesValues[var]] = sol[var];
+		}
+	}
+}
+
+void applyPresolvedBoardToValuesScoresArray(const Board* board, const Board* presolvedBoard, double*** allCellsValuesScores) {
+	int MN = getBoardBlockSize_MN(board);
+	int MN2 = getBoardSize_MN2(board);
+
+	int cell = 0;
+	for (cell = 0; cell < MN2; cell++) {
+		if (isBoardCellEmpty(&(board->cells[cell])) && !isBoardCellEmpty(&(presolvedBoard->cells[cell]))) {
+			double* cellValuesScores = allCellsValuesScores[cell / MN][cell % MN];
+			int value = 1;
+
+			for (value = 1; value <= MN; value++)
+				cellValuesScores[value] = 0;
+
+			cellValuesScores[getBoardCellValue(&(presolvedBoard->cells[cell]))] = 1.0;
+		}
+	}
+}
+
+void freeValuesScoresArr(double*** valuesScores, const Board* board) {
+	int MN = getBoardBlockSize_MN(board);
+
+	if (valuesScores != NULL) {
+		int row = 0;
+		for (row = 0; row < MN; row++) {
+			if (valuesScores[row] != NULL) {
+				int col = 0;
+				for (col = 0; col < MN; col++) {
+					if (valuesScores[row][col] != NULL) {
+						free(valuesScores[row][col]);
+						valuesScores[row][col] = NULL;
+					}
+				}
+				free(valuesScores[row]);
+				valuesScores[row] = NULL;
+			}
+		}
+		free(valuesScores);
+	}
+}
+
+bool allocateValuesScoresArr(double**** valuesScoresOut, const Board* board) {
+	int MN = getBoardBlockSize_MN(board);
+
+	bool success = true;
+
+	double*** valuesScores = NULL;
+	valuesScores = calloc(MN, sizeof(double**));
+	if (valuesScores == NULL)
+		success = false;
+	else {
+		int row = 0;
+		for (row = 0; row < MN; row++) {
+			valuesScores[row] = calloc(MN, sizeof(double*));
+			if (valuesScores[row] == NULL) {
+				success = false;
+				break;
+			} else {
+				int col = 0;
+				for (col = 0; col < MN; col++) {
+					if (isBoardCellEmpty(viewBoardCellByRow(board, row, col))) {
+						valuesScores[row][col] = calloc(MN + 1, sizeof(double));
+						if (valuesScores[row][col] == NULL) {
+							success = false;
+							break;
+						}
+					}
+					if (!success)
+						break;
+				}
+			}
+
+		}
+	}
+
+	if (!success) {
+		freeValuesScoresArr(valuesScores, board);
+		return false;
+	}
+	else {
+		*valuesScoresOut = valuesScores;
+		return true;
+	}
+
+}
@@ -0,0 +1,178 @@
+/**
+ * LP_MODEL Summary:
+ *
+ * A module designed to build the mathematical model of a sudoku board to be solved by means of Linear
+ * Programming, independently of the solver the model is then handed to (be it Gurobi, in LP_solver.c,
+ * or the in-tree sparse LP solver of builds without Gurobi, in LP_solver_local.c).
+ *
+ * Each empty cell of the board is represented by a chain of variables, one per legal value of the cell.
+ * The constraints require the variables of each cell, and those of each value in each row, column and
+ * block, to together amount to exactly 1.0. Before the model is built, the board is presolved, so that
+ * the model need only be built for the cells whose values aren't forced.
+ *
+ * createVariablesMap - maps the variables of a model to the legal values of the empty cells of a board
+ * freeVariablesMap - frees a map created by createVariablesMap
+ * presolveBoard - fills in the cells of a board whose values are forced
+ * buildModelConstraints - builds the constraints of a model, in compressed sparse rows
+ * freeModelConstraints - frees constraints built by buildModelConstraints
+ * getRandomObjectiveCoefficient - gets a coefficient for a variable in the objective of an LP model
+ * applySolutionToBoard - applies the solution of an ILP model to a board
+ * applySolutionToValuesScoresArray - applies the solution of an LP model to a values scores array
+ * applyPresolvedBoardToValuesScoresArray - applies the values placed by presolveBoard to a values scores array
+ */
+
+#ifndef LP_MODEL_H_
+#define LP_MODEL_H_
+
+#include <stdbool.h>
+
+#include "board.h"
+
+/**
+ * VariablesMap struct maps the variables of a model to the legal values of the empty cells of the
+ * board to solve. Each empty cell has a variable per legal value, numbered cell after cell (in
+ * row-major order) and value after value: the variables of cell i (i.e., row * MN + col) are
+ * cellsFirstVariable[i] to cellsFirstVariable[i + 1] - 1, and variablesValues holds the value of
+ * each variable. Conversely, cellsValuesVariables[i * MN + value - 1] holds one plus the variable
+ * of value in cell i, or 0 if there is none (because the cell isn't empty or value isn't legal for it).
+ */
+typedef struct {
+	int MN;
+	int numVars;
+	int* cellsFirstVariable;
+	int* variablesValues;
+	int* cellsValuesVariables;
+} VariablesMap;
+
+/**
+ * createVariablesMap creates the map of the variables of a model for the given board, in a single pass
+ * 					  over the candidate sets of legal values of its cells.
+ *
+ * @param board						[in] the board to be solved
+ * @param variablesMapOut			[out] the map to fill. It must later be freed using freeVariablesMap.
+ * @param isThereUnsolvableCellOut	[out] a boolean variable indicating whether there is a cell which causes
+ *										  the board to be unsolvable because there is no legal value for it.
+ *
+ * @return bool						true when succeeds, false otherwise (due to memory allocation failure)
+ */
+bool createVariablesMap(const Board* board, VariablesMap* variablesMapOut, bool* isThereUnsolvableCellOut);
+
+/**
+ * freeVariablesMap frees the arrays of a VariablesMap gotten from createVariablesMap
+ *
+ * @param variablesMap	[in] the map to free
+ *
+ * @return void
+ */
+void freeVariablesMap(VariablesMap* variablesMap);
+
+typedef enum {
+	PRESOLVE_BOARD_SUCCESS,
+	PRESOLVE_BOARD_MEMORY_ALLOCATION_FAILURE,
+	PRESOLVE_BOARD_BOARD_ISNT_SOLVABLE
+} presolveBoardErrorCode;
+
+/**
+ * presolveBoard fills in the cells of a board whose values are forced, by placing naked singles (cells
+ * 				 with a single candidate) and hidden singles (values with a single place in a row, column
+ * 				 or block) until there are none left. The values it places are those any solution of the
+ * 				 model built for the board would assign, so that the model need only be built for the
+ * 				 cells left empty. Boards in which a value appears twice in the same row, column or block
+ * 				 are left as they are.
+ *
+ * @param board		[in, out] the board to presolve
+ *
+ * @return presolveBoardErrorCode	an error code is returned, specifying whether the board was presolved,
+ * 									was found to be unsolvable, or that an error has occurred
+ */
+presolveBoardErrorCode presolveBoard(Board* board);
+
+/**
+ * ModelConstraints struct holds the constraints of a model in compressed sparse rows, as
+ * GRBaddconstrs takes them: the indices and coefficients of the variables of constraint i are
+ * at positions beg[i] to beg[i + 1] - 1 of ind and val (beg having numConstrs + 1 entries, the
+ * last of which is numNonZeros). All our constraints are equalities whose right-hand side is 1.0,
+ * and so is rhs.
+ */
+typedef struct {
+	int numConstrs;
+	int numNonZeros;
+	int* beg;
+	int* ind;
+	double* val;
+	double* rhs;
+} ModelConstraints;
+
+/**
+ * buildModelConstraints builds the constraints of a model: those of each cell, and those of each
+ * 						 value in each row, column and block. Constraints with no variables are dropped.
+ *
+ * @param constraintsOut	[out] the constraints to build. They must later be freed using freeModelConstraints.
+ * @param board				[in] the board to be solved
+ * @param variablesMap		[in] the map of the variables of the model (gotten via createVariablesMap)
+ *
+ * @return bool				true when succeeds, false otherwise (due to memory allocation failure)
+ */
+bool buildModelConstraints(ModelConstraints* constraintsOut, const Board* board, const VariablesMap* variablesMap);
+
+/**
+ * freeModelConstraints frees the arrays of a ModelConstraints struct.
+ *
+ * @param constraints	[in] the constraints to free
+ *
+ * @return void
+ */
+void freeModelConstraints(ModelConstraints* constraints);
+
+/**
+ * getRandomObjectiveCoefficient gets a random coefficient for a variable in the objective of an LP model,
+ * 								 which is maximized. Random coefficients lead the solver to one optimal point
+ * 								 or other, so that the scores of the values of each cell differ from call to call.
+ *
+ * @param board		[in] the board to be solved
+ *
+ * @return double	a whole number between 1 and MN^2
+ */
+double getRandomObjectiveCoefficient(const Board* board);
+
+/**
+ * applySolutionToBoard applies the solution of an ILP model to a board, scanning the variables of each
+ * 						empty cell for the one set in the solution.
+ *
+ * @param sol						[in] an array containing the values for each of the variables in the model
+ * 										 (constituting the solution of the model)
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ * @param boardSolution				[in, out] the board to which to apply the found solution
+ *
+ * @return void
+ */
+void applySolutionToBoard(double* sol, const VariablesMap* variablesMap, Board* boardSolution);
+
+/**
+ * applySolutionToValuesScoresArray applies the solution of an LP model to a values scores array, scanning
+ * 									the variables of each empty cell (values which aren't legal for the
+ * 									cell score 0).
+ *
+ * @param sol						[in] an array containing the values for each of the variables in the model
+ * 										 (constituting the solution of the model)
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ * @param board						[in] the board that was to be solved
+ * @param allCellsValuesScores		[in, out] the values scores array
+ *
+ * @return void
+ */
+void applySolutionToValuesScoresArray(double* sol, const VariablesMap* variablesMap, const Board* board, double*** allCellsValuesScores);
+
+/**
+ * applyPresolvedBoardToValuesScoresArray	applies the values placed by presolveBoard to a values scores array:
+ * 											the value placed in a cell scores 1.0, and the others 0.
+ *
+ * @param board						[in] the board that was to be solved
+ * @param presolvedBoard			[in] the board after presolveBoard
+ * @param allCellsValuesScores		[in, out] the values scores array
+ *
+ * @return void
+ */
+void applyPresolvedBoardToValuesScoresArray(const Board* board, const Board* presolvedBoard, double*** allCellsValuesScores);
+
+#endif /* LP_MODEL_H_ */
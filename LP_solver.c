@@ -16,192 +16,45 @@
  * and constraints relevant to each row, column and block).
  * The module is designed to have as little as possible variables in the mathematical model, for
  * efficiency's sake and so that Gurobi will have an easier time solving our models. To achieve this
- * end, we use all sorts of index manipulations (which can be found in the functions below).
+ * end, we use all sorts of index manipulations (which can be found in LP_model.c, where the model is
+ * built independently of Gurobi, so that builds without Gurobi may solve it with an in-tree solver).
  *
  * Needless to say, but the variables for an ILP model are integers, and in an our implementation
  * they are even more strictly limited to be binary (indicators, of whether a certain value is to be
  * filled in the respective cell); for the LP model, however, each variable can contain any real
  * number between 0.0 and 1.0, and thus the output scores for the values of each cell can be seen
  * as representing (to some extent) a probability distribution of the different values for each cell.
+ *
+ * Before any model is built, the board is presolved: the cells whose values are forced (naked and
+ * hidden singles) are filled in, over and over until there are none left, so that the model is only
+ * built for the cells left empty, if any. A board found to be unsolvable on the way needs no model at all.
+ *
+ * Loading a Gurobi environment involves checking its licence, and costs far more than most of our
+ * models take to solve. Hence, a single environment is loaded on first use and kept for the rest
+ * of the process, and so is the model last solved, which is emptied and refilled by the next call
+ * rather than freed. Both are freed by cleanupLinearProgramming.
  */
 
 #include <stdlib.h>
 
 #include "LP_solver.h"
+#include "LP_model.h"
 
 #include "gurobi_c.h"
 
 #define UNUSED(x) (void)(x)
 
-
 /**
- * freeIntAndIndexBasedLegalValuesForAllCells frees an array acquired from getLegalValuesForAllCells
- *
- * @param board						[in] the board that was passed to getLegalValuesForAllCells
- * @param cellLegalValuesIntBased	[in] the array gotten from getLegalValuesForAllCells
- *
- * @return void
+ * The GRB environment shared by all calls to solveBoardUsingLinearProgramming, or NULL if it
+ * has yet to be loaded.
  */
-void freeIntAndIndexBasedLegalValuesForAllCells(const Board* board, int*** cellLegalValuesIntBased) {
-	int MN = getBoardBlockSize_MN(board);
-
-	if (cellLegalValuesIntBased != NULL) {
-		int row = 0;
-		for (row = 0; row < MN; row++) {
-			if (cellLegalValuesIntBased[row] != NULL) {
-				int col = 0;
-				for (col = 0; col < MN; col++) {
-					if (cellLegalValuesIntBased[row][col] != NULL) {
-						free(cellLegalValuesIntBased[row][col]);
-						cellLegalValuesIntBased[row][col] = NULL;
-					}
-				}
-				free(cellLegalValuesIntBased[row]);
-				cellLegalValuesIntBased[row] = NULL;
-			}
-		}
-		free(cellLegalValuesIntBased);
-	}
-}
+GRBenv* sharedGRBEnvironment = NULL;
 
 /**
- * convertBooleanBasedLegalValuesForAllCellsToIntAndIndexBased creates an int-based array of legal values for
- *  														   all cells, given a CellLegalValues based array.
- *
- * @param board							[in] the board for which the said arrays are relevant
- * @param cellsLegalValues				[in] an array of CellLegalValues for each of the board's cells
- * @param cellLegalValuesIntBasedOut	[out] a pointer to put the legal values array in. The structure of the
- * 											  array (given that the function has succeeded is):
- * 											  array[row][col][value] = num, where if value>0 and num>0 then
- * 											  value is legal for cell (row, col) in board, and all such positive
- * 											  nums form an oredered sequence (1, 2, 3, ..., numLegalValues); if
- * 											  value=0 then num represented the number of legal values for cell
- * 											  (row, col).
- * @param isThereUnsolvableCellOut		[out] a boolean variable indicating whether there is a cell which causes
- *											  the board to be unsolvable because there is no legal value for it.
- *
- * @return bool							true when succeeds, false otherwise (due to memory allocation failure)
+ * The GRB model last solved in sharedGRBEnvironment, kept to be recycled by the next call, or
+ * NULL if there is none.
  */
-bool convertBooleanBasedLegalValuesForAllCellsToIntAndIndexBased(const Board* board, CellLegalValues** cellsLegalValues, int**** cellLegalValuesIntBasedOut, bool* isThereUnsolvableCellOut) {
-	bool retValue = true;
-	int*** cellLegalValuesIntBased = NULL;
-
-	int MN = getBoardBlockSize_MN(board);
-	cellLegalValuesIntBased = calloc(MN, sizeof(int**));
-	if (cellLegalValuesIntBased == NULL)
-		retValue = false;
-	else {
-		int row = 0;
-		for (row = 0; row < MN; row++) {
-			cellLegalValuesIntBased[row] = calloc(MN, sizeof(int*));
-			if (cellLegalValuesIntBased[row] == NULL) {
-				retValue = false;
-				break;
-			} else {
-				int col = 0;
-				for (col = 0; col < MN; col++) {
-					if (!isBoardCellEmpty(viewBoardCellByRow(board, row, col)))
-						continue;
-					cellLegalValuesIntBased[row][col] = calloc(MN + 1, sizeof(int)); /* Note: +1 because values are 1-based (the first item will hold the number of legal values) */
-					if (cellLegalValuesIntBased[row][col] == NULL) {
-						retValue = false;
-						break;
-					} else {
-						int value = 1;
-						int legalValueIndex = 0;
-
-						cellLegalValuesIntBased[row][col][0] = cellsLegalValues[row][col].numLegalValues;
-						if (cellLegalValuesIntBased[row][col][0] == 0)
-							*isThereUnsolvableCellOut = true;
-						for (value = 1; value <= MN; value++) {
-							if (cellsLegalValues[row][col].legalValues[value]) {
-								legalValueIndex++;
-								cellLegalValuesIntBased[row][col][value] = legalValueIndex;
-							}
-						}
-					}
-				}
-				if (!retValue)
-					break;
-			}
-		}
-	}
-
-	if (retValue) {
-		*cellLegalValuesIntBasedOut = cellLegalValuesIntBased;
-	} else {
-		freeIntAndIndexBasedLegalValuesForAllCells(board, cellLegalValuesIntBased);
-	}
-
-	return retValue;
-
-}
-
-/**
- * getLegalValuesForAllCells creates an array of the legal values for all cells in the given board
- *
- * @param board						[in] the board for the cells of which to create said array
- * @param cellLegalValuesIntBased	[out] the sough-for array (created using
- * 										  convertBooleanBasedLegalValuesForAllCellsToIntAndIndexBased).
- * 										  It must later be freed using freeIntAndIndexBasedLegalValuesForAllCells.
- * @param isThereUnsolvableCellOut	[out] a boolean variable indicating whether there is a cell which causes
- *										  the board to be unsolvable because there is no legal value for it.
- *
- * @return bool						true when succeeds, false otherwise (due to memory allocation failure)
- */
-bool getLegalValuesForAllCells(const Board* board, int**** cellLegalValuesIntBasedOut, bool* isThereUnsolvableCellOut) {
-	bool retValue = true;
-	CellLegalValues** cellsLegalValues = NULL;
-	int*** cellLegalValuesIntBased = NULL;
-
-	if (!getSuperficiallyLegalValuesForAllBoardCells(board, &cellsLegalValues)) {
-		return false;
-	}
-
-	if (convertBooleanBasedLegalValuesForAllCellsToIntAndIndexBased(board, cellsLegalValues, &cellLegalValuesIntBased, isThereUnsolvableCellOut)) {
-		*cellLegalValuesIntBasedOut = cellLegalValuesIntBased;
-	} else
-		retValue = false;
-
-	freeCellsLegalValuesForAllBoardCells(board, cellsLegalValues);
-
-	return retValue;
-}
-
-/**
- * getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental returns the total number of legal values for all
- * 															 empty cells in the board. It also transforms the
- * 															 list number of legal values for each cell to be
- * 															 incremental, i.e. list (2, 3, 5, 1, 2) is transformed
- * 															 to (0, 2, 5, 10, 11).
- *
- * @param board						[in] the board for which the the legal values array passed via the second
- * 										 parameter was created
- * @param cellLegalValuesIntBased	[in, out] an int-based of legal values for all cells in board, gotten from
- * 										  	  getLegalValuesForAllCells. The list formed by
- * 										  	  cellLegalValuesIntBased[row][col][0] for all empty cells (row, col)
- * 										  	  in board (representing the number of legal values for the cell) is
- * 										  	  transformed to be incremental, as specified above.
- *
- * @return int						the total number of legal values for all empty cells in the board.
- */
-int getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental(const Board* board, int*** cellLegalValuesIntBased) {
-	int totalNumLegalValues = 0;
-	int MN = getBoardBlockSize_MN(board);
-
-	int row = 0, col = 0;
-	for (row = 0; row < MN; row++) {
-		for (col = 0; col < MN; col++) {
-			if (cellLegalValuesIntBased[row][col] != NULL) {
-				int tmpCurNumLegalValues = cellLegalValuesIntBased[row][col][0];
-				cellLegalValuesIntBased[row][col][0] = totalNumLegalValues;
-				totalNumLegalValues += tmpCurNumLegalValues;
-			}
-		}
-	}
-
-	return totalNumLegalValues;
-}
+GRBmodel* recycledGRBModel = NULL;
 
 /**
  * freeGRBEnvironment frees a GRB environment gotten via getNewGRBEnvironment.
@@ -268,6 +121,88 @@ void freeGRBModel(GRBmodel* model) {
 	GRBfreemodel(model);
 }
 
+/**
+ * clearGRBModel removes all the constraints and variables of a GRB model, so that it may be
+ * refilled as if it were new.
+ *
+ * @param model	[in] the GRB model
+ *
+ * @return bool	true when succeeds, false otherwise (due to memory allocation failure or a GRB error)
+ */
+bool clearGRBModel(GRBmodel* model) {
+	bool success = false;
+
+	int numVars = 0, numConstrs = 0;
+	int* ind = NULL;
+
+	if (GRBgetintattr(model, GRB_INT_ATTR_NUMVARS, &numVars) ||
+		GRBgetintattr(model, GRB_INT_ATTR_NUMCONSTRS, &numConstrs))
+		return false;
+
+	ind = calloc((numVars > numConstrs ? numVars : numConstrs) + 1, sizeof(int));
+	if (ind != NULL) {
+		int i = 0;
+		for (i = 0; i < numVars || i < numConstrs; i++)
+			ind[i] = i;
+
+		success = !GRBdelconstrs(model, numConstrs, ind) &&
+				  !GRBdelvars(model, numVars, ind) &&
+				  !GRBupdatemodel(model) &&
+				  !GRBresetmodel(model);
+
+		free(ind);
+	}
+
+	return success;
+}
+
+/**
+ * getSharedGRBEnvironment returns the GRB environment shared by all calls, loading it if this
+ * is the first call (or if loading it has failed so far).
+ *
+ * @return GRBenv*	a pointer to the shared GRB environment, or NULL upon failure.
+ */
+GRBenv* getSharedGRBEnvironment() {
+	if (sharedGRBEnvironment == NULL)
+		sharedGRBEnvironment = getNewGRBEnvironment();
+
+	return sharedGRBEnvironment;
+}
+
+/**
+ * getRecycledGRBModel returns an empty GRB model in the given environment: the model last
+ * solved, emptied, if there is one, and a new one otherwise. The model is kept by this module,
+ * and must not be freed by the caller (see discardRecycledGRBModel).
+ *
+ * @param env	[in] a pointer to the shared GRB environment
+ *
+ * @return GRBmodel*	a pointer to the empty GRB model, or NULL upon failure.
+ */
+GRBmodel* getRecycledGRBModel(GRBenv* env) {
+	if ((recycledGRBModel != NULL) && !clearGRBModel(recycledGRBModel)) {
+		freeGRBModel(recycledGRBModel);
+		recycledGRBModel = NULL;
+	}
+
+	if (recycledGRBModel == NULL)
+		recycledGRBModel = getNewGRBModel(env);
+
+	return recycledGRBModel;
+}
+
+/**
+ * discardRecycledGRBModel frees the GRB model kept for recycling, if any (e.g., after a
+ * GRB error has left it in an unknown state).
+ *
+ * @return void
+ */
+void discardRecycledGRBModel() {
+	if (recycledGRBModel != NULL) {
+		freeGRBModel(recycledGRBModel);
+		recycledGRBModel = NULL;
+	}
+}
+
 typedef enum {
 	ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_SUCCESS,
 	ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_MEMORY_ALLOCATION_FAILURE,
@@ -278,7 +213,8 @@ typedef enum {
 
 /**
  * addVariablesAndObjectiveFunctionToModel add variables to a GRB model and sets its objective.
- * The variables are binary when in ILP mode, and continuous when in LP mode.
+ * The variables are binary when in ILP mode, and continuous when in LP mode, in which case they
+ * are bounded to the range [0.0, 1.0] (by their bounds, rather than by constraints).
  *
  * @param env			[in] a pointer to the GRB environment of the model.
  * @param model			[in] the GRB model
@@ -293,19 +229,17 @@ typedef enum {
 addVariablesAndObjectiveFunctionToModelErrorCode addVariablesAndObjectiveFunctionToModel(GRBenv* env, GRBmodel* model, int numVars, const Board* board, solveBoardUsingLinearProgrammingSolvingMode solvingMode) {
 	addVariablesAndObjectiveFunctionToModelErrorCode retVal = ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_SUCCESS;
 
-	int MN = 0;
-
 	double* obj = NULL;
+	double* ub = NULL;
 	char* vtype = NULL;
 
 	UNUSED(env);
 
-	if (board != NULL)
-		MN = getBoardBlockSize_MN(board);
-
 	obj = calloc(numVars, sizeof(double));
 	vtype = calloc(numVars, sizeof(char));
-	if ((obj == NULL) || (vtype == NULL))
+	if (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_LP)
+		ub = calloc(numVars, sizeof(double));
+	if ((obj == NULL) || (vtype == NULL) || ((solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_LP) && (ub == NULL)))
 		retVal = ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_MEMORY_ALLOCATION_FAILURE;
 	else {
 		int error = 0;
@@ -317,11 +251,12 @@ addVariablesAndObjectiveFunctionToModelErrorCode addVariablesAndObjectiveFunctio
 				vtype[i] = GRB_BINARY;
 			}
 			else if (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_LP) {
-				obj[i] = (rand() % (MN * MN)) + 1; /* Note: this factor (MN^2) seems to be effective */
+				obj[i] = getRandomObjectiveCoefficient(board);
+				ub[i] = 1.0;
 				vtype[i] = GRB_CONTINUOUS;
 			}
 
-		error = GRBaddvars(model, numVars, 0, NULL, NULL, NULL, obj, NULL, NULL, vtype, NULL);
+		error = GRBaddvars(model, numVars, 0, NULL, NULL, NULL, obj, NULL, ub, vtype, NULL); /* Note: lower bounds default to 0.0 */
 		if (!error) {
 			error = GRBsetintattr(model, GRB_INT_ATTR_MODELSENSE, GRB_MAXIMIZE);
 			if (!error) {
@@ -338,43 +273,14 @@ addVariablesAndObjectiveFunctionToModelErrorCode addVariablesAndObjectiveFunctio
 
 	if (obj != NULL)
 		free(obj);
+	if (ub != NULL)
+		free(ub);
 	if (vtype != NULL)
 		free(vtype);
 
 	return retVal;
 }
 
-/**
- * getIndexOfSpecificLegalValueOfCertainCell get the index (in the list of variables created in the Gurobi model)
- * 											 of a certain legal value of a certain cell
- *
- * @param row						[in] the cell's row
- * @param col						[in] the cell's column
- * @param value						[in] the legal value for the cell in (row, col)
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells, and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- *
- * @return int	the sought after index, or -1 if cell (row, col) in relevant board isn't empty or if value isn't
- * 				legal for the cell.
- */
-int getIndexOfSpecificLegalValueOfCertainCell(int row, int col, int value, int*** cellLegalValuesIntBased) {
-	int baseIndex = 0;
-	int relativeIndex = 0;
-
-	if (cellLegalValuesIntBased[row][col] == NULL)
-		return -1;
-
-	relativeIndex = cellLegalValuesIntBased[row][col][value];
-	if (relativeIndex <= 0)
-		return -1;
-
-	relativeIndex--; /* Note: this is required in current implementation (because relative indices originally start at 1 in cellLegalValuesIntBased)*/
-
-	baseIndex = cellLegalValuesIntBased[row][col][0];
-	return baseIndex + relativeIndex;
-}
-
 typedef enum {
 	ADD_CONSTRAINTS_FUNCS_SUCCESS,
 	ADD_CONSTRAINTS_FUNCS_MEMORY_ALLOCATION_FAILURE,
@@ -382,304 +288,49 @@ typedef enum {
 } addConstraintsFuncsErrorCode;
 
 /**
- * addCellConstraints adds constraints pertaining to a cell (of the board to solve) to the Gurobi model.
- * Constraints: - all variables of a certain cell must together amount to exactly 1.0.
- * 				- (in LP) each variable pertaining to a certain value must be in the range [0.0, 1.0].
- *
+ * addSudokuConstraints 	adds sudoku constraints (based on the board to solve)
+ * 						 	to the Gurobi model (i.e.: cell, row, column, block).
+ * 						 	The constraints are assembled in compressed sparse rows, and
+ * 						 	submitted to Gurobi with a single call.
  *
  * @param env						[in] a pointer to the GRB environment of the model.
  * @param model						[in] the GRB model
  * @param board						[in] the board to be solved
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param row						[in] the cells' row
- * @param col						[in] the cell's column
- * @param solvingMode				[in] the solving mode (ILP or LP)
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
  *
  * @return addConstraintsFuncsErrorCode		an error code is returned, specifying whether the constraints
- * 											were added, or else	that an error has occurred
+ * 											ware added, or else	that an error has occurred
  */
-addConstraintsFuncsErrorCode addCellConstraints(GRBenv* env, GRBmodel* model, const Board* board, int numVars, int*** cellLegalValuesIntBased, int row, int col, solveBoardUsingLinearProgrammingSolvingMode solvingMode) {
+addConstraintsFuncsErrorCode addSudokuConstraints(GRBenv* env, GRBmodel* model, const Board* board, const VariablesMap* variablesMap) {
 	addConstraintsFuncsErrorCode retVal = ADD_CONSTRAINTS_FUNCS_SUCCESS;
 
-	int* ind = NULL;
-	double* val = NULL;
-
-	int MN = getBoardBlockSize_MN(board);
+	ModelConstraints constraints = {0};
+	char* sense = NULL;
 
 	UNUSED(env);
-	UNUSED(numVars);
 
-	ind = calloc(MN, sizeof(int));
-	val = calloc(MN, sizeof(double));
+	if (!buildModelConstraints(&constraints, board, variablesMap))
+		return ADD_CONSTRAINTS_FUNCS_MEMORY_ALLOCATION_FAILURE;
 
-	if ((ind == NULL) || (val == NULL))
+	sense = calloc(constraints.numConstrs + 1, sizeof(char));
+	if (sense == NULL)
 		retVal = ADD_CONSTRAINTS_FUNCS_MEMORY_ALLOCATION_FAILURE;
 	else {
-		int numLegalValues = 0;
-
-		int value = 1;
-		for (value = 1; value <= MN; value++) {
-			int index = getIndexOfSpecificLegalValueOfCertainCell(row, col, value, cellLegalValuesIntBased);
-			if (index >= 0) {
-
-				if (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_LP) {
-					int error1 = 0, error2 = 0;
-					double coefficient = 1;
-					error1 = GRBaddconstr(model, 1, &index, &coefficient, GRB_LESS_EQUAL, 1.0, NULL);
-					error2 = GRBaddconstr(model, 1, &index, &coefficient, GRB_GREATER_EQUAL, 0.0, NULL);
-					if (error1 || error2)
-						retVal = ADD_CONSTRAINTS_FUNCS_GRB_COULD_NOT_ADD_CONSTRAINT;
-				}
-
-				ind[numLegalValues] = index;
-				val[numLegalValues] = 1;
-				numLegalValues++;
-			}
-		}
+		int constr = 0;
+		for (constr = 0; constr < constraints.numConstrs; constr++)
+			sense[constr] = GRB_EQUAL;
 
-		if (numLegalValues > 0) {
-			int error1 = 0, error2 = 0;
-			error1 = GRBaddconstr(model, numLegalValues, ind, val, GRB_LESS_EQUAL, 1.0, NULL);
-			error2 = GRBaddconstr(model, numLegalValues, ind, val, GRB_GREATER_EQUAL, 1.0, NULL);
-			if (error1 || error2)
-				  retVal = ADD_CONSTRAINTS_FUNCS_GRB_COULD_NOT_ADD_CONSTRAINT;
-		}
+		if (GRBaddconstrs(model, constraints.numConstrs, constraints.numNonZeros, constraints.beg, constraints.ind, constraints.val, sense, constraints.rhs, NULL))
+			retVal = ADD_CONSTRAINTS_FUNCS_GRB_COULD_NOT_ADD_CONSTRAINT;
 
+		free(sense);
 	}
 
-	if (val != NULL) {
-		free(val);
-		val = NULL;
-	}
-	if (ind != NULL) {
-		free(ind);
-		ind = NULL;
-	}
+	freeModelConstraints(&constraints);
 
 	return retVal;
 }
 
-/**
- * addCellsConstraints adds constraints pertaining to all cells (of the board to solve) to the Gurobi model
- *
- * @param env						[in] a pointer to the GRB environment of the model.
- * @param model						[in] the GRB model
- * @param board						[in] the board to be solved
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param solvingMode				[in] the solving mode (ILP or LP)
- *
- * @return addConstraintsFuncsErrorCode		an error code is returned, specifying whether the constraints
- * 											were added, or else	that an error has occurred
- */
-addConstraintsFuncsErrorCode addCellsConstraints(GRBenv* env, GRBmodel* model, const Board* board, int numVars, int*** cellLegalValuesIntBased, solveBoardUsingLinearProgrammingSolvingMode solvingMode) {
-	int MN = getBoardBlockSize_MN(board);
-	int row = 0, col = 0;
-	for (row = 0; row < MN; row++)
-		for (col = 0; col < MN; col++) {
-			addConstraintsFuncsErrorCode retVal = addCellConstraints(env, model, board, numVars, cellLegalValuesIntBased, row, col, solvingMode);
-			if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-				return retVal;
-		}
-	return ADD_CONSTRAINTS_FUNCS_SUCCESS;
-}
-
-/**
- * addCategoryInstanceValueConstraints adds constraints pertaining to a certain value in a certain instance
- * 									   of a certain category (of the board to solve) to the Gurobi model.
- * Constraints: - all variables of a certain value in a certain instance of a certain category must together
- * 				  amount to exactly 1.0.
- *
- * @param env							[in] a pointer to the GRB environment of the model.
- * @param model						[in] the GRB model
- * @param board						[in] the board to be solved
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 								 getLegalValuesForAllCells and transformed via
- * 																		 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param categoryNo				[in] no. of category
- * @param value							[in] the value
- * @param getRowBasedIDfunc			[in] a function translating category-based cell ID to row-based cell ID
- *
- * @return addConstraintsFuncsErrorCode		an error code is returned, specifying whether the constraints
- * 																				were added, or else	that an error has occurred
- */
-addConstraintsFuncsErrorCode addCategoryInstanceValueConstraints(GRBenv* env, GRBmodel* model, const Board* board, int numVars, int*** cellLegalValuesIntBased, int categoryNo, int value, getCategory1BasedIDByCategory2BasedIDFunc getRowBasedIDfunc) {
-	addConstraintsFuncsErrorCode retVal = ADD_CONSTRAINTS_FUNCS_SUCCESS;
-
-	int* ind = NULL;
-	double* val = NULL;
-
-	int MN = getBoardBlockSize_MN(board);
-
-	UNUSED(env);
-	UNUSED(numVars);
-
-	ind = calloc(MN, sizeof(int));
-	val = calloc(MN, sizeof(double));
-
-	if ((ind == NULL) || (val == NULL))
-		retVal = ADD_CONSTRAINTS_FUNCS_MEMORY_ALLOCATION_FAILURE;
-	else {
-		int numRelevantIndices = 0;
-
-		int indexInCategory = 0;
-		for (indexInCategory = 0; indexInCategory < MN; indexInCategory++) {
-			int row = 0, col = 0;
-			int index = 0;
-			getRowBasedIDfunc(board, categoryNo, indexInCategory, &row, &col);
-			index = getIndexOfSpecificLegalValueOfCertainCell(row, col, value, cellLegalValuesIntBased);
-			if (index >= 0) {
-				ind[numRelevantIndices] = index;
-				val[numRelevantIndices] = 1;
-				numRelevantIndices++;
-			}
-		}
-
-		if (numRelevantIndices > 0) {
-			int error1 = 0, error2 = 0;
-			error1 = GRBaddconstr(model, numRelevantIndices, ind, val, GRB_LESS_EQUAL, 1.0, NULL);
-			error2 = GRBaddconstr(model, numRelevantIndices, ind, val, GRB_GREATER_EQUAL, 1.0, NULL);
-			if (error1 || error2)
-				retVal = ADD_CONSTRAINTS_FUNCS_GRB_COULD_NOT_ADD_CONSTRAINT;
-		}
-	}
-
-	if (val != NULL) {
-		free(val);
-		val = NULL;
-	}
-	if (ind != NULL) {
-		free(ind);
-		ind = NULL;
-	}
-
-	return retVal;
-}
-
-/**
- * addCategoryInstanceConstraints 	adds constraints pertaining to a certain instance of a certain category
- * 									(of the board to solve) to the Gurobi model
- *
- * @param env						[in] a pointer to the GRB environment of the model.
- * @param model						[in] the GRB model
- * @param board						[in] the board to be solved
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param categoryNo				[in] no. of category
- * @param getRowBasedIDfunc			[in] a function translating category-based cell ID to row-based cell ID
- *
- * @return addConstraintsFuncsErrorCode		an error code is returned, specifying whether the constraints
- * 											were added, or else	that an error has occurred
- */
-addConstraintsFuncsErrorCode addCategoryInstanceConstraints(GRBenv* env, GRBmodel* model, const Board* board, int numVars, int*** cellLegalValuesIntBased, int categoryNo, getCategory1BasedIDByCategory2BasedIDFunc getRowBasedIDfunc) {
-	int MN = getBoardBlockSize_MN(board);
-	int value = 1;
-	for (value = 1; value <= MN; value++) {
-		addConstraintsFuncsErrorCode retVal = addCategoryInstanceValueConstraints(env, model, board, numVars, cellLegalValuesIntBased, categoryNo, value, getRowBasedIDfunc);
-		if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-			return retVal;
-	}
-
-	return ADD_CONSTRAINTS_FUNCS_SUCCESS;
-}
-
-/**
- * addCategoryConstraints adds constraints pertaining to a certain category (of the board to solve)
- * 									   to the Gurobi model
- *
- * @param env						[in] a pointer to the GRB environment of the model.
- * @param model						[in] the GRB model
- * @param board						[in] the board to be solved
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param getRowBasedIDfunc			[in] a function translating category-based cell ID to row-based cell ID
- *
- * @return addConstraintsFuncsErrorCode		an error code is returned, specifying whether the constraints
- * 											were added, or else	that an error has occurred
- */
-addConstraintsFuncsErrorCode addCategoryConstraints(GRBenv* env, GRBmodel* model, const Board* board, int numVars, int*** cellLegalValuesIntBased, getCategory1BasedIDByCategory2BasedIDFunc getRowBasedIDfunc) {
-	int MN = getBoardBlockSize_MN(board);
-
-	int categoryNo = 0;
-	for (categoryNo = 0; categoryNo < MN; categoryNo++) {
-		addConstraintsFuncsErrorCode retVal = addCategoryInstanceConstraints(env, model, board, numVars, cellLegalValuesIntBased, categoryNo, getRowBasedIDfunc);
-		if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-			return retVal;
-	}
-
-	return ADD_CONSTRAINTS_FUNCS_SUCCESS;
-}
-
-/**
- * addCategoriesConstraints adds constraints pertaining to all relevant categories (of the board to solve)
- * 									   to the Gurobi model (i.e.: row, column, block)
- *
- * @param env						[in] a pointer to the GRB environment of the model.
- * @param model						[in] the GRB model
- * @param board						[in] the board to be solved
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- *
- * @return addConstraintsFuncsErrorCode		an error code is returned, specifying whether the constraints
- * 											were added, or else	that an error has occurred
- */
-addConstraintsFuncsErrorCode addCategoriesConstraints(GRBenv* env, GRBmodel* model, const Board* board, int numVars, int*** cellLegalValuesIntBased) {
-	addConstraintsFuncsErrorCode retVal = ADD_CONSTRAINTS_FUNCS_SUCCESS;
-
-	retVal = addCategoryConstraints(env, model, board, numVars, cellLegalValuesIntBased, getRowBasedIDGivenRowBasedID);
-	if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-		return retVal;
-	retVal = addCategoryConstraints(env, model, board, numVars, cellLegalValuesIntBased, getRowBasedIDGivenColumnBasedID);
-	if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-			return retVal;
-	retVal = addCategoryConstraints(env, model, board, numVars, cellLegalValuesIntBased, getRowBasedIDGivenBlockBasedID);
-	if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-			return retVal;
-
-	return ADD_CONSTRAINTS_FUNCS_SUCCESS;
-}
-
-/**
- * addSudokuConstraints 	adds sudoku constraints (based on the board to solve)
- * 						 	to the Gurobi model (i.e.: row, column, block)
- *
- * @param env						[in] a pointer to the GRB environment of the model.
- * @param model						[in] the GRB model
- * @param board						[in] the board to be solved
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param solvingMode				[in] the solving mode (ILP or LP)
- *
- * @return addConstraintsFuncsErrorCode		an error code is returned, specifying whether the constraints
- * 											ware added, or else	that an error has occurred
- */
-addConstraintsFuncsErrorCode addSudokuConstraints(GRBenv* env, GRBmodel* model, const Board* board, int numVars, int*** cellLegalValuesIntBased, solveBoardUsingLinearProgrammingSolvingMode solvingMode) {
-	addConstraintsFuncsErrorCode retVal = ADD_CONSTRAINTS_FUNCS_SUCCESS;
-
-	retVal = addCellsConstraints(env, model, board, numVars, cellLegalValuesIntBased, solvingMode);
-	if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-		return retVal;
-	retVal = addCategoriesConstraints(env, model, board, numVars, cellLegalValuesIntBased);
-	if (retVal != ADD_CONSTRAINTS_FUNCS_SUCCESS)
-			return retVal;
-
-	return ADD_CONSTRAINTS_FUNCS_SUCCESS;
-}
-
 typedef enum {
 	SOLVE_MODEL_SUCCESS,
 	SOLVE_MODEL_NO_SOLUTION_FOUND,
@@ -724,82 +375,6 @@ solveModelErrorCode solveModel(GRBenv* env, GRBmodel* model) {
 	}
 }
 
-/**
- * solveModel	applies the model ILP solution to a board.
- *
- * @param sol						[in] an array containing the values for each of the variables in the GRB model
- * 										 (constituting the solution of the model)
- * @param numVars					[in] the number of variables in the GRB environment
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param boardSolution				[in, out] the board to which to apply the found solution
- *
- * @return void
- */
-void applySolutionToBoard(double* sol, int numVars, int*** cellLegalValuesIntBased, Board* boardSolution) {
-	int MN = getBoardBlockSize_MN(boardSolution);
-
-	int row = 0, col = 0;
-
-	UNUSED(numVars);
-
-	for (row = 0; row < MN; row++)
-		for (col = 0; col < MN; col++) {
-			if (isBoardCellEmpty(getBoardCellByRow(boardSolution, row, col))) {
-				int value = 1;
-				for (value = 1; value <= MN; value++) {
-					int index = getIndexOfSpecificLegalValueOfCertainCell(row, col, value, cellLegalValuesIntBased);
-					if (index >= 0) {
-						if (sol[index] == 1.0) {
-							boardSolution->cells[row][col].value = value;
-							break;
-						}
-					}
-				}
-			}
-		}
-}
-
-/**
- * solveModel	applies the model LP solution to a values scores array.
- *
- * @param sol						[in] an array containing the values for each of the variables in the GRB model
- * 										 (constituting the solution of the model)
- * @param numVars					[in] the number of variables in the GRB environment
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
- * @param board						[in] the board that was to be solved
- * @param allCellsValuesScores		[in, out] the values scores array
- *
- * @return void
- */
-void applySolutionToValuesScoresArray(double* sol, int numVars, int*** cellLegalValuesIntBased, const Board* board, double*** allCellsValuesScores) {
-	int MN = getBoardBlockSize_MN(board);
-
-	int row = 0, col = 0;
-
-	UNUSED(numVars);
-
-	for (row = 0; row < MN; row++)
-		for (col = 0; col < MN; col++) {
-			if (isBoardCellEmpty(viewBoardCellByRow(board, row, col))) {
-				int value = 1;
-				for (value = 1; value <= MN; value++) {
-					int index = 0;
-
-					allCellsValuesScores[row][col][value] = 0;
-
-					index = getIndexOfSpecificLegalValueOfCertainCell(row, col, value, cellLegalValuesIntBased);
-					if (index >= 0) {
-						allCellsValuesScores[row][col][value] = sol[index];
-					}
-				}
-			}
-		}
-}
-
 typedef enum {
 	GET_SOLUTION_SUCCESS,
 	GET_SOLUTION_MEMORY_ALLOCATION_FAILURE,
@@ -811,10 +386,7 @@ typedef enum {
  *
  * @param env						[in] a pointer to the GRB environment of the model.
  * @param model						[in] the GRB model
- * @param numVars					[in] the number of variables to add to the model
- * @param cellLegalValuesIntBased	[in] an int-based array of legal values for all cells (gotten via
- * 										 getLegalValuesForAllCells and transformed via
- * 										 getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental)
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
  * @param board						[in] the board to be solved
  * @param boardSolution				[in, out] the board solution (for ILP)
  * @param allCellsValuesScores		[in, out] the values scores array (for LP)
@@ -822,7 +394,7 @@ typedef enum {
  *
  * @return void
  */
-getSolutionErrorCode getSolution(GRBenv* env, GRBmodel* model, int numVars, int*** cellLegalValuesIntBased, const Board* board, Board* boardSolution, double*** allCellsValuesScores, solveBoardUsingLinearProgrammingSolvingMode solvingMode) {
+getSolutionErrorCode getSolution(GRBenv* env, GRBmodel* model, const VariablesMap* variablesMap, const Board* board, Board* boardSolution, double*** allCellsValuesScores, solveBoardUsingLinearProgrammingSolvingMode solvingMode) {
 	getSolutionErrorCode retVal = GET_SOLUTION_SUCCESS;
 
 	int error = 0;
@@ -831,20 +403,20 @@ getSolutionErrorCode getSolution(GRBenv* env, GRBmodel* model, int numVars, int*
 
 	UNUSED(env);
 
-	sol = calloc(numVars, sizeof(double));
+	sol = calloc(variablesMap->numVars + 1, sizeof(double));
 	if (sol == NULL) {
 		retVal = GET_SOLUTION_MEMORY_ALLOCATION_FAILURE;
 		return retVal;
 	}
 
-	error = GRBgetdblattrarray(model, GRB_DBL_ATTR_X, 0, numVars, sol);
+	error = GRBgetdblattrarray(model, GRB_DBL_ATTR_X, 0, variablesMap->numVars, sol);
 	if (error) {
 		retVal = GET_SOLUTION_GRB_ERROR;
 	} else {
 		if (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_ILP) {
-			applySolutionToBoard(sol, numVars, cellLegalValuesIntBased, boardSolution);
+			applySolutionToBoard(sol, variablesMap, boardSolution);
 		} else if (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_LP) {
-			applySolutionToValuesScoresArray(sol, numVars, cellLegalValuesIntBased, board, allCellsValuesScores);
+			applySolutionToValuesScoresArray(sol, variablesMap, board, allCellsValuesScores);
 
 		} /* No other option */
 	}
@@ -858,158 +430,132 @@ getSolutionErrorCode getSolution(GRBenv* env, GRBmodel* model, int numVars, int*
 solveBoardUsingLinearProgrammingErrorCode solveBoardUsingLinearProgramming(solveBoardUsingLinearProgrammingSolvingMode solvingMode, const Board* board, Board* boardSolution, double*** allCellsValuesScores) {
 	solveBoardUsingLinearProgrammingErrorCode retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS;
 
-	int*** cellLegalValuesIntBased = NULL;
+	VariablesMap variablesMap = {0};
 	bool isThereUnsolvableCell = false;
 	int numVars = 0;
 	GRBenv* env = NULL;
+	Board presolvedBoardCopy = {0};
+	Board* presolvedBoard = NULL;
 
 	if (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_ILP) { /* Mode: ILP */
 		if (!copyBoard(board, boardSolution)) {
 			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
 			return retVal;
 		}
+		presolvedBoard = boardSolution; /* Note: the values placed by the presolve are part of the solution */
+	} else {
+		if (!copyBoard(board, &presolvedBoardCopy)) {
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+			return retVal;
+		}
+		presolvedBoard = &presolvedBoardCopy;
 	}
 
-	if (!getLegalValuesForAllCells(board, &cellLegalValuesIntBased, &isThereUnsolvableCell)) {
+	switch (presolveBoard(presolvedBoard)) {
+	case PRESOLVE_BOARD_SUCCESS:
+		if (!createVariablesMap(presolvedBoard, &variablesMap, &isThereUnsolvableCell))
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+		else if (isThereUnsolvableCell)
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE;
+		break;
+	case PRESOLVE_BOARD_MEMORY_ALLOCATION_FAILURE:
 		retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
-		return retVal;
-	}
-	if (isThereUnsolvableCell) {
-		freeIntAndIndexBasedLegalValuesForAllCells(board, cellLegalValuesIntBased);
+		break;
+	case PRESOLVE_BOARD_BOARD_ISNT_SOLVABLE:
 		retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE;
-		return retVal;
+		break;
 	}
-	numVars = getTotalNumLegalValuesAndMakeNumsOfLegalValuesIncremental(board, cellLegalValuesIntBased);
+	numVars = variablesMap.numVars;
 
-	env = getNewGRBEnvironment();
-	if (env == NULL)
-		retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_CREATING_NEW_GRB_ENVIRONMENT;
-	else {
-		GRBmodel* model = getNewGRBModel(env);
-		if (model == NULL)
-			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_CREATING_NEW_GRB_MODEL;
+	/* Note: no model is built if the presolve has found the board to be unsolvable, or has solved it */
+	if ((retVal == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS) && (numVars > 0)) {
+		env = getSharedGRBEnvironment();
+		if (env == NULL)
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_CREATING_NEW_GRB_ENVIRONMENT;
 		else {
-			bool shouldContinue = false;
-			switch (addVariablesAndObjectiveFunctionToModel(env, model, numVars, board, solvingMode)) {
-			case ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_SUCCESS:
-				shouldContinue = true;
-				break;
-			case ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_MEMORY_ALLOCATION_FAILURE:
-				retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
-				break;
-			default:
-				retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_ADDING_VARS_AND_OBJECTIVE_FUNC;
-				break;
-			}
-			if (shouldContinue) {
-				shouldContinue = false;
-				switch (addSudokuConstraints(env, model, board, numVars, cellLegalValuesIntBased, solvingMode)) {
-				case ADD_CONSTRAINTS_FUNCS_SUCCESS:
+			GRBmodel* model = getRecycledGRBModel(env);
+			if (model == NULL)
+				retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_CREATING_NEW_GRB_MODEL;
+			else {
+				bool shouldContinue = false;
+				switch (addVariablesAndObjectiveFunctionToModel(env, model, numVars, presolvedBoard, solvingMode)) {
+				case ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_SUCCESS:
 					shouldContinue = true;
 					break;
-				case ADD_CONSTRAINTS_FUNCS_MEMORY_ALLOCATION_FAILURE:
+				case ADD_VARIABLES_AND_OBJECTIVE_FUNCTION_TO_MODEL_MEMORY_ALLOCATION_FAILURE:
 					retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
 					break;
-				case ADD_CONSTRAINTS_FUNCS_GRB_COULD_NOT_ADD_CONSTRAINT:
-					retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_ADDING_CONSTRAINTS;
+				default:
+					retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_ADDING_VARS_AND_OBJECTIVE_FUNC;
+					break;
 				}
 				if (shouldContinue) {
-					switch (solveModel(env, model)) {
-					case SOLVE_MODEL_SUCCESS:
-						switch (getSolution(env, model, numVars, cellLegalValuesIntBased, board, boardSolution, allCellsValuesScores, solvingMode)) {
-							case GET_SOLUTION_SUCCESS:
-								break;
-							case GET_SOLUTION_MEMORY_ALLOCATION_FAILURE:
-								retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
-								break;
-							case GET_SOLUTION_GRB_ERROR:
-								retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_ACQUIRING_MODEL_SOLUTION;
-								break;
-						}
-						break;
-					case SOLVE_MODEL_NO_SOLUTION_FOUND:
-					case SOLVE_MODEL_MODEL_IS_UNSOLVABLE:
-						retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE;
+					shouldContinue = false;
+					switch (addSudokuConstraints(env, model, presolvedBoard, &variablesMap)) {
+					case ADD_CONSTRAINTS_FUNCS_SUCCESS:
+						shouldContinue = true;
 						break;
-					case SOLVE_MODEL_OTHER_ERROR:
-						retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_OTHER_FAILURE;
+					case ADD_CONSTRAINTS_FUNCS_MEMORY_ALLOCATION_FAILURE:
+						retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
 						break;
+					case ADD_CONSTRAINTS_FUNCS_GRB_COULD_NOT_ADD_CONSTRAINT:
+						retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_ADDING_CONSTRAINTS;
+					}
+					if (shouldContinue) {
+						switch (solveModel(env, model)) {
+						case SOLVE_MODEL_SUCCESS:
+							switch (getSolution(env, model, &variablesMap, presolvedBoard, boardSolution, allCellsValuesScores, solvingMode)) {
+								case GET_SOLUTION_SUCCESS:
+									break;
+								case GET_SOLUTION_MEMORY_ALLOCATION_FAILURE:
+									retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+									break;
+								case GET_SOLUTION_GRB_ERROR:
+									retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_FAILURE_ACQUIRING_MODEL_SOLUTION;
+									break;
+							}
+							break;
+						case SOLVE_MODEL_NO_SOLUTION_FOUND:
+						case SOLVE_MODEL_MODEL_IS_UNSOLVABLE:
+							retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE;
+							break;
+						case SOLVE_MODEL_OTHER_ERROR:
+							retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_OTHER_FAILURE;
+							break;
+						}
 					}
 				}
+				switch (retVal) {
+				case SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS:
+				case SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE:
+				case SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE:
+					break;
+				default:
+					discardRecycledGRBModel();
+					break;
+				}
 			}
-			freeGRBModel(model);
 		}
-		freeGRBEnvironment(env);
 	}
 
-	freeIntAndIndexBasedLegalValuesForAllCells(board, cellLegalValuesIntBased);
+	if ((retVal == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS) && (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_LP))
+		applyPresolvedBoardToValuesScoresArray(board, presolvedBoard, allCellsValuesScores);
+
+	freeVariablesMap(&variablesMap);
+	cleanupBoard(&presolvedBoardCopy);
 
 	return retVal;
 }
 
-void freeValuesScoresArr(double*** valuesScores, const Board* board) {
-	int MN = getBoardBlockSize_MN(board);
-
-	if (valuesScores != NULL) {
-		int row = 0;
-		for (row = 0; row < MN; row++) {
-			if (valuesScores[row] != NULL) {
-				int col = 0;
-				for (col = 0; col < MN; col++) {
-					if (valuesScores[row][col] != NULL) {
-						free(valuesScores[row][col]);
-						valuesScores[row][col] = NULL;
-					}
-				}
-				free(valuesScores[row]);
-				valuesScores[row] = NULL;
-			}
-		}
-		free(valuesScores);
-	}
+bool isLinearProgrammingAvailable() {
+	return true;
 }
 
-bool allocateValuesScoresArr(double**** valuesScoresOut, const Board* board) {
-	int MN = getBoardBlockSize_MN(board);
-
-	bool success = true;
-
-	double*** valuesScores = NULL;
-	valuesScores = calloc(MN, sizeof(double**));
-	if (valuesScores == NULL)
-		success = false;
-	else {
-		int row = 0;
-		for (row = 0; row < MN; row++) {
-			valuesScores[row] = calloc(MN, sizeof(double*));
-			if (valuesScores[row] == NULL) {
-				success = false;
-				break;
-			} else {
-				int col = 0;
-				for (col = 0; col < MN; col++) {
-					if (isBoardCellEmpty(viewBoardCellByRow(board, row, col))) {
-						valuesScores[row][col] = calloc(MN + 1, sizeof(double));
-						if (valuesScores[row][col] == NULL) {
-							success = false;
-							break;
-						}
-					}
-					if (!success)
-						break;
-				}
-			}
-
-		}
-	}
+void cleanupLinearProgramming() {
+	discardRecycledGRBModel();
 
-	if (!success) {
-		freeValuesScoresArr(valuesScores, board);
-		return false;
-	}
-	else {
-		*valuesScoresOut = valuesScores;
-		return true;
+	if (sharedGRBEnvironment != NULL) {
+		freeGRBEnvironment(sharedGRBEnvironment);
+		sharedGRBEnvironment = NULL;
 	}
-
 }
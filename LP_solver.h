@@ -2,7 +2,8 @@
  * LP_SOLVER Summary:
  *
  * A module designed to solve sudoku boards, employing Linear Programming (LP) for the task.
- * The Linear Programming is done via an external library called Gurobi.
+ * The Linear Programming is done via an external library called Gurobi. Builds without Gurobi
+ * (LP_solver_local.c) solve LP mode with the in-tree sparse LP solver instead, but not ILP mode.
  *
  * A sudoku board may be passed to this module in order for it to be solved in one of two modes:
  * 		1. ILP (Integer Linear Programming) - in which the output would be a solved board
@@ -13,6 +14,8 @@
  * solveBoardUsingLinearProgramming - solves a sudoku puzzle in any of the above-mentioned two modes
  * allocateValuesScoresArr - allocates an array for the values scores (relevant for LP mode)
  * freeValuesScoresArr - frees an array created by allocateValuesScoresArr (relevant for LP mode)
+ * isLinearProgrammingAvailable - tells whether this build can solve boards using LP at all
+ * cleanupLinearProgramming - frees the Gurobi environment and model kept between calls to solveBoardUsingLinearProgramming
  */
 
 #ifndef ILP_SOLVER_H_
@@ -82,4 +85,23 @@ void freeValuesScoresArr(double*** valuesScores, const Board* board);
  */
 bool allocateValuesScoresArr(double**** valuesScoresOut, const Board* board);
 
+/**
+ * isLinearProgrammingAvailable tells whether this build was linked against Gurobi, so that
+ * boards may be solved using integer linear programming. Builds without Gurobi solve LP mode
+ * in-tree, but fail every call in ILP mode.
+ *
+ * @return	bool			true when linear programming is available, false otherwise
+ */
+bool isLinearProgrammingAvailable();
+
+/**
+ * cleanupLinearProgramming frees the Gurobi environment and model which
+ * solveBoardUsingLinearProgramming keeps from one call to the next. It is to be called once
+ * no more boards are to be solved; a later call to solveBoardUsingLinearProgramming would
+ * load a new environment.
+ *
+ * @return	void
+ */
+void cleanupLinearProgramming();
+
 #endif /* ILP_SOLVER_H_ */
@@ -0,0 +1,133 @@
+#include <stdlib.h>
+
+#include "LP_solver.h"
+#include "LP_model.h"
+#include "sparse_LP_solver.h"
+
+#define UNUSED(x) (void)(x)
+
+/**
+ * solveModelUsingSparseLinearProgramming solves the LP model of a (presolved) board using the
+ * 										  in-tree sparse LP solver, and applies its solution to a
+ * 										  values scores array.
+ *
+ * @param board						[in] the (presolved) board to be solved
+ * @param variablesMap				[in] the map of the variables of the model (gotten via createVariablesMap)
+ * @param allCellsValuesScores		[in, out] the values scores array
+ *
+ * @return solveBoardUsingLinearProgrammingErrorCode	an error code is returned, specifying whether
+ * 														the model was solved, or else that an error has
+ * 														occurred
+ */
+solveBoardUsingLinearProgrammingErrorCode solveModelUsingSparseLinearProgramming(const Board* board, const VariablesMap* variablesMap, double*** allCellsValuesScores) {
+	solveBoardUsingLinearProgrammingErrorCode retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS;
+
+	ModelConstraints constraints = {0};
+	double* arena = NULL;
+	int numVars = variablesMap->numVars;
+
+	if (!buildModelConstraints(&constraints, board, variablesMap))
+		return SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+
+	arena = calloc(4 * numVars, sizeof(double));
+	if (arena == NULL)
+		retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+	else {
+		SparseLinearProgram program = {0};
+		double* obj = arena;
+		double* lb = obj + numVars;
+		double* ub = lb + numVars;
+		double* sol = ub + numVars;
+
+		int i = 0;
+		for (i = 0; i < numVars; i++) {
+			obj[i] = getRandomObjectiveCoefficient(board);
+			lb[i] = 0.0;
+			ub[i] = 1.0;
+		}
+
+		program.numVars = numVars;
+		program.numConstrs = constraints.numConstrs;
+		program.beg = constraints.beg;
+		program.ind = constraints.ind;
+		program.val = constraints.val;
+		program.rhs = constraints.rhs;
+		program.obj = obj;
+		program.lb = lb;
+		program.ub = ub;
+
+		switch (solveSparseLinearProgram(&program, sol, NULL)) {
+		case SOLVE_SPARSE_LINEAR_PROGRAM_SUCCESS:
+			applySolutionToValuesScoresArray(sol, variablesMap, board, allCellsValuesScores);
+			break;
+		case SOLVE_SPARSE_LINEAR_PROGRAM_MEMORY_ALLOCATION_FAILURE:
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+			break;
+		case SOLVE_SPARSE_LINEAR_PROGRAM_INFEASIBLE:
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE;
+			break;
+		case SOLVE_SPARSE_LINEAR_PROGRAM_ITERATION_LIMIT_REACHED:
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_OTHER_FAILURE;
+			break;
+		}
+
+		free(arena);
+	}
+
+	freeModelConstraints(&constraints);
+
+	return retVal;
+}
+
+solveBoardUsingLinearProgrammingErrorCode solveBoardUsingLinearProgramming(solveBoardUsingLinearProgrammingSolvingMode solvingMode, const Board* board, Board* boardSolution, double*** allCellsValuesScores) {
+	solveBoardUsingLinearProgrammingErrorCode retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS;
+
+	VariablesMap variablesMap = {0};
+	bool isThereUnsolvableCell = false;
+	Board presolvedBoard = {0};
+
+	UNUSED(boardSolution);
+
+	if (solvingMode == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SOLVING_MODE_ILP) /* Note: only the LP relaxation is solved in-tree */
+		return SOLVE_BOARD_USING_LINEAR_PROGRAMMING_GRB_ERROR_OTHER_FAILURE;
+
+	if (!copyBoard(board, &presolvedBoard)) {
+		retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+		return retVal;
+	}
+
+	switch (presolveBoard(&presolvedBoard)) {
+	case PRESOLVE_BOARD_SUCCESS:
+		if (!createVariablesMap(&presolvedBoard, &variablesMap, &isThereUnsolvableCell))
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+		else if (isThereUnsolvableCell)
+			retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE;
+		break;
+	case PRESOLVE_BOARD_MEMORY_ALLOCATION_FAILURE:
+		retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_MEMORY_ALLOCATION_FAILURE;
+		break;
+	case PRESOLVE_BOARD_BOARD_ISNT_SOLVABLE:
+		retVal = SOLVE_BOARD_USING_LINEAR_PROGRAMMING_BOARD_ISNT_SOLVABLE;
+		break;
+	}
+
+	/* Note: no model is built if the presolve has found the board to be unsolvable, or has solved it */
+	if ((retVal == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS) && (variablesMap.numVars > 0))
+		retVal = solveModelUsingSparseLinearProgramming(&presolvedBoard, &variablesMap, allCellsValuesScores);
+
+	if (retVal == SOLVE_BOARD_USING_LINEAR_PROGRAMMING_SUCCESS)
+		applyPresolvedBoardToValuesScoresArray(board, &presolvedBoard, allCellsValuesScores);
+
+	freeVariablesMap(&variablesMap);
+	cleanupBoard(&presolvedBoard);
+
+	return retVal;
+}
+
+bool isLinearProgrammingAvailable() {
+	return false;
+}
+
+void cleanupLinearProgramming() {
+	return;
+}
@@ -0,0 +1,562 @@
+/**
+ * BATCH Summary:
+ *
+ * A standalone program designed to run an operation on every puzzle of a puzzle corpus, as
+ * read by the corpus module, on a pool of threads. The main thread reads puzzles into a
+ * window of slots, which the threads of the pool take one at a time, in order. The main
+ * thread writes the results in the order the puzzles appear in the corpus, as soon as the
+ * earliest puzzle of the window is done, and reuses its slot for the next puzzle read, so
+ * a slow puzzle holds up only the writing of the results behind it. The operations are:
+ * - solve: finds a solution to each puzzle.
+ * - count: counts the solutions to each puzzle, up to the provided limit (0, the default,
+ *   counts them all).
+ * - validate: tells whether each puzzle has a unique solution, several, or none.
+ * The results file has a line per puzzle: the puzzle's number in the corpus, followed by
+ * its result, one of:
+ * - "solved <solution>", the solution in the line format of corpora. Solutions of boards
+ *   whose blocks have more cells than the line format holds are written as comma-separated values.
+ * - "counted <number of solutions>".
+ * - "unique", "multiple" or "unsolvable".
+ * - "error <reason>", if the puzzle could not be read.
+ * Once done, the throughput, the percentiles of the time each puzzle took and the numbers of
+ * unsolvable and failed puzzles are printed.
+ *
+ * Usage: sudoku-batch <solve|count|validate> <corpus_path> <results_path> [num_threads] [max_num_solutions]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "board.h"
+#include "corpus.h"
+#include "DLX_solver.h"
+#include "parallel_solver.h"
+
+#define ERROR_SUCCESS (0)
+
+/**
+ * The number of slots in the window of puzzles, per thread.
+ */
+#define BATCH_NUM_SLOTS_PER_THREAD (64)
+
+/**
+ * The number of solutions at which validation stops: a second solution shows a puzzle is
+ * not unique.
+ */
+#define BATCH_VALIDATE_MAX_NUM_SOLUTIONS (2)
+
+/**
+ * Latencies are recorded in a histogram with this many buckets per doubling of the time
+ * taken, so the percentiles reported are accurate to within about 9%.
+ */
+#define BATCH_LATENCY_NUM_BUCKETS_PER_OCTAVE (8)
+#define BATCH_LATENCY_NUM_OCTAVES (64)
+#define BATCH_LATENCY_NUM_BUCKETS (BATCH_LATENCY_NUM_BUCKETS_PER_OCTAVE * BATCH_LATENCY_NUM_OCTAVES)
+
+#define BATCH_RESULTS_BUFFER_SIZE (1 << 16)
+
+/**
+ * The operations the program may run on the puzzles.
+ */
+typedef enum {
+	BATCH_OPERATION_SOLVE,
+	BATCH_OPERATION_COUNT,
+	BATCH_OPERATION_VALIDATE
+} BatchOperation;
+
+/**
+ * BatchPuzzle struct is a slot of the window, holding a puzzle as read from the corpus,
+ * along with the result of the operation on it and the time the operation took. Its
+ * board is reused by the puzzles which later take the slot.
+ */
+typedef struct {
+	Board puzzle;
+	ReadPuzzleFromCorpusErrorCode readErrorCode;
+	bool success;
+	int numSolutions;
+	Board solution;
+	double seconds;
+	bool isDone;
+} BatchPuzzle;
+
+/**
+ * BatchPool struct holds what the threads of the pool share: the operation, the window
+ * of slots, and the numbers of puzzles read into it, taken by the threads and written
+ * out of it so far, the puzzle numbered i residing in slot i % numSlots. The counts and
+ * the isDone markers of the slots are guarded by the mutex. Threads wait on puzzleReady
+ * for a puzzle to take, and the main thread waits on puzzleDone for the earliest puzzle
+ * of the window to be done.
+ */
+typedef struct {
+	BatchOperation operation;
+	int maxNumSolutions;
+	BatchPuzzle* puzzles;
+	int numSlots;
+	int numWorkers;
+	long numRead;
+	long numTaken;
+	long numWritten;
+	bool isShuttingDown;
+	pthread_mutex_t mutex;
+	pthread_cond_t puzzleReady;
+	pthread_cond_t puzzleDone;
+} BatchPool;
+
+/**
+ * BatchStatistics struct holds the figures gathered over the whole run: the numbers of
+ * puzzles, of unsolvable puzzles and of puzzles which could not be read or processed, and
+ * a histogram of the time each puzzle took.
+ */
+typedef struct {
+	long numPuzzles;
+	long numUnsolvable;
+	long numFailures;
+	long latencyHistogram[BATCH_LATENCY_NUM_BUCKETS];
+} BatchStatistics;
+
+/**
+ * Get the current time of a monotonic wall clock.
+ *
+ * @return double 	The current time, in seconds
+ */
+double getBatchSeconds() {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Parse the name of an operation.
+ *
+ * @param name 			[in] The name of the operation
+ * @param operationOut 	[in, out] Pointer to be assigned with the operation
+ * @return true 		iff the name is that of an operation
+ * @return false 		otherwise
+ */
+bool parseBatchOperation(const char* name, BatchOperation* operationOut) {
+	if (strcmp(name, "solve") == 0)
+		*operationOut = BATCH_OPERATION_SOLVE;
+	else if (strcmp(name, "count") == 0)
+		*operationOut = BATCH_OPERATION_COUNT;
+	else if (strcmp(name, "validate") == 0)
+		*operationOut = BATCH_OPERATION_VALIDATE;
+	else
+		return false;
+	return true;
+}
+
+/**
+ * Run the operation on a puzzle which was read successfully, recording its result.
+ * Puzzles whose filled cells conflict have no solutions.
+ *
+ * @param pool 		[in] The pool, holding the operation
+ * @param puzzle 	[in, out] The puzzle
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool runBatchOperation(const BatchPool* pool, BatchPuzzle* puzzle) {
+	bool isErroneous = false;
+	bool isSolvable = false;
+
+	puzzle->numSolutions = 0;
+	if (!checkErroneousCells(&(puzzle->puzzle), &isErroneous))
+		return false;
+	if (isErroneous)
+		return true;
+
+	switch (pool->operation) {
+	case BATCH_OPERATION_SOLVE:
+		if (!findSolutionUsingDancingLinks(&(puzzle->puzzle), &(puzzle->solution), &isSolvable))
+			return false;
+		puzzle->numSolutions = isSolvable ? 1 : 0;
+		return true;
+	case BATCH_OPERATION_COUNT:
+		return calculateNumSolutionsUsingDancingLinksUpToLimit(&(puzzle->puzzle), pool->maxNumSolutions, &(puzzle->numSolutions));
+	case BATCH_OPERATION_VALIDATE:
+		return calculateNumSolutionsUsingDancingLinksUpToLimit(&(puzzle->puzzle), BATCH_VALIDATE_MAX_NUM_SOLUTIONS, &(puzzle->numSolutions));
+	}
+
+	return false;
+}
+
+/**
+ * Run the operation on a puzzle taken from the window, recording the time it took.
+ *
+ * @param pool 		[in] The pool, holding the operation
+ * @param puzzle 	[in, out] The puzzle
+ */
+void processBatchPuzzle(const BatchPool* pool, BatchPuzzle* puzzle) {
+	double start = getBatchSeconds();
+
+	puzzle->success = (puzzle->readErrorCode != ERROR_SUCCESS) || runBatchOperation(pool, puzzle);
+	puzzle->seconds = getBatchSeconds() - start;
+}
+
+/**
+ * The routine of each thread of the pool: takes the puzzles of the window in order, as
+ * they are read, and processes them, until the pool shuts down and no puzzles are left.
+ *
+ * @param arg 		[in, out] The BatchPool, cast to a void pointer
+ * @return void* 	NULL
+ */
+void* runBatchWorker(void* arg) {
+	BatchPool* pool = (BatchPool*)arg;
+
+	pthread_mutex_lock(&(pool->mutex));
+	while (true) {
+		BatchPuzzle* puzzle = NULL;
+
+		while (!pool->isShuttingDown && (pool->numTaken == pool->numRead))
+			pthread_cond_wait(&(pool->puzzleReady), &(pool->mutex));
+		if (pool->numTaken == pool->numRead)
+			break;
+
+		puzzle = &(pool->puzzles[pool->numTaken % pool->numSlots]);
+		pool->numTaken++;
+		pthread_mutex_unlock(&(pool->mutex));
+
+		processBatchPuzzle(pool, puzzle);
+
+		pthread_mutex_lock(&(pool->mutex));
+		puzzle->isDone = true;
+		pthread_cond_signal(&(pool->puzzleDone));
+	}
+	pthread_mutex_unlock(&(pool->mutex));
+
+	return NULL;
+}
+
+/**
+ * Get the description of an error that occurred while reading a puzzle.
+ *
+ * @param errorCode 	[in] The error
+ * @return char* 		The description of the error
+ */
+char* getBatchReadErrorString(ReadPuzzleFromCorpusErrorCode errorCode) {
+	switch (errorCode) {
+	case READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES:
+	case READ_PUZZLE_FROM_CORPUS_FILE_COULD_NOT_BE_READ:
+		return "unreadable";
+	case READ_PUZZLE_FROM_CORPUS_BAD_FORMAT:
+		return "bad-format";
+	case READ_PUZZLE_FROM_CORPUS_DIMENSIONS_ARE_NOT_POSITIVE:
+		return "dimensions-not-positive";
+	case READ_PUZZLE_FROM_CORPUS_CELL_VALUE_NOT_IN_RANGE:
+		return "value-not-in-range";
+	case READ_PUZZLE_FROM_CORPUS_MEMORY_ALLOCATION_FAILURE:
+		return "memory";
+	}
+
+	return "unknown";
+}
+
+/**
+ * Write a solution to the results file, in the line format of corpora if its blocks have
+ * few enough cells, and as comma-separated values otherwise.
+ *
+ * @param results 	[in, out] The results file
+ * @param solution 	[in] The solution to be written
+ */
+void writeBatchSolution(FILE* results, const Board* solution) {
+	int MN = getBoardBlockSize_MN(solution);
+	int MN2 = getBoardSize_MN2(solution);
+	int index = 0;
+
+	for (index = 0; index < MN2; index++) {
+		int value = getBoardCellValue(&(solution->cells[index]));
+		if (MN > PUZZLE_CORPUS_LINE_FORMAT_MAX_BLOCK_SIZE)
+			fprintf(results, (index > 0) ? ",%d" : "%d", value);
+		else
+			fputc((value <= 9) ? '0' + value : 'A' + value - 10, results);
+	}
+}
+
+/**
+ * Write the result of a puzzle to the results file, and add it to the statistics.
+ *
+ * @param results 		[in, out] The results file
+ * @param pool 			[in] The pool, holding the operation
+ * @param puzzle 		[in, out] The puzzle. Its solution, if any, is cleaned up
+ * @param statistics 	[in, out] The statistics
+ */
+void writeBatchResult(FILE* results, const BatchPool* pool, BatchPuzzle* puzzle, BatchStatistics* statistics) {
+	int bucket = (int)(BATCH_LATENCY_NUM_BUCKETS_PER_OCTAVE * log(1 + puzzle->seconds * 1e9) / log(2));
+
+	statistics->numPuzzles++;
+	statistics->latencyHistogram[(bucket < BATCH_LATENCY_NUM_BUCKETS) ? bucket : BATCH_LATENCY_NUM_BUCKETS - 1]++;
+	fprintf(results, "%ld ", statistics->numPuzzles);
+
+	if (puzzle->readErrorCode != ERROR_SUCCESS) {
+		statistics->numFailures++;
+		fprintf(results, "error %s\n", getBatchReadErrorString(puzzle->readErrorCode));
+		return;
+	}
+	if (!puzzle->success) {
+		statistics->numFailures++;
+		fprintf(results, "error memory\n");
+		return;
+	}
+
+	if (puzzle->numSolutions == 0) {
+		statistics->numUnsolvable++;
+		if (pool->operation != BATCH_OPERATION_COUNT) {
+			fprintf(results, "unsolvable\n");
+			return;
+		}
+	}
+
+	switch (pool->operation) {
+	case BATCH_OPERATION_SOLVE:
+		fprintf(results, "solved ");
+		writeBatchSolution(results, &(puzzle->solution));
+		fprintf(results, "\n");
+		cleanupBoard(&(puzzle->solution));
+		break;
+	case BATCH_OPERATION_COUNT:
+		fprintf(results, "counted %d\n", puzzle->numSolutions);
+		break;
+	case BATCH_OPERATION_VALIDATE:
+		fprintf(results, (puzzle->numSolutions == 1) ? "unique\n" : "multiple\n");
+		break;
+	}
+}
+
+/**
+ * Get a percentile of the time puzzles took, as the upper bound of the histogram bucket
+ * it falls in.
+ *
+ * @param statistics 	[in] The statistics
+ * @param percentile 	[in] The percentile, between 0 and 100
+ * @return double 		The time, in seconds
+ */
+double getBatchLatencyPercentile(const BatchStatistics* statistics, double percentile) {
+	long rank = (long)ceil(statistics->numPuzzles * percentile / 100);
+	long numSeen = 0;
+	int bucket = 0;
+
+	for (bucket = 0; bucket < BATCH_LATENCY_NUM_BUCKETS - 1; bucket++) {
+		numSeen += statistics->latencyHistogram[bucket];
+		if (numSeen >= rank)
+			break;
+	}
+
+	return pow(2, (double)(bucket + 1) / BATCH_LATENCY_NUM_BUCKETS_PER_OCTAVE) / 1e9;
+}
+
+/**
+ * Print the statistics of the run.
+ *
+ * @param statistics 	[in] The statistics
+ * @param numThreads 	[in] The number of threads the puzzles were processed on
+ * @param seconds 		[in] The time the whole run took, in seconds
+ */
+void printBatchStatistics(const BatchStatistics* statistics, int numThreads, double seconds) {
+	printf("threads: %d\n", numThreads);
+	printf("puzzles: %ld\n", statistics->numPuzzles);
+	printf("unsolvable: %ld\n", statistics->numUnsolvable);
+	printf("failures: %ld\n", statistics->numFailures);
+	printf("seconds: %.3f\n", seconds);
+	printf("puzzles/second: %.0f\n", (seconds > 0) ? statistics->numPuzzles / seconds : 0.0);
+	if (statistics->numPuzzles > 0)
+		printf("latency (ms): p50 %.3f, p90 %.3f, p99 %.3f, p99.9 %.3f, max %.3f\n",
+			   getBatchLatencyPercentile(statistics, 50) * 1e3, getBatchLatencyPercentile(statistics, 90) * 1e3,
+			   getBatchLatencyPercentile(statistics, 99) * 1e3, getBatchLatencyPercentile(statistics, 99.9) * 1e3,
+			   getBatchLatencyPercentile(statistics, 100) * 1e3);
+}
+
+/**
+ * Read a puzzle into the next free slot of the window, and hand it to the pool.
+ *
+ * @param reader 		[in, out] The corpus
+ * @param pool 			[in, out] The pool
+ * @return ReadPuzzleFromCorpusErrorCode 	The error that occurred while reading the puzzle,
+ * 						or 0 on success. Puzzles which could not be read are handed to the
+ * 						pool all the same, unless the corpus has ended or a memory error occurred
+ */
+ReadPuzzleFromCorpusErrorCode readBatchPuzzle(PuzzleCorpusReader* reader, BatchPool* pool) {
+	BatchPuzzle* puzzle = &(pool->puzzles[pool->numRead % pool->numSlots]); /* Note: the slot is free, so no thread touches it */
+
+	puzzle->readErrorCode = readPuzzleFromCorpus(reader, &(puzzle->puzzle));
+	puzzle->isDone = false;
+	if ((puzzle->readErrorCode == READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES) ||
+		(puzzle->readErrorCode == READ_PUZZLE_FROM_CORPUS_MEMORY_ALLOCATION_FAILURE))
+		return puzzle->readErrorCode;
+
+	pthread_mutex_lock(&(pool->mutex));
+	pool->numRead++;
+	pthread_cond_signal(&(pool->puzzleReady));
+	pthread_mutex_unlock(&(pool->mutex));
+	return puzzle->readErrorCode;
+}
+
+/**
+ * Read all puzzles of a corpus into the window, and write their results out of it in
+ * order, keeping the window as full as possible.
+ *
+ * @param reader 		[in, out] The corpus
+ * @param results 		[in, out] The results file
+ * @param pool 			[in, out] The pool
+ * @param statistics 	[in, out] The statistics
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred while reading the corpus
+ */
+bool processBatchCorpus(PuzzleCorpusReader* reader, FILE* results, BatchPool* pool, BatchStatistics* statistics) {
+	bool hasCorpusEnded = false;
+
+	while (!hasCorpusEnded || (pool->numWritten < pool->numRead)) {
+		BatchPuzzle* puzzle = NULL;
+
+		while (!hasCorpusEnded && (pool->numRead - pool->numWritten < pool->numSlots)) {
+			ReadPuzzleFromCorpusErrorCode errorCode = readBatchPuzzle(reader, pool);
+			if (errorCode == READ_PUZZLE_FROM_CORPUS_MEMORY_ALLOCATION_FAILURE)
+				return false;
+			hasCorpusEnded = (errorCode == READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES) ||
+							 (errorCode == READ_PUZZLE_FROM_CORPUS_FILE_COULD_NOT_BE_READ);
+		}
+		if (pool->numWritten == pool->numRead)
+			break;
+
+		puzzle = &(pool->puzzles[pool->numWritten % pool->numSlots]);
+		if (pool->numWorkers == 0) {
+			processBatchPuzzle(pool, puzzle);
+		} else {
+			pthread_mutex_lock(&(pool->mutex));
+			while (!puzzle->isDone)
+				pthread_cond_wait(&(pool->puzzleDone), &(pool->mutex));
+			pthread_mutex_unlock(&(pool->mutex));
+		}
+
+		writeBatchResult(results, pool, puzzle, statistics);
+		pool->numWritten++;
+	}
+
+	return true;
+}
+
+/**
+ * Run the operation on all puzzles of a corpus on a pool of threads, the calling thread
+ * reading the puzzles and writing the results. If some threads cannot be created, the
+ * threads which were created share all the work, and if none can, the calling thread
+ * processes the puzzles itself.
+ *
+ * @param reader 		[in, out] The corpus
+ * @param results 		[in, out] The results file
+ * @param operation 	[in] The operation
+ * @param maxNumSolutions 	[in] The number of solutions at which counts stop, or 0
+ * @param numThreads 	[in] The number of threads in the pool
+ * @param statistics 	[in, out] The statistics
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool runBatch(PuzzleCorpusReader* reader, FILE* results, BatchOperation operation, int maxNumSolutions, int numThreads, BatchStatistics* statistics) {
+	BatchPool pool = {0};
+	pthread_t* threads = NULL;
+	bool* isThreadCreated = NULL;
+	bool success = true;
+	int i = 0;
+
+	pool.operation = operation;
+	pool.maxNumSolutions = maxNumSolutions;
+	pool.numSlots = numThreads * BATCH_NUM_SLOTS_PER_THREAD;
+	pool.puzzles = calloc(pool.numSlots, sizeof(BatchPuzzle));
+	threads = calloc(numThreads, sizeof(pthread_t));
+	isThreadCreated = calloc(numThreads, sizeof(bool));
+	if ((pool.puzzles == NULL) || (threads == NULL) || (isThreadCreated == NULL)) {
+		free(pool.puzzles);
+		free(threads);
+		free(isThreadCreated);
+		return false;
+	}
+
+	pthread_mutex_init(&(pool.mutex), NULL);
+	pthread_cond_init(&(pool.puzzleReady), NULL);
+	pthread_cond_init(&(pool.puzzleDone), NULL);
+	for (i = 0; i < numThreads; i++) {
+		isThreadCreated[i] = pthread_create(&(threads[i]), NULL, runBatchWorker, &pool) == 0;
+		if (isThreadCreated[i])
+			pool.numWorkers++;
+	}
+
+	success = processBatchCorpus(reader, results, &pool, statistics);
+
+	pthread_mutex_lock(&(pool.mutex));
+	pool.isShuttingDown = true;
+	pthread_cond_broadcast(&(pool.puzzleReady));
+	pthread_mutex_unlock(&(pool.mutex));
+	for (i = 0; i < numThreads; i++)
+		if (isThreadCreated[i])
+			pthread_join(threads[i], NULL);
+
+	pthread_cond_destroy(&(pool.puzzleDone));
+	pthread_cond_destroy(&(pool.puzzleReady));
+	pthread_mutex_destroy(&(pool.mutex));
+	for (i = 0; i < pool.numSlots; i++)
+		cleanupBoard(&(pool.puzzles[i].puzzle));
+	free(pool.puzzles);
+	free(threads);
+	free(isThreadCreated);
+	return success;
+}
+
+int main(int argc, char** argv) {
+	BatchOperation operation = BATCH_OPERATION_SOLVE;
+	BatchStatistics* statistics = NULL;
+	PuzzleCorpusReader* reader = NULL;
+	FILE* results = NULL;
+	int numThreads = getDefaultNumSolverThreads();
+	int maxNumSolutions = 0;
+	double start = 0;
+	bool success = true;
+
+	if ((argc < 4) || (argc > 6) || !parseBatchOperation(argv[1], &operation)) {
+		printf("Usage: sudoku-batch <solve|count|validate> <corpus_path> <results_path> [num_threads] [max_num_solutions]\n");
+		return 1;
+	}
+	if (argc > 4)
+		numThreads = atoi(argv[4]);
+	if ((numThreads < 1) || (numThreads > PARALLEL_SOLVER_MAX_NUM_THREADS)) {
+		printf("Error: number of threads must be between 1 and %d\n", PARALLEL_SOLVER_MAX_NUM_THREADS);
+		return 1;
+	}
+	if (argc > 5)
+		maxNumSolutions = atoi(argv[5]);
+	if (maxNumSolutions < 0) {
+		printf("Error: maximal number of solutions must not be negative\n");
+		return 1;
+	}
+
+	reader = openPuzzleCorpusReader(argv[2]);
+	if (reader == NULL) {
+		printf("Error: corpus could not be opened\n");
+		return 1;
+	}
+	results = fopen(argv[3], "w");
+	if (results == NULL) {
+		printf("Error: results file could not be opened\n");
+		closePuzzleCorpusReader(reader);
+		return 1;
+	}
+	setvbuf(results, NULL, _IOFBF, BATCH_RESULTS_BUFFER_SIZE);
+
+	statistics = calloc(1, sizeof(BatchStatistics));
+	start = getBatchSeconds();
+	success = (statistics != NULL) && runBatch(reader, results, operation, maxNumSolutions, numThreads, statistics);
+	success = (fclose(results) == 0) && success;
+	closePuzzleCorpusReader(reader);
+
+	if (success)
+		printBatchStatistics(statistics, numThreads, getBatchSeconds() - start);
+	else
+		printf("Error: memory allocation failure, or results could not be written\n");
+
+	free(statistics);
+	cleanupBoardGeometries();
+	return success ? 0 : 1;
+}
@@ -0,0 +1,601 @@
+/**
+ * BENCHMARK Summary:
+ *
+ * A standalone program designed to measure the performance of the solving engines on a fixed
+ * set of puzzles. Each puzzle is solved repeatedly until a minimal amount of wall-clock time
+ * has passed, and the averages of the runs are reported. The parallel counter runs on the
+ * provided number of threads, or on as many threads as there are processors online, splitting
+ * the search tree to the provided depth, or to one chosen automatically.
+ * Then, boards of growing sizes are saved to and loaded from files in the text format and in the
+ * binary format, and the average time each operation takes in either format is reported. The
+ * files are written to the working directory, and removed when done.
+ * Finally, a corpus of many puzzles is written and read back as a stream in either corpus
+ * format, and the number of puzzles read and written per second is reported.
+ *
+ * Usage: sudoku-benchmark [num_threads [split_depth]]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "board.h"
+#include "BT_solver.h"
+#include "DLX_solver.h"
+#include "parallel_solver.h"
+#include "corpus.h"
+
+#define UNUSED(x) (void)(x)
+
+#define BENCHMARK_MIN_SECONDS (0.5)
+
+#define BENCHMARK_MAX_BLOCK_SIZE (25)
+
+/**
+ * The number of solutions at which the uniqueness check stops.
+ */
+#define BENCHMARK_UNIQUENESS_MAX_NUM_SOLUTIONS (2)
+
+#define BENCHMARK_TEXT_BOARD_FILE_PATH ("benchmark_board.txt")
+#define BENCHMARK_BINARY_BOARD_FILE_PATH ("benchmark_board.sdkb")
+
+#define BENCHMARK_CORPUS_FILE_PATH ("benchmark_corpus.txt")
+#define BENCHMARK_CORPUS_NUM_PUZZLES (200000)
+
+/**
+ * BenchmarkPuzzle struct describes a puzzle to benchmark the solvers on. The cells are given
+ * row after row, a string per row, one character per cell: '.' or '0' for an empty cell, '1' to '9'
+ * for the values 1 to 9, and 'A', 'B', ... for the values 10, 11, ...
+ * Puzzles which the ordered backtracking search cannot solve in reasonable time are
+ * only solved by the other engines.
+ */
+typedef struct {
+	const char* name;
+	int numRowsInBlock_M;
+	int numColumnsInBlock_N;
+	bool isOrderedSearchFeasible;
+	const char* rows[BENCHMARK_MAX_BLOCK_SIZE];
+} BenchmarkPuzzle;
+
+const BenchmarkPuzzle benchmarkPuzzles[] = {
+	{"9x9 classic", 3, 3, true, {
+		"53..7....",
+		"6..195...",
+		".98....6.",
+		"8...6...3",
+		"4..8.3..1",
+		"7...2...6",
+		".6....28.",
+		"...419..5",
+		"....8..79"}},
+	{"9x9 hard", 3, 3, true, {
+		"8........",
+		"..36.....",
+		".7..9.2..",
+		".5...7...",
+		"....457..",
+		"...1...3.",
+		"..1....68",
+		"..85...1.",
+		".9....4.."}},
+	{"9x9 medium", 3, 3, true, {
+		"..9748...",
+		"7........",
+		".2.1.9...",
+		"..7...24.",
+		".64.1.59.",
+		".98...3..",
+		"...8.3.2.",
+		"........6",
+		"...2759.."}},
+	{"16x16", 4, 4, true, {
+		"2.715D9.ACE8.4.3",
+		"5D96......4.7.12",
+		".E...4..1.G29D65",
+		".4..2.....D5.EA.",
+		".5.C48.......29D",
+		".......79...6.C.",
+		"G..7..19C6....F.",
+		"D2.9E5..FA.4B3.G",
+		"...5FA.834....29",
+		"FA..7B.3.G..D65C",
+		"7B..9.G.5D...A8F",
+		".1.....58.A.4.37",
+		"BF841..G.2..5...",
+		"1.3.6.2DE5C.8.4B",
+		".92DA.5E.8.B..G1",
+		"....BF84G.712..6"}},
+	{"25x25", 5, 5, false, {
+		"9.7.2..3.KL.6.E......I.P.",
+		".PJ.D.8B....1...H.4K..ON.",
+		"F.5CO7....DMPI.B8EL.A34KH",
+		".6E.L.FCON..K3..M.D.7.2.9",
+		"H.A34.M.D...N.5.9.21..L6.",
+		"DJ9PI..6.......K4.3...C.O",
+		"2.8.GF.....L.6.NO.C.9PIJ.",
+		".5.NC821...DJ.......F..A.",
+		"4.FK.9D...C.5NM1...7H.BE.",
+		"LE.6B.O..5.4AKFPD9.J8.G.2",
+		"..NO..J29GM5IDPL.68B.4H3.",
+		".IPD.6...B9JG21.E..3...C.",
+		"E.K.HP...IFACO..J19G.....",
+		"JG..9..4.387BL6.AN..P..I5",
+		"7...8NA.F.H..4K..P.I129.J",
+		"G8.7.O..KF6.HE45C.N.2J.9.",
+		"I9.JP..E6H1G87.A..K..5N..",
+		"BH4.6D.5N..3.A.JI..9.7..G",
+		".F....IJ.9..M..7GL...E6H.",
+		".MD..LG7.8PI9J.EB.6HOAK.3",
+		"NDI..B.87LJ..9GH..E...AO.",
+		"K.CFAGP9....DM...B.L3.E4.",
+		".2G9J...E..1L8...CA.IM.D.",
+		".43..INM..A.....PG.2.87L1",
+		"1LB.7.....E..H3M..5.G9J.."}},
+	{NULL, 0, 0, false, {NULL}}
+};
+
+/**
+ * Get the value represented by a character in a BenchmarkPuzzle's cells string.
+ *
+ * @param chr 		[in] The character to be translated
+ * @return int 		The value represented by the character
+ */
+int getBenchmarkCellValue(char chr) {
+	if ((chr == '.') || (chr == '0'))
+		return EMPTY_CELL_VALUE;
+	if ((chr >= '1') && (chr <= '9'))
+		return chr - '0';
+	return chr - 'A' + 10;
+}
+
+/**
+ * Create a board according to a BenchmarkPuzzle's description. Filled cells are marked as fixed.
+ *
+ * @param puzzle 		[in] The description of the board
+ * @param boardOut 		[in, out] A pointer to the board struct to be created
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool createBenchmarkBoard(const BenchmarkPuzzle* puzzle, Board* boardOut) {
+	int MN = 0, row = 0, col = 0;
+
+	boardOut->numRowsInBlock_M = puzzle->numRowsInBlock_M;
+	boardOut->numColumnsInBlock_N = puzzle->numColumnsInBlock_N;
+	if (!createEmptyBoard(boardOut))
+		return false;
+
+	MN = getBoardBlockSize_MN(boardOut);
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++)
+			setBoardCellValue(boardOut, row, col, getBenchmarkCellValue(puzzle->rows[row][col]));
+	markFilledCellsAsFixed(boardOut);
+
+	return true;
+}
+
+/**
+ * Get the current time of a monotonic wall clock.
+ *
+ * @return double 	The current time, in seconds
+ */
+double getBenchmarkSeconds() {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Print the results of benchmarking an engine on a puzzle.
+ *
+ * @param puzzle 		[in] The puzzle which was solved
+ * @param engineName 	[in] The name of the engine
+ * @param numSolutions 	[in] The number of solutions found
+ * @param numNodes 		[in] The number of search nodes visited per run, or a negative
+ * 						number if the engine does not report it
+ * @param seconds 		[in] The time all runs took, in seconds
+ * @param numRuns 		[in] The number of runs
+ */
+void printBenchmarkResult(const BenchmarkPuzzle* puzzle, const char* engineName, int numSolutions, long numNodes, double seconds, int numRuns) {
+	if (numNodes < 0) {
+		printf("%-16s %-14s %12d %14s %12.6f %14s\n", puzzle->name, engineName, numSolutions, "-", seconds / numRuns, "-");
+		return;
+	}
+
+	printf("%-16s %-14s %12d %14ld %12.6f %14.0f\n", puzzle->name, engineName, numSolutions, numNodes,
+		   seconds / numRuns, (seconds > 0) ? (numNodes * (double)numRuns) / seconds : 0.0);
+}
+
+/**
+ * Benchmark the backtracking solver on a puzzle, reporting the number of search nodes
+ * visited per second.
+ *
+ * @param puzzle 			[in] The puzzle to be solved
+ * @param board 			[in] The board created from the puzzle
+ * @param method 			[in] The method the solver uses to pick cells to branch on
+ * @param maxNumSolutions 	[in] The number of solutions at which the search stops, or 0
+ * 							to exhaust the search
+ * @param engineName 		[in] The name to report the results under
+ * @return true 			iff the procedure was successful
+ * @return false 			iff a memory error occurred
+ */
+bool benchmarkBacktrackSolver(const BenchmarkPuzzle* puzzle, const Board* board, BacktrackSolverMethod method, int maxNumSolutions, const char* engineName) {
+	BacktrackSolverStatistics statistics = {0};
+	int numSolutions = 0;
+	int numRuns = 0;
+	double seconds = 0;
+	double start = getBenchmarkSeconds();
+
+	do {
+		if (!calculateNumSolutionsUsingMethod(board, method, maxNumSolutions, &numSolutions, &statistics))
+			return false;
+		numRuns++;
+		seconds = getBenchmarkSeconds() - start;
+	} while (seconds < BENCHMARK_MIN_SECONDS);
+
+	printBenchmarkResult(puzzle, engineName, numSolutions, statistics.numNodes, seconds, numRuns);
+	return true;
+}
+
+/**
+ * Benchmark the dancing links solver on a puzzle, reporting the number of search nodes
+ * visited per second.
+ *
+ * @param puzzle 		[in] The puzzle to be solved
+ * @param board 		[in] The board created from the puzzle
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool benchmarkDancingLinksSolver(const BenchmarkPuzzle* puzzle, const Board* board) {
+	DancingLinksStatistics statistics = {0};
+	int numSolutions = 0;
+	int numRuns = 0;
+	double seconds = 0;
+	double start = getBenchmarkSeconds();
+
+	do {
+		if (!enumerateSolutionsUsingDancingLinks(board, NULL, NULL, &numSolutions, &statistics))
+			return false;
+		numRuns++;
+		seconds = getBenchmarkSeconds() - start;
+	} while (seconds < BENCHMARK_MIN_SECONDS);
+
+	printBenchmarkResult(puzzle, "dlx", numSolutions, statistics.numNodes, seconds, numRuns);
+	return true;
+}
+
+/**
+ * Benchmark the parallel counter on a puzzle, with the minimum remaining values backtracking
+ * solver counting the subtrees.
+ *
+ * @param puzzle 		[in] The puzzle to be solved
+ * @param board 		[in] The board created from the puzzle
+ * @param numThreads 	[in] The number of threads to count on
+ * @param splitDepth 	[in] The depth to which the search tree is split, or 0 to choose it
+ * 						automatically
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool benchmarkParallelSolver(const BenchmarkPuzzle* puzzle, const Board* board, int numThreads, int splitDepth) {
+	int numSolutions = 0;
+	int numRuns = 0;
+	double seconds = 0;
+	double start = getBenchmarkSeconds();
+
+	do {
+		if (!calculateNumSolutionsInParallel(board, calculateNumSolutionsUpToLimit, numThreads, splitDepth, 0, &numSolutions))
+			return false;
+		numRuns++;
+		seconds = getBenchmarkSeconds() - start;
+	} while (seconds < BENCHMARK_MIN_SECONDS);
+
+	printBenchmarkResult(puzzle, "bt-mrv-par", numSolutions, -1, seconds, numRuns);
+	return true;
+}
+
+/**
+ * BenchmarkBoardFileDimensions struct describes the dimensions of a board to benchmark
+ * the board file formats on.
+ */
+typedef struct {
+	const char* name;
+	int numRowsInBlock_M;
+	int numColumnsInBlock_N;
+} BenchmarkBoardFileDimensions;
+
+const BenchmarkBoardFileDimensions benchmarkBoardFileDimensions[] = {
+	{"9x9", 3, 3},
+	{"36x36", 6, 6},
+	{"64x64", 8, 8},
+	{"100x100", 10, 10},
+	{NULL, 0, 0}
+};
+
+/**
+ * Create a board of the provided dimensions, filled according to a valid pattern with
+ * a third of the cells left empty. Filled cells are marked as fixed.
+ *
+ * @param dimensions 	[in] The dimensions of the board
+ * @param boardOut 		[in, out] A pointer to the board struct to be created
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool createPatternBenchmarkBoard(const BenchmarkBoardFileDimensions* dimensions, Board* boardOut) {
+	int M = dimensions->numRowsInBlock_M, N = dimensions->numColumnsInBlock_N;
+	int MN = 0, row = 0, col = 0;
+
+	boardOut->numRowsInBlock_M = M;
+	boardOut->numColumnsInBlock_N = N;
+	if (!createEmptyBoard(boardOut))
+		return false;
+
+	MN = getBoardBlockSize_MN(boardOut);
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++)
+			if ((row + 2 * col) % 3 != 0)
+				setBoardCellValue(boardOut, row, col, (((row % M) * N) + (row / M) + col) % MN + 1);
+	markFilledCellsAsFixed(boardOut);
+
+	return true;
+}
+
+/**
+ * Get the size of a file.
+ *
+ * @param filePath 	[in] Path to the file
+ * @return long 	The size of the file in bytes, or a negative number if it could not be found
+ */
+long getBenchmarkFileSize(const char* filePath) {
+	long size = -1;
+	FILE* file = fopen(filePath, "rb");
+	if (file == NULL)
+		return -1;
+
+	if (fseek(file, 0, SEEK_END) == 0)
+		size = ftell(file);
+	fclose(file);
+	return size;
+}
+
+/**
+ * Checks whether two boards of the same dimensions hold the same values and have the same
+ * fixed cells.
+ *
+ * @param board1 		[in] The first board
+ * @param board2 		[in] The second board
+ * @return true 		iff the boards are equal
+ * @return false 		otherwise
+ */
+bool areBenchmarkBoardsEqual(const Board* board1, const Board* board2) {
+	int MN2 = getBoardSize_MN2(board1);
+	int index = 0;
+
+	if ((board1->numRowsInBlock_M != board2->numRowsInBlock_M) || (board1->numColumnsInBlock_N != board2->numColumnsInBlock_N))
+		return false;
+
+	for (index = 0; index < MN2; index++)
+		if ((getBoardCellValue(&(board1->cells[index])) != getBoardCellValue(&(board2->cells[index]))) ||
+			(isBoardCellFixed(&(board1->cells[index])) != isBoardCellFixed(&(board2->cells[index]))))
+			return false;
+
+	return true;
+}
+
+/**
+ * Benchmark saving a board to a file and loading it back, in the format the file's path
+ * selects, and check that the board loaded is the board saved.
+ *
+ * @param dimensions 	[in] The dimensions of the board
+ * @param board 		[in] The board to be saved
+ * @param filePath 		[in] Path to the file the board is saved to
+ * @param formatName 	[in] The name to report the results under
+ * @return true 		iff the procedure was successful
+ * @return false 		iff the board could not be saved or loaded back
+ */
+bool benchmarkBoardFileFormat(const BenchmarkBoardFileDimensions* dimensions, const Board* board, char* filePath, const char* formatName) {
+	double saveSeconds = 0, loadSeconds = 0;
+	int numRuns = 0;
+	bool success = true;
+
+	do {
+		Board loadedBoard = {0};
+		double start = getBenchmarkSeconds();
+		if (saveBoardToFile(filePath, board) != 0)
+			return false;
+		saveSeconds += getBenchmarkSeconds() - start;
+
+		start = getBenchmarkSeconds();
+		if (loadBoardFromFile(filePath, &loadedBoard) != 0)
+			return false;
+		loadSeconds += getBenchmarkSeconds() - start;
+
+		success = areBenchmarkBoardsEqual(board, &loadedBoard);
+		cleanupBoard(&loadedBoard);
+		numRuns++;
+	} while (success && (saveSeconds + loadSeconds < BENCHMARK_MIN_SECONDS));
+
+	if (success)
+		printf("%-16s %-14s %12ld %12.6f %12.6f\n", dimensions->name, formatName, getBenchmarkFileSize(filePath),
+			   saveSeconds / numRuns, loadSeconds / numRuns);
+	remove(filePath);
+	return success;
+}
+
+/**
+ * Benchmark the board file formats on boards of growing sizes.
+ *
+ * @return true 		iff the procedure was successful
+ * @return false 		otherwise
+ */
+bool benchmarkBoardFileFormats() {
+	const BenchmarkBoardFileDimensions* dimensions = NULL;
+
+	printf("%-16s %-14s %12s %12s %12s\n", "board", "format", "bytes", "save", "load");
+	for (dimensions = benchmarkBoardFileDimensions; dimensions->name != NULL; dimensions++) {
+		Board board = {0};
+		bool success = true;
+
+		if (!createPatternBenchmarkBoard(dimensions, &board))
+			return false;
+
+		success = benchmarkBoardFileFormat(dimensions, &board, BENCHMARK_TEXT_BOARD_FILE_PATH, "text") &&
+				  benchmarkBoardFileFormat(dimensions, &board, BENCHMARK_BINARY_BOARD_FILE_PATH, "binary");
+
+		cleanupBoard(&board);
+		if (!success)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Relabel the values of a board's filled cells, shifting each by one, so that successive
+ * puzzles of a benchmark corpus differ.
+ *
+ * @param board 		[in, out] The board to be relabeled
+ */
+void relabelBenchmarkBoard(Board* board) {
+	int MN = getBoardBlockSize_MN(board);
+	int MN2 = getBoardSize_MN2(board);
+	int index = 0;
+
+	for (index = 0; index < MN2; index++)
+		if (board->cells[index].value != EMPTY_CELL_VALUE)
+			board->cells[index].value = (board->cells[index].value % MN) + 1;
+}
+
+/**
+ * Benchmark writing a corpus of puzzles in a corpus format and streaming it back, and
+ * check that every puzzle was read back.
+ *
+ * @param board 		[in, out] The puzzle the corpus is made of, relabeled from one
+ * 						puzzle to the next
+ * @param format 		[in] The format of the corpus
+ * @param formatName 	[in] The name to report the results under
+ * @return true 		iff the procedure was successful
+ * @return false 		iff the corpus could not be written or read back
+ */
+bool benchmarkPuzzleCorpusFormat(Board* board, PuzzleCorpusFormat format, const char* formatName) {
+	PuzzleCorpusWriter* writer = NULL;
+	PuzzleCorpusReader* reader = NULL;
+	Board readBoard = {0};
+	ReadPuzzleFromCorpusErrorCode readErrorCode = 0;
+	double writeSeconds = 0, readSeconds = 0, start = 0;
+	int numPuzzlesRead = 0;
+	int i = 0;
+	bool success = true;
+
+	start = getBenchmarkSeconds();
+	writer = openPuzzleCorpusWriter(BENCHMARK_CORPUS_FILE_PATH, format);
+	if (writer == NULL)
+		return false;
+	for (i = 0; (i < BENCHMARK_CORPUS_NUM_PUZZLES) && success; i++) {
+		relabelBenchmarkBoard(board);
+		success = writePuzzleToCorpus(writer, board);
+	}
+	success = closePuzzleCorpusWriter(writer) && success;
+	writeSeconds = getBenchmarkSeconds() - start;
+
+	start = getBenchmarkSeconds();
+	reader = openPuzzleCorpusReader(BENCHMARK_CORPUS_FILE_PATH);
+	success = success && (reader != NULL);
+	while (success && ((readErrorCode = readPuzzleFromCorpus(reader, &readBoard)) == 0))
+		numPuzzlesRead++;
+	closePuzzleCorpusReader(reader);
+	readSeconds = getBenchmarkSeconds() - start;
+
+	success = success && (readErrorCode == READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES) &&
+			  (numPuzzlesRead == BENCHMARK_CORPUS_NUM_PUZZLES) && areBenchmarkBoardsEqual(board, &readBoard);
+	if (success)
+		printf("%-16s %-14s %12ld %12.0f %12.0f\n", "corpus", formatName, getBenchmarkFileSize(BENCHMARK_CORPUS_FILE_PATH),
+			   BENCHMARK_CORPUS_NUM_PUZZLES / writeSeconds, BENCHMARK_CORPUS_NUM_PUZZLES / readSeconds);
+
+	cleanupBoard(&readBoard);
+	remove(BENCHMARK_CORPUS_FILE_PATH);
+	return success;
+}
+
+/**
+ * Benchmark the corpus formats on a corpus of 9x9 puzzles.
+ *
+ * @return true 		iff the procedure was successful
+ * @return false 		otherwise
+ */
+bool benchmarkPuzzleCorpusFormats() {
+	Board board = {0};
+	bool success = true;
+
+	if (!createBenchmarkBoard(&(benchmarkPuzzles[0]), &board))
+		return false;
+
+	printf("%-16s %-14s %12s %12s %12s\n", "board", "format", "bytes", "writes/s", "reads/s");
+	success = benchmarkPuzzleCorpusFormat(&board, PUZZLE_CORPUS_FORMAT_BLOCK, "block") &&
+			  benchmarkPuzzleCorpusFormat(&board, PUZZLE_CORPUS_FORMAT_LINE, "line");
+
+	cleanupBoard(&board);
+	return success;
+}
+
+int main(int argc, char** argv) {
+	const BenchmarkPuzzle* puzzle = NULL;
+	int numThreads = getDefaultNumSolverThreads();
+	int splitDepth = 0;
+
+	if (argc > 1)
+		numThreads = atoi(argv[1]);
+	if ((numThreads < 1) || (numThreads > PARALLEL_SOLVER_MAX_NUM_THREADS)) {
+		printf("Error: number of threads must be between 1 and %d\n", PARALLEL_SOLVER_MAX_NUM_THREADS);
+		return 1;
+	}
+
+	if (argc > 2) {
+		splitDepth = atoi(argv[2]);
+		if (splitDepth < 1) {
+			printf("Error: split depth must be a positive integer\n");
+			return 1;
+		}
+	}
+
+	printf("threads: %d\n", numThreads);
+	if (splitDepth > 0)
+		printf("split depth: %d\n", splitDepth);
+	printf("%-16s %-14s %12s %14s %12s %14s\n", "puzzle", "engine", "solutions", "nodes", "seconds", "nodes/second");
+	for (puzzle = benchmarkPuzzles; puzzle->name != NULL; puzzle++) {
+		Board board = {0};
+		bool success = true;
+
+		if (!createBenchmarkBoard(puzzle, &board)) {
+			printf("Error: memory allocation failure\n");
+			return 1;
+		}
+
+		if (puzzle->isOrderedSearchFeasible)
+			success = benchmarkBacktrackSolver(puzzle, &board, BACKTRACK_SOLVER_METHOD_ORDERED, 0, "bt-ordered");
+		success = success && benchmarkBacktrackSolver(puzzle, &board, BACKTRACK_SOLVER_METHOD_MRV, 0, "bt-mrv");
+		success = success && benchmarkBacktrackSolver(puzzle, &board, BACKTRACK_SOLVER_METHOD_MRV, BENCHMARK_UNIQUENESS_MAX_NUM_SOLUTIONS, "bt-mrv-unique");
+		success = success && benchmarkDancingLinksSolver(puzzle, &board);
+		success = success && benchmarkParallelSolver(puzzle, &board, numThreads, splitDepth);
+
+		cleanupBoard(&board);
+		if (!success) {
+			printf("Error: memory allocation failure\n");
+			return 1;
+		}
+	}
+
+	if (!benchmarkBoardFileFormats()) {
+		printf("Error: board files could not be saved or loaded\n");
+		return 1;
+	}
+
+	if (!benchmarkPuzzleCorpusFormats()) {
+		printf("Error: puzzle corpus could not be written or read\n");
+		return 1;
+	}
+
+	cleanupBoardGeometries();
+	return 0;
+}
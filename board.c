@@ -1,9 +1,12 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <limits.h>
 
 #include "board.h"
 
 #include "LP_solver.h"
+#include "BT_solver.h"
 
 #define UNUSED(x) (void)(x)
 
@@ -12,6 +15,20 @@
 #define FIXED_CELL_MARKER_IN_FILE ('.')
 #define EMPTY_CELL_VALUE_IN_FILE (0)
 
+#define BINARY_BOARD_FILE_MARKER ("SDKB")
+#define BINARY_BOARD_FILE_MARKER_LENGTH (4)
+#define BINARY_BOARD_FILE_VERSION (1)
+#define BINARY_BOARD_FILE_VERSION_OFFSET (4)
+#define BINARY_BOARD_FILE_FLAGS_OFFSET (5)
+#define BINARY_BOARD_FILE_M_OFFSET (8)
+#define BINARY_BOARD_FILE_N_OFFSET (12)
+#define BINARY_BOARD_FILE_DIMENSION_SIZE (4)
+#define BINARY_BOARD_FILE_HEADER_SIZE (16)
+#define BINARY_BOARD_FILE_FLAG_WIDE_VALUES (0x01)
+#define BINARY_BOARD_FILE_MAX_NARROW_VALUE (255)
+
+#define READ_ENTIRE_FILE_DEFAULT_CAPACITY (4096)
+
 #define BLOCK_SEPARATOR ('|')
 #define SPACE_CHARACTER (' ')
 #define EMPTY_CELL_STRING ("  ")
@@ -46,11 +63,11 @@ void getRowBasedIDGivenRowBasedID(const Board* board, int rowIn, int indexInRowI
 }
 
 const Cell* viewBoardCellByRow(const Board* board, int row, int index) {
-	return &(board->cells[row][index]);
+	return &(board->cells[row * getBoardBlockSize_MN(board) + index]);
 }
 
 Cell* getBoardCellByRow(Board* board, int row, int index) {
-	return &(board->cells[row][index]);
+	return &(board->cells[row * getBoardBlockSize_MN(board) + index]);
 }
 
 void getRowBasedIDGivenColumnBasedID(const Board* board, int column, int indexInColumn, int* row, int* indexInRow) {
@@ -61,25 +78,19 @@ void getRowBasedIDGivenColumnBasedID(const Board* board, int column, int indexIn
 }
 
 const Cell* viewBoardCellByColumn(const Board* board, int column, int index) {
-	int row = 0, indexInRow = 0;
-	getRowBasedIDGivenColumnBasedID(board, column, index, &row, &indexInRow);
-	return viewBoardCellByRow(board, row, indexInRow);
+	return &(board->cells[index * getBoardBlockSize_MN(board) + column]);
 }
 
 Cell* getBoardCellByColumn(Board* board, int column, int index) {
-	int row = 0, indexInRow = 0;
-	getRowBasedIDGivenColumnBasedID(board, column, index, &row, &indexInRow);
-	return getBoardCellByRow(board, row, indexInRow);
+	return &(board->cells[index * getBoardBlockSize_MN(board) + column]);
 }
 
 void getRowBasedIDGivenBlockBasedID(const Board* board, int block, int indexInBlock, int* row, int* indexInRow) {
-	int colInBlocksMatrix = block % board->numRowsInBlock_M;
-	int rowInBlocksMatrix = block / board->numRowsInBlock_M;
-	int colInBlock = indexInBlock % board->numColumnsInBlock_N;
-	int rowInBlock = indexInBlock / board->numColumnsInBlock_N;
+	const BoardGeometry* geometry = board->geometry;
+	int cell = geometry->categoriesCells[BOARD_CATEGORY_BLOCK][block * geometry->MN + indexInBlock];
 
-	*row = rowInBlocksMatrix * board->numRowsInBlock_M + rowInBlock;
-	*indexInRow = colInBlocksMatrix * board->numColumnsInBlock_N + colInBlock;
+	*row = geometry->cellsCategories[BOARD_CATEGORY_ROW][cell];
+	*indexInRow = geometry->cellsCategories[BOARD_CATEGORY_COLUMN][cell];
 }
 
 void getColumnBasedIDGivenRowBasedID(const Board* board, int row, int indexInRow, int* column, int* indexInColumn) {
@@ -90,30 +101,23 @@ void getColumnBasedIDGivenRowBasedID(const Board* board, int row, int indexInRow
 }
 
 void getBlockBasedIDGivenRowBasedID(const Board* board, int row, int indexInRow, int* block, int* indexInBlock) {
-	int rowInBlock = row % board->numRowsInBlock_M;
-	int columnInBlock = indexInRow % board->numColumnsInBlock_N;
-	*indexInBlock = (rowInBlock * board->numColumnsInBlock_N) + columnInBlock;
+	const BoardGeometry* geometry = board->geometry;
+	int cell = row * geometry->MN + indexInRow;
 
-	*block = whichBlock(board, row, indexInRow);
+	*block = geometry->cellsCategories[BOARD_CATEGORY_BLOCK][cell];
+	*indexInBlock = geometry->cellsIndicesInCategories[BOARD_CATEGORY_BLOCK][cell];
 }
 
 const Cell* viewBoardCellByBlock(const Board* board, int block, int index) {
-	int row = 0, indexInRow = 0;
-	getRowBasedIDGivenBlockBasedID(board, block, index, &row, &indexInRow);
-	return viewBoardCellByRow(board, row, indexInRow);
+	return &(board->cells[board->geometry->categoriesCells[BOARD_CATEGORY_BLOCK][block * board->geometry->MN + index]]);
 }
 
 Cell* getBoardCellByBlock(Board* board, int block, int index) {
-	int row = 0, indexInRow = 0;
-	getRowBasedIDGivenBlockBasedID(board, block, index, &row, &indexInRow);
-	return getBoardCellByRow(board, row, indexInRow);
+	return &(board->cells[board->geometry->categoriesCells[BOARD_CATEGORY_BLOCK][block * board->geometry->MN + index]]);
 }
 
 int whichBlock(const Board* board, int row, int col) {
-	int colInBlocksMatrix = col / board->numColumnsInBlock_N;
-	int rowInBlocksMatrix = row / board->numRowsInBlock_M;
-
-	return rowInBlocksMatrix * board->numRowsInBlock_M + colInBlocksMatrix;
+	return board->geometry->cellsCategories[BOARD_CATEGORY_BLOCK][row * board->geometry->MN + col];
 }
 
 bool getNextEmptyBoardCell(const Board* board, int row, int col, int* outRow, int* outCol) {
@@ -163,37 +167,31 @@ void setBoardCellErroneousness(Cell* cell, bool isErroneous) {
 }
 
 void cleanupBoard(Board* boardInOut) {
-	int MN = getBoardBlockSize_MN(boardInOut);
-
 	if (boardInOut->cells != NULL) {
-		 int row = 0;
-		 for (row = 0; row < MN; row++) {
-			 if (boardInOut->cells[row] != NULL) {
-				 free(boardInOut->cells[row]);
-				 boardInOut->cells[row] = NULL;
-			 }
-		 }
-		 free(boardInOut->cells);
-		 boardInOut->cells = NULL;
+		free(boardInOut->cells);
+		boardInOut->cells = NULL;
 	}
+	boardInOut->geometry = NULL; /* Note: geometries are shared, and are freed by cleanupBoardGeometries */
 }
 
 bool createEmptyBoard(Board* boardInOut) {
-	int MN = getBoardBlockSize_MN(boardInOut);
-	boardInOut->cells = calloc(MN, sizeof(Cell*));
-	if (boardInOut->cells != NULL) {
-		int row = 0;
-		for (row = 0; row < MN; row++) {
-			boardInOut->cells[row] = calloc(MN, sizeof(Cell));
-			if (boardInOut->cells[row] == NULL)
-				break;
+	const BoardGeometry* geometry = boardInOut->geometry;
+
+	if ((geometry == NULL) ||
+		(geometry->numRowsInBlock_M != boardInOut->numRowsInBlock_M) ||
+		(geometry->numColumnsInBlock_N != boardInOut->numColumnsInBlock_N)) {
+		geometry = getBoardGeometry(boardInOut->numRowsInBlock_M, boardInOut->numColumnsInBlock_N);
+		if (geometry == NULL) {
+			boardInOut->cells = NULL;
+			return false;
 		}
-		if (row == MN)
-			return true;
 	}
+	boardInOut->geometry = geometry;
 
-	cleanupBoard(boardInOut);
-	return false;
+	/* Note: calloc returns memory suitably aligned for any fundamental type, so the
+	 * single cells buffer needs no extra alignment work */
+	boardInOut->cells = calloc(getBoardSize_MN2(boardInOut), sizeof(Cell));
+	return boardInOut->cells != NULL;
 }
 
 int countNumEmptyCells(const Board* board) {
@@ -258,59 +256,44 @@ int** allocateNewSpecificCellsValuesCounters(const Board* board) {
 	return cellsValuesCounters;
 }
 
-/**
- * Update an array of counters according to a particular row, column or block.
- * 
- * @param categoryNoCellsValuesCounters 	[in, out] A pointer to the array to be filled 
- * 											according to the situation in that category
- * @param board 							[in] The board to be examined
- * @param categoryNo 						[in] The number of row, column or block to be checked
- * @param getCellFunc 						[in] A pointer to one of the getCellsByCategoryFunc functions which 
- * 											will be used to traverse the cells in the category
- */
-void updateCellsValuesCountersInCategory(int* categoryNoCellsValuesCounters, const Board* board, int categoryNo, viewCellsByCategoryFunc getCellFunc) {
-	int MN = getBoardBlockSize_MN(board);
-	int index = 0;
+int** createCellsValuesCountersByCategory(const Board* board, BoardCategory category) {
+	int** cellsValuesCounters = NULL;
 
-	for (index = 0; index < MN; index++) {
-		const Cell* cell = getCellFunc(board, categoryNo, index);
-		if (!isBoardCellEmpty(cell)) {
-			int value = getBoardCellValue(cell);
-			categoryNoCellsValuesCounters[value]++;
-		}
-	}
-}
+	cellsValuesCounters = allocateNewSpecificCellsValuesCounters(board);
+	if (cellsValuesCounters != NULL) {
+		const int* cellsCategories = board->geometry->cellsCategories[category];
+		int MN2 = getBoardSize_MN2(board);
+		int cell = 0;
 
-/**
- * Update a counter matrix of all the rows, columns or blocks.
- *  
- * @param categoryCellsValuesCounters 	[in, out] A pointer to the array to be filled 
- * 										according to the situation in that category
- * @param board 						[in] The board to be examined
- * @param getCellFunc 					[in] A pointer to one of the getCellsByCategoryFunc functions which 
- * 										will be used to traverse the cells in the category
- */
-void updateCellsValuesCountersByCategory(int** categoryCellsValuesCounters, const Board* board, viewCellsByCategoryFunc getCellFunc) {
-	int numCategories = getBoardBlockSize_MN(board);
-	int categoryIndex = 0;
+		for (cell = 0; cell < MN2; cell++)
+			if (!isBoardCellEmpty(&(board->cells[cell])))
+				cellsValuesCounters[cellsCategories[cell]][getBoardCellValue(&(board->cells[cell]))]++;
+	}
 
-	for (categoryIndex = 0; categoryIndex < numCategories; categoryIndex++)
-		updateCellsValuesCountersInCategory(categoryCellsValuesCounters[categoryIndex], board, categoryIndex, getCellFunc);
+	return cellsValuesCounters;
 }
 
-int** createCellsValuesCountersByCategory(const Board* board, viewCellsByCategoryFunc getCellFunc) {
-	int** cellsValuesCounters = NULL;
+int** createCellsValuesIndicesSumsByCategory(const Board* board, BoardCategory category) {
+	int** cellsValuesIndicesSums = NULL;
 
-	cellsValuesCounters = allocateNewSpecificCellsValuesCounters(board);
-	if (cellsValuesCounters != NULL) {
-		updateCellsValuesCountersByCategory(cellsValuesCounters, board, getCellFunc);
+	cellsValuesIndicesSums = allocateNewSpecificCellsValuesCounters(board);
+	if (cellsValuesIndicesSums != NULL) {
+		const int* cellsCategories = board->geometry->cellsCategories[category];
+		const int* cellsIndicesInCategory = board->geometry->cellsIndicesInCategories[category];
+		int MN2 = getBoardSize_MN2(board);
+		int cell = 0;
+
+		for (cell = 0; cell < MN2; cell++)
+			if (!isBoardCellEmpty(&(board->cells[cell])))
+				cellsValuesIndicesSums[cellsCategories[cell]][getBoardCellValue(&(board->cells[cell]))] += cellsIndicesInCategory[cell];
 	}
 
-	return cellsValuesCounters;
+	return cellsValuesIndicesSums;
 }
 
-bool checkErroneousCellsInCategory(const Board* board, int categoryNo, viewCellsByCategoryFunc getCellFunc, bool* outErroneous) {
+bool checkErroneousCellsInCategory(const Board* board, BoardCategory category, int categoryNo, bool* outErroneous) {
 	int MN = getBoardBlockSize_MN(board);
+	const int* categoryCells = board->geometry->categoriesCells[category] + categoryNo * MN;
 	int index = 0;
 
 	int* valuesCounters = calloc(MN + 1, sizeof(int));
@@ -319,17 +302,10 @@ bool checkErroneousCellsInCategory(const Board* board, int categoryNo, viewCells
 
 	*outErroneous = false;
 	for (index = 0; index < MN; index++) {
-		const Cell* cell = getCellFunc(board, categoryNo, index);
+		const Cell* cell = &(board->cells[categoryCells[index]]);
 		if (!isBoardCellEmpty(cell)) {
 			int value = getBoardCellValue(cell);
 			valuesCounters[value]++;
-		}
-	}
-
-	for (index = 0; index < MN; index++) {
-		const Cell* cell = getCellFunc(board, categoryNo, index);
-		if (!isBoardCellEmpty(cell)) {
-			int value = getBoardCellValue(cell);
 			if (valuesCounters[value] > 1) {
 				*outErroneous = true;
 				break;
@@ -341,33 +317,46 @@ bool checkErroneousCellsInCategory(const Board* board, int categoryNo, viewCells
 	return true;
 }
 
-bool checkErroneousCellsByCategory(const Board* board, viewCellsByCategoryFunc getCellFunc, bool* outErroneous) {
+/**
+ * Check if there exist erroneous cells in any row, any column, or any block, specified by category type.
+ * 
+ * @param board 			[in] The board to be examined
+ * @param category 			[in] The category (row, column or block) to be scanned
+ * @param outErroneous 		[in, out] A pointer to be boolean to be set to true iff there exist
+ * 							errors in that category
+ * @return true 			iff the procedure was successful
+ * @return false 			iff a memory error occurred during the check process
+ */
+bool checkErroneousCellsByCategory(const Board* board, BoardCategory category, bool* outErroneous) {
 	int numCategories = getBoardBlockSize_MN(board);
 	int index = 0;
 
-	for (index = 0; index < numCategories; index++)
-		if (!checkErroneousCellsInCategory(board, index, getCellFunc, outErroneous))
+	for (index = 0; index < numCategories; index++) {
+		if (!checkErroneousCellsInCategory(board, category, index, outErroneous))
 			return false;
+		if (*outErroneous)
+			break;
+	}
 
 	return true;
 }
 
 bool checkErroneousCells(const Board* board, bool* outErroneous) {
-	if (!checkErroneousCellsByCategory(board, viewBoardCellByRow, outErroneous))
+	if (!checkErroneousCellsByCategory(board, BOARD_CATEGORY_ROW, outErroneous))
 		return false;
 
-	if (outErroneous) {
+	if (*outErroneous) {
 		return true;
 	}
 
-	if (!checkErroneousCellsByCategory(board, viewBoardCellByColumn, outErroneous))
+	if (!checkErroneousCellsByCategory(board, BOARD_CATEGORY_COLUMN, outErroneous))
 			return false;
 
-	if (outErroneous) {
+	if (*outErroneous) {
 		return true;
 	}
 
-	if (!checkErroneousCellsByCategory(board, viewBoardCellByBlock, outErroneous))
+	if (!checkErroneousCellsByCategory(board, BOARD_CATEGORY_BLOCK, outErroneous))
 			return false;
 
 	return true;
@@ -377,14 +366,14 @@ bool checkErroneousCells(const Board* board, bool* outErroneous) {
  * type and index within it. Each erroneous cell's isErroneous marker as a consequence.
  *
  * @param board 			[in, out] Board to whose cells' erroneousness status will be updated
+ * @param category 			[in] The category (row, column or block) to be searched
  * @param categoryNo 		[in] The row, column or block number to be searched for errors	
- * @param getCellFunc 		[in] A pointer to one of the viewCellsByCategoryFunc functions which 
- * 							will be used to traverse the cells in the category	
  * @return true 			iff the procedure was successful
  * @return false 			iff a memory error has occurred during the process
  */
-bool findErroneousCellsInCategory(Board* board, int categoryNo, getCellsByCategoryFunc getCellFunc) {
+bool findErroneousCellsInCategory(Board* board, BoardCategory category, int categoryNo) {
 	int MN = getBoardBlockSize_MN(board);
+	const int* categoryCells = board->geometry->categoriesCells[category] + categoryNo * MN;
 	int index = 0;
 
 	int* valuesCounters = calloc(MN + 1, sizeof(int));
@@ -392,7 +381,7 @@ bool findErroneousCellsInCategory(Board* board, int categoryNo, getCellsByCatego
 		return false;
 
 	for (index = 0; index < MN; index++) {
-		Cell* cell = getCellFunc(board, categoryNo, index);
+		Cell* cell = &(board->cells[categoryCells[index]]);
 		if (!isBoardCellEmpty(cell)) {
 			int value = getBoardCellValue(cell);
 			valuesCounters[value]++;
@@ -400,7 +389,7 @@ bool findErroneousCellsInCategory(Board* board, int categoryNo, getCellsByCatego
 	}
 
 	for (index = 0; index < MN; index++) {
-		Cell* cell = getCellFunc(board, categoryNo, index);
+		Cell* cell = &(board->cells[categoryCells[index]]);
 		if (!isBoardCellEmpty(cell)) {
 			int value = getBoardCellValue(cell);
 			if (valuesCounters[value] > 1)
@@ -416,17 +405,16 @@ bool findErroneousCellsInCategory(Board* board, int categoryNo, getCellsByCatego
  * Find and mark all erroneous cells by row, column or block in the provided board. 
  * 
  * @param board 			[in, out] Board to whose cells' erroneousness status will be updated
- * @param getCellFunc 		[in] A pointer to one of the viewCellsByCategoryFunc functions which 
- * 							will be used to traverse the cells in the category	
+ * @param category 			[in] The category (row, column or block) to be searched
  * @return true 			iff the procedure was successful
  * @return false 			iff a memory error has occurred during the process
  */
-bool findErroneousCellsByCategory(Board* board, getCellsByCategoryFunc getCellFunc) {
+bool findErroneousCellsByCategory(Board* board, BoardCategory category) {
 	int numCategories = getBoardBlockSize_MN(board);
 	int index = 0;
 
 	for (index = 0; index < numCategories; index++)
-		if (!findErroneousCellsInCategory(board, index, getCellFunc))
+		if (!findErroneousCellsInCategory(board, category, index))
 			return false;
 
 	return true;
@@ -440,43 +428,33 @@ bool findErroneousCellsByCategory(Board* board, getCellsByCategoryFunc getCellFu
  * @return false 			iff a memory error has occurred during the process
  */
 bool findErroneousCells(Board* board) {
-	if (!findErroneousCellsByCategory(board, getBoardCellByRow))
+	if (!findErroneousCellsByCategory(board, BOARD_CATEGORY_ROW))
 		return false;
 
-	if (!findErroneousCellsByCategory(board, getBoardCellByColumn))
+	if (!findErroneousCellsByCategory(board, BOARD_CATEGORY_COLUMN))
 			return false;
 
-	if (!findErroneousCellsByCategory(board, getBoardCellByBlock))
+	if (!findErroneousCellsByCategory(board, BOARD_CATEGORY_BLOCK))
 			return false;
 
 	return true;
 }
 
 bool copyBoard(const Board* boardIn, Board* boardOut) {
-	int row = 0;
-	int col = 0;
-	int MN = 0;
-
 	boardOut->numRowsInBlock_M = boardIn->numRowsInBlock_M;
 	boardOut->numColumnsInBlock_N = boardIn->numColumnsInBlock_N;
+	boardOut->geometry = boardIn->geometry; /* Note: so that copying never has to look the geometry up */
 	if (!createEmptyBoard(boardOut)) {
 		return false;
 	}
 
-	MN = getBoardBlockSize_MN(boardOut);
-
-	for (row = 0; row < MN; row++)
-		for (col = 0; col < MN; col++) {
-			Cell* cellOut = getBoardCellByRow(boardOut, row, col);
-			const Cell* cellIn = viewBoardCellByRow(boardIn, row, col);
-			*cellOut = *cellIn;
-		}
+	memcpy(boardOut->cells, boardIn->cells, getBoardSize_MN2(boardIn) * sizeof(Cell));
 
 	return true;
 }
 
 void setBoardCellValue(Board* board, int row, int col, int value) {
-	board->cells[row][col].value = value;
+	getBoardCellByRow(board, row, col)->value = value;
 }
 
 void cleanupBoardCellLegalValuesStruct(CellLegalValues* cellLegalValues) {
@@ -492,270 +470,680 @@ void cleanupBoardCellLegalValuesStruct(CellLegalValues* cellLegalValues) {
 }
 
 /**
- * Check if a particular value is valid for a particular cell, with regard to its row, 
- * column or block.
+ * Check if a particular value is valid for a particular cell, with regard to one of its
+ * categories: its row, column or block. 
  * 
  * @param boardIn 		[in] The board to be examined
- * @param row 			[in] The row in which the cell is located
- * @param col 			[in] The column in which the cell is located
+ * @param category 		[in] The category (row, column or block) to be checked
+ * @param cell 			[in] The index of the cell
  * @param value 		[in] The value whose validity for that cell is evaluated
- * @param getCellFunc 	[in] A pointer to one of the viewCellsByCategoryFunc which will be used
- * 						to go over the cells in that cell's category
- * @param switchIDFunc  [in] A pointer to one of the getCategory1BasedIDByCategory2BasedIDFunc
- * 						functions which will be used to transform the indices of cells for 
- * 						traversal of the category
  * @return true 		iff no other cell in that row, column or block shares the input value
  * @return false 		iff the input value is invalid for that cell
  */
-bool isValueLegalForBoardCellInCategory(const Board* boardIn, int row, int col, int value, viewCellsByCategoryFunc getCellFunc, getCategory1BasedIDByCategory2BasedIDFunc switchIDFunc) {
-	int MN = getBoardBlockSize_MN(boardIn);
-	int cellCategoryNo = 0;
-	int cellIndexInCategory = 0;
+bool isValueLegalForBoardCellInCategory(const Board* boardIn, BoardCategory category, int cell, int value) {
+	const BoardGeometry* geometry = boardIn->geometry;
+	const int* categoryCells = geometry->categoriesCells[category] + geometry->cellsCategories[category][cell] * geometry->MN;
 	int index = 0;
 
-	switchIDFunc(boardIn, row, col, &cellCategoryNo, &cellIndexInCategory);
-
-	index = 0;
-	for (index = 0; index < MN; index++) {
-		const Cell* curCell = NULL;
-		if (index == cellIndexInCategory)
-			continue;
-		curCell = getCellFunc(boardIn, cellCategoryNo, index);
-		if (!isBoardCellEmpty(curCell)) {
-			if (getBoardCellValue(curCell) == value)
-				return false;
-		}
-	}
+	for (index = 0; index < geometry->MN; index++)
+		if ((categoryCells[index] != cell) && (boardIn->cells[categoryCells[index]].value == value))
+			return false;
 
 	return true;
 }
 
 bool isValueLegalForBoardCell(const Board* boardIn, int row, int col, int value) {
-	return isValueLegalForBoardCellInCategory(boardIn, row, col, value, viewBoardCellByRow, getRowBasedIDGivenRowBasedID) &&
-		   isValueLegalForBoardCellInCategory(boardIn, row, col, value, viewBoardCellByColumn, getColumnBasedIDGivenRowBasedID) &&
-		   isValueLegalForBoardCellInCategory(boardIn, row, col, value, viewBoardCellByBlock, getBlockBasedIDGivenRowBasedID);
+	const BoardGeometry* geometry = boardIn->geometry;
+	int cell = row * geometry->MN + col;
+	const int* peers = NULL;
+	int index = 0;
+
+	if (geometry->cellsPeers == NULL)
+		return isValueLegalForBoardCellInCategory(boardIn, BOARD_CATEGORY_ROW, cell, value) &&
+			   isValueLegalForBoardCellInCategory(boardIn, BOARD_CATEGORY_COLUMN, cell, value) &&
+			   isValueLegalForBoardCellInCategory(boardIn, BOARD_CATEGORY_BLOCK, cell, value);
+
+	peers = geometry->cellsPeers + cell * geometry->numPeers;
+	for (index = 0; index < geometry->numPeers; index++)
+		if (boardIn->cells[peers[index]].value == value)
+			return false;
+
+	return true;
+}
+
+int getNumCandidateSetWords(const Board* board) {
+	return (getBoardBlockSize_MN(board) + CANDIDATE_SET_WORD_NUM_BITS - 1) / CANDIDATE_SET_WORD_NUM_BITS;
+}
+
+/**
+ * Get the single-bit mask that represents a value within its candidate set word.
+ * 
+ * @param value 						[in] The value whose bit is requested
+ * @return CandidateSetWord The mask of that value
+ */
+CandidateSetWord getCandidateSetValueBit(int value) {
+	return ((CandidateSetWord)1) << ((value - 1) % CANDIDATE_SET_WORD_NUM_BITS);
+}
+
+/**
+ * Get the index of the candidate set word in which a value is represented.
+ * 
+ * @param value 		[in] The value whose word is requested
+ * @return int 			The index of the word
+ */
+int getCandidateSetValueWordIndex(int value) {
+	return (value - 1) / CANDIDATE_SET_WORD_NUM_BITS;
+}
+
+/**
+ * Get the mask of all the legal values (1 to MN) represented in a particular word of a
+ * candidate set.
+ * 
+ * @param MN 								[in] The number of cells in a block of the board
+ * @param wordIndex 				[in] The index of the word within the set
+ * @return CandidateSetWord The mask of all the values represented in that word
+ */
+CandidateSetWord getCandidateSetWordFullMask(int MN, int wordIndex) {
+	int numValuesInWord = MN - wordIndex * CANDIDATE_SET_WORD_NUM_BITS;
+
+	if (numValuesInWord >= CANDIDATE_SET_WORD_NUM_BITS)
+		return ~((CandidateSetWord)0);
+
+	return (((CandidateSetWord)1) << numValuesInWord) - 1;
+}
+
+/**
+ * Count the bits which are on in a single candidate set word.
+ * 
+ * @param word 			[in] The word to be examined
+ * @return int 			The number of bits on
+ */
+int countCandidateSetWordBits(CandidateSetWord word) {
+#ifdef __GNUC__
+	return __builtin_popcountl(word);
+#else
+	int numBits = 0;
+	while (word != 0) {
+		word &= word - 1;
+		numBits++;
+	}
+	return numBits;
+#endif
+}
+
+/**
+ * Find the index of the lowest bit which is on in a non-zero candidate set word.
+ * 
+ * @param word 			[in] The word to be examined, which must not be 0
+ * @return int 			The index of the lowest bit on
+ */
+int getLowestCandidateSetWordBitIndex(CandidateSetWord word) {
+#ifdef __GNUC__
+	return __builtin_ctzl(word);
+#else
+	int index = 0;
+	while ((word & 1) == 0) {
+		word >>= 1;
+		index++;
+	}
+	return index;
+#endif
+}
+
+bool isValueInCandidateSet(const CandidateSetWord* candidateSet, int value) {
+	return (candidateSet[getCandidateSetValueWordIndex(value)] & getCandidateSetValueBit(value)) != 0;
+}
+
+void addValueToCandidateSet(CandidateSetWord* candidateSet, int value) {
+	candidateSet[getCandidateSetValueWordIndex(value)] |= getCandidateSetValueBit(value);
+}
+
+void removeValueFromCandidateSet(CandidateSetWord* candidateSet, int value) {
+	candidateSet[getCandidateSetValueWordIndex(value)] &= ~getCandidateSetValueBit(value);
+}
+
+int countCandidateSetValues(const CandidateSetWord* candidateSet, int numWords) {
+	int numValues = 0;
+	int wordIndex = 0;
+
+	for (wordIndex = 0; wordIndex < numWords; wordIndex++)
+		numValues += countCandidateSetWordBits(candidateSet[wordIndex]);
+
+	return numValues;
+}
+
+int getNextValueInCandidateSet(const CandidateSetWord* candidateSet, int numWords, int value) {
+	int wordIndex = value / CANDIDATE_SET_WORD_NUM_BITS; /* Note: the word holding value + 1 */
+	CandidateSetWord word = 0;
+
+	if (wordIndex >= numWords)
+		return EMPTY_CELL_VALUE;
+
+	word = candidateSet[wordIndex] & ~((((CandidateSetWord)1) << (value % CANDIDATE_SET_WORD_NUM_BITS)) - 1);
+	while (word == 0) {
+		wordIndex++;
+		if (wordIndex >= numWords)
+			return EMPTY_CELL_VALUE;
+		word = candidateSet[wordIndex];
+	}
+
+	return wordIndex * CANDIDATE_SET_WORD_NUM_BITS + getLowestCandidateSetWordBitIndex(word) + 1;
+}
+
+/**
+ * Add the values of all the cells in one of the categories (row, column or block) of
+ * a particular cell, except for the cell itself, to a candidate set.
+ * 
+ * @param boardIn 				[in] The board to be examined
+ * @param category 				[in] The category (row, column or block) to be scanned
+ * @param cell 						[in] The index of the cell
+ * @param usedValuesInOut [in, out] The candidate set the values are added to
+ */
+void addCategoryValuesToCandidateSet(const Board* boardIn, BoardCategory category, int cell, CandidateSetWord* usedValuesInOut) {
+	const BoardGeometry* geometry = boardIn->geometry;
+	const int* categoryCells = geometry->categoriesCells[category] + geometry->cellsCategories[category][cell] * geometry->MN;
+	int index = 0;
+
+	for (index = 0; index < geometry->MN; index++) {
+		const Cell* curCell = &(boardIn->cells[categoryCells[index]]);
+		if ((categoryCells[index] != cell) && !isBoardCellEmpty(curCell))
+			addValueToCandidateSet(usedValuesInOut, getBoardCellValue(curCell));
+	}
 }
 
 bool fillBoardCellLegalValuesStruct(const Board* boardIn, int row, int col, CellLegalValues* cellLegalValuesInOut) {
 	int MN = getBoardBlockSize_MN(boardIn);
-	int value = 0;
+	int numWords = getNumCandidateSetWords(boardIn);
+	int cell = row * MN + col;
+	int category = 0;
+	int wordIndex = 0;
 
 	cellLegalValuesInOut->numLegalValues = 0;
-	cellLegalValuesInOut->legalValues = calloc(MN + 1, sizeof(bool));
+	cellLegalValuesInOut->legalValues = calloc(numWords, sizeof(CandidateSetWord));
 	if (cellLegalValuesInOut->legalValues == NULL)
 		return false;
 
-	for (value = 1; value <= MN; value++)
-		if (isValueLegalForBoardCell(boardIn, row, col, value)) {
-			cellLegalValuesInOut->legalValues[value] = true;
-			cellLegalValuesInOut->numLegalValues++;
-		}
+	for (category = 0; category < BOARD_NUM_CATEGORIES; category++)
+		addCategoryValuesToCandidateSet(boardIn, (BoardCategory)category, cell, cellLegalValuesInOut->legalValues);
+
+	for (wordIndex = 0; wordIndex < numWords; wordIndex++)
+		cellLegalValuesInOut->legalValues[wordIndex] = ~(cellLegalValuesInOut->legalValues[wordIndex]) & getCandidateSetWordFullMask(MN, wordIndex);
+	cellLegalValuesInOut->numLegalValues = countCandidateSetValues(cellLegalValuesInOut->legalValues, numWords);
 
 	return true;
 }
 
-bool getSuperficiallyLegalValuesForBoardCell(const Board* boardIn, int row, int col, CellLegalValues* cellLegalValuesInOut) {
-	bool retValue = true;
+void freeCellsLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues* cellsLegalValuesOut) {
+	UNUSED(boardIn);
 
-	if (!fillBoardCellLegalValuesStruct(boardIn, row, col, cellLegalValuesInOut)) {
-		cleanupBoardCellLegalValuesStruct(cellLegalValuesInOut);
-		retValue = false;
-	}
+	if (cellsLegalValuesOut != NULL)
+		free(cellsLegalValuesOut);
+}
 
-	return retValue;
+/**
+ * Mark a value as used in a particular row, column or block. The used values of each category
+ * member are held in two candidate sets: one of values used at least once, and one of values
+ * used more than once.
+ * 
+ * @param usedValues 			[in, out] The candidate set of values used in the category member
+ * @param duplicateValues [in, out] The candidate set of values used more than once in the
+ * 												category member
+ * @param value 					[in] The value being marked
+ */
+void markValueAsUsedInCategory(CandidateSetWord* usedValues, CandidateSetWord* duplicateValues, int value) {
+	if (isValueInCandidateSet(usedValues, value))
+		addValueToCandidateSet(duplicateValues, value);
+	else
+		addValueToCandidateSet(usedValues, value);
 }
 
-void freeCellsLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues** cellsLegalValuesOut) {
-	int MN = 0;
+/**
+ * Get a word of the candidate set of values used in a particular category member by cells other
+ * than a certain one.
+ * 
+ * @param usedValues 			[in] The candidate set of values used in the category member
+ * @param duplicateValues [in] The candidate set of values used more than once in the category
+ * 												member
+ * @param wordIndex 			[in] The index of the requested word within the set
+ * @param cellValue 			[in] The value of the cell to be disregarded
+ * @return CandidateSetWord The requested word of the values used by all other cells
+ */
+CandidateSetWord getCategoryValuesUsedByOtherCellsWord(const CandidateSetWord* usedValues, const CandidateSetWord* duplicateValues, int wordIndex, int cellValue) {
+	CandidateSetWord cellValueBit = 0;
+
+	if ((cellValue != EMPTY_CELL_VALUE) && (getCandidateSetValueWordIndex(cellValue) == wordIndex))
+		cellValueBit = getCandidateSetValueBit(cellValue);
+
+	return usedValues[wordIndex] & ~(cellValueBit & ~duplicateValues[wordIndex]);
+}
+
+bool getSuperficiallyLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues** cellsLegalValuesOut) {
+	CellLegalValues* cellsLegalValues = NULL;
+	CandidateSetWord* legalValuesWords = NULL;
+	CandidateSetWord* categoriesValues = NULL;
+	CandidateSetWord* rowsUsedValues = NULL, * columnsUsedValues = NULL, * blocksUsedValues = NULL;
+	CandidateSetWord* rowsDuplicateValues = NULL, * columnsDuplicateValues = NULL, * blocksDuplicateValues = NULL;
+	int MN = getBoardBlockSize_MN(boardIn);
+	int MN2 = getBoardSize_MN2(boardIn);
+	int numWords = getNumCandidateSetWords(boardIn);
+	int categorySetsSize = MN * numWords;
 	int row = 0, col = 0;
 
-	MN = getBoardBlockSize_MN(boardIn);
+	/* Note: the structs and the candidate sets they point to are allocated together */
+	cellsLegalValues = calloc(1, MN2 * (sizeof(CellLegalValues) + numWords * sizeof(CandidateSetWord)));
+	if (cellsLegalValues == NULL)
+		return false;
+	legalValuesWords = (CandidateSetWord*)(cellsLegalValues + MN2);
 
-	if (cellsLegalValuesOut == NULL)
-		return;
+	categoriesValues = calloc(6 * categorySetsSize, sizeof(CandidateSetWord));
+	if (categoriesValues == NULL) {
+		free(cellsLegalValues);
+		return false;
+	}
+	rowsUsedValues = categoriesValues;
+	columnsUsedValues = rowsUsedValues + categorySetsSize;
+	blocksUsedValues = columnsUsedValues + categorySetsSize;
+	rowsDuplicateValues = blocksUsedValues + categorySetsSize;
+	columnsDuplicateValues = rowsDuplicateValues + categorySetsSize;
+	blocksDuplicateValues = columnsDuplicateValues + categorySetsSize;
 
 	for (row = 0; row < MN; row++)
-		if (cellsLegalValuesOut[row] != NULL) {
-			for (col = 0; col < MN; col++)
-				cleanupBoardCellLegalValuesStruct(&(cellsLegalValuesOut[row][col]));
-			free(cellsLegalValuesOut[row]);
-			cellsLegalValuesOut[row] = NULL;
+		for (col = 0; col < MN; col++) {
+			const Cell* cell = viewBoardCellByRow(boardIn, row, col);
+			if (!isBoardCellEmpty(cell)) {
+				int value = getBoardCellValue(cell);
+				int block = whichBlock(boardIn, row, col);
+				markValueAsUsedInCategory(rowsUsedValues + row * numWords, rowsDuplicateValues + row * numWords, value);
+				markValueAsUsedInCategory(columnsUsedValues + col * numWords, columnsDuplicateValues + col * numWords, value);
+				markValueAsUsedInCategory(blocksUsedValues + block * numWords, blocksDuplicateValues + block * numWords, value);
+			}
 		}
 
-	free(cellsLegalValuesOut);
-}
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++) {
+			CellLegalValues* cellLegalValues = &(cellsLegalValues[row * MN + col]);
+			int value = getBoardCellValue(viewBoardCellByRow(boardIn, row, col));
+			int block = whichBlock(boardIn, row, col);
+			int wordIndex = 0;
+
+			cellLegalValues->legalValues = legalValuesWords + (row * MN + col) * numWords;
+			for (wordIndex = 0; wordIndex < numWords; wordIndex++) {
+				CandidateSetWord usedValuesWord =
+					getCategoryValuesUsedByOtherCellsWord(rowsUsedValues + row * numWords, rowsDuplicateValues + row * numWords, wordIndex, value) |
+					getCategoryValuesUsedByOtherCellsWord(columnsUsedValues + col * numWords, columnsDuplicateValues + col * numWords, wordIndex, value) |
+					getCategoryValuesUsedByOtherCellsWord(blocksUsedValues + block * numWords, blocksDuplicateValues + block * numWords, wordIndex, value);
+				cellLegalValues->legalValues[wordIndex] = ~usedValuesWord & getCandidateSetWordFullMask(MN, wordIndex);
+			}
+			cellLegalValues->numLegalValues = countCandidateSetValues(cellLegalValues->legalValues, numWords);
+		}
 
-bool getSuperficiallyLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues*** cellsLegalValuesOut) {
-	bool retValue = true;
-	CellLegalValues** cellsLegalValues = NULL;
+	free(categoriesValues);
 
-	int MN = 0;
+	*cellsLegalValuesOut = cellsLegalValues;
+	return true;
+}
 
-	MN = getBoardBlockSize_MN(boardIn);
+/**
+ * TextBoardScanner struct holds the position of a scan through the contents of a board
+ * file in the text format, which are scanned by hand rather than by fscanf, so that the
+ * cost of a cell is that of its few characters.
+ */
+typedef struct {
+	const unsigned char* current;
+	const unsigned char* end;
+} TextBoardScanner;
 
-	cellsLegalValues = calloc(MN, sizeof(CellLegalValues*));
-	if (cellsLegalValues == NULL)
-		retValue = false;
-	else {
-		int row = 0;
-		for (row = 0; row < MN; row++) {
-			cellsLegalValues[row] = calloc(MN, sizeof(CellLegalValues));
-			if (cellsLegalValues[row] == NULL) {
-				retValue = false;
-				break;
-			} else {
-				int col = 0;
-				for (col = 0; col < MN; col++)
-					if (!getSuperficiallyLegalValuesForBoardCell(boardIn, row, col, &(cellsLegalValues[row][col]))) {
-						retValue = false;
-						break;
-					}
-				if (!retValue)
-					break;
-			}
-		}
-	}
+/**
+ * Checks whether a character is a whitespace character, as isspace does in the "C" locale,
+ * without going through the locale's character tables.
+ * 
+ * @param chr 		[in] The character to be examined
+ * @return true 	iff the character is a whitespace character
+ * @return false 	otherwise
+ */
+bool isTextBoardWhitespace(unsigned char chr) {
+	return (chr == ' ') || ((chr >= '\t') && (chr <= '\r'));
+}
 
-	if (!retValue)
-		freeCellsLegalValuesForAllBoardCells(boardIn, cellsLegalValues);
-	else
-		*cellsLegalValuesOut = cellsLegalValues;
+/**
+ * Checks whether a character is a decimal digit.
+ * 
+ * @param chr 		[in] The character to be examined
+ * @return true 	iff the character is a decimal digit
+ * @return false 	otherwise
+ */
+bool isTextBoardDigit(unsigned char chr) {
+	return (chr >= '0') && (chr <= '9');
+}
 
-	return retValue;
+/**
+ * Advance a scanner past any whitespace characters.
+ * 
+ * @param scanner 		[in, out] The scanner to be advanced
+ */
+void skipTextBoardWhitespace(TextBoardScanner* scanner) {
+	while ((scanner->current < scanner->end) && isTextBoardWhitespace(*(scanner->current)))
+		scanner->current++;
 }
 
 /**
- * Checks if a file is empty.
+ * Scan an integer, as fscanf's %d conversion would: an optional sign followed by
+ * decimal digits. Magnitudes beyond INT_MAX are saturated to it.
  * 
- * @param file 			[in] a pointer to a File object to be examined
- * @return true 		iff the file is empty
- * @return false 		otherwise
+ * @param scanner 		[in, out] The scanner to be read from. It is advanced past the
+ * 						integer, on success only
+ * @param valueOut 		[in, out] Pointer to be assigned with the integer scanned
+ * @return true 		iff an integer was scanned
+ * @return false 		iff the scanner is not at an integer
  */
-bool isFileEmpty(FILE* file) {
-	char chr = '\0';
-	int fscanfRetVal = 0;
-	fscanfRetVal = fscanf(file, " %c", &chr);
-	return fscanfRetVal == EOF;
+bool scanTextBoardInteger(TextBoardScanner* scanner, int* valueOut) {
+	const unsigned char* position = scanner->current;
+	bool isNegative = false;
+	int value = 0;
+
+	if ((position < scanner->end) && ((*position == '+') || (*position == '-'))) {
+		isNegative = (*position == '-');
+		position++;
+	}
+	if ((position == scanner->end) || !isTextBoardDigit(*position))
+		return false;
+
+	for (; (position < scanner->end) && isTextBoardDigit(*position); position++) {
+		int digit = *position - '0';
+		value = (value > (INT_MAX - digit) / 10) ? INT_MAX : (value * 10) + digit;
+	}
+
+	scanner->current = position;
+	*valueOut = isNegative ? -value : value;
+	return true;
 }
 
 /**
- * Fill a board cell by reading the contents of that cell from a file that 
- * contains a saved board in the specified format.
+ * Parse the contents of a board file in the text format into a new board, in a single
+ * pass which checks the values of the cells as it goes. A cell is an integer followed
+ * by a single character, FIXED_CELL_MARKER_IN_FILE marking fixed cells, except for the
+ * last cell which may end the file.
  * 
- * @param file 			[in] File being read from
- * @param destination 	[in, out] Pointer to a cell filled according to the file
- * 						contents
- * @param isLastCell 	[in] true iff the cell being processed is at the bottom
- * 						right corner of the board
- * @return true 		iff reading from file was successful
- * @return false 		iff nothing could be read from file
+ * @param contents 						[in] The contents of the file
+ * @param size 							[in] The size of the contents, in bytes
+ * @param boardInOut 					[in, out] A pointer to a board to which the parsed board
+ * 										will be assigned, on success only
+ * @return LoadBoardFromFileErrorCode 	The error that has occurred, or 0 on success
  */
-bool readCellFromFileToBoard(FILE* file, Cell* destination, bool isLastCell) {
-	char isFixedChar = '\0';
+LoadBoardFromFileErrorCode parseTextBoard(const unsigned char* contents, long size, Board* boardInOut) {
+	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
+	TextBoardScanner scanner = {0};
+	Board tempBoard = {0};
+	int m = 0, n = 0, MN = 0, MN2 = 0, index = 0;
+	bool areValuesInRange = true;
+
+	scanner.current = contents;
+	scanner.end = contents + size;
+
+	skipTextBoardWhitespace(&scanner);
+	if (!scanTextBoardInteger(&scanner, &m))
+		return LOAD_BOARD_FROM_FILE_COULD_NOT_PARSE_BOARD_DIMENSIONS;
+	skipTextBoardWhitespace(&scanner);
+	if (!scanTextBoardInteger(&scanner, &n))
+		return LOAD_BOARD_FROM_FILE_COULD_NOT_PARSE_BOARD_DIMENSIONS;
+	if (!((n > 0) && (m > 0)))
+		return LOAD_BOARD_FROM_FILE_DIMENSION_ARE_NOT_POSITIVE;
+
+	tempBoard.numRowsInBlock_M = m; tempBoard.numColumnsInBlock_N = n;
+	if (!createEmptyBoard(&tempBoard))
+		return LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE;
+
+	MN = getBoardBlockSize_MN(&tempBoard);
+	MN2 = getBoardSize_MN2(&tempBoard);
+	for (index = 0; (index < MN2) && (retVal == ERROR_SUCCESS); index++) {
+		Cell* cell = &(tempBoard.cells[index]);
+		skipTextBoardWhitespace(&scanner);
+		if (!scanTextBoardInteger(&scanner, &(cell->value))) {
+			retVal = LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
+		} else if (scanner.current < scanner.end) {
+			cell->isFixed = (*(scanner.current) == FIXED_CELL_MARKER_IN_FILE);
+			scanner.current++;
+		} else if (index + 1 < MN2) {
+			retVal = LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
+		}
+		areValuesInRange = areValuesInRange &&
+						   ((cell->value == EMPTY_CELL_VALUE_IN_FILE) || ((cell->value >= 1) && (cell->value <= MN)));
+	}
 
-	int fscanfRetVal = 0;
-	fscanfRetVal = fscanf(file, " %d%c ", &(destination->value), &isFixedChar);
+	if (retVal == ERROR_SUCCESS) {
+		skipTextBoardWhitespace(&scanner);
+		if (scanner.current < scanner.end)
+			retVal = LOAD_BOARD_FROM_FILE_BAD_FORMAT_FILE_CONTAINS_TOO_MUCH_CONTENT;
+		else if (!areValuesInRange)
+			retVal = LOAD_BOARD_FROM_FILE_CELL_VALUE_NOT_IN_RANGE;
+	}
 
-	if (fscanfRetVal == 2) {
-		destination->isFixed = (isFixedChar == FIXED_CELL_MARKER_IN_FILE);
-		return true;
+	if (retVal != ERROR_SUCCESS) {
+		cleanupBoard(&tempBoard);
+		return retVal;
 	}
 
-	if ((fscanfRetVal == 1) && isLastCell) {
-		destination->isFixed = false;
-		return true;
+	*boardInOut = tempBoard;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * Write a number to a buffer as numBytes little-endian bytes.
+ * 
+ * @param bytes 		[in, out] The buffer to be written to
+ * @param number 		[in] The number to be written
+ * @param numBytes 		[in] The number of bytes the number is written in
+ */
+void writeLittleEndianNumberToBytes(unsigned char* bytes, unsigned long number, int numBytes) {
+	int i = 0;
+	for (i = 0; i < numBytes; i++) {
+		bytes[i] = (unsigned char)(number & 0xFF);
+		number >>= 8;
 	}
+}
 
-	return false;
+/**
+ * Read a number from a buffer, in which it is written as numBytes little-endian bytes.
+ * 
+ * @param bytes 			[in] The buffer to be read from
+ * @param numBytes 			[in] The number of bytes the number is written in
+ * @return unsigned long 	The number read
+ */
+unsigned long readLittleEndianNumberFromBytes(const unsigned char* bytes, int numBytes) {
+	unsigned long number = 0;
+	int i = 0;
+	for (i = numBytes - 1; i >= 0; i--)
+		number = (number << 8) | bytes[i];
+	return number;
 }
 
 /**
- * Fill an entire board by reading the contents of that cell from a file that 
- * contains a saved board in the specified format.
+ * Get the number of bytes in which the value of each cell of a board is stored in a
+ * board file in the binary format.
  * 
- * @param file 			[in] File being read from
- * @param boardInOut 	[in, out] Pointer to a board struct to be filled with
- * 						the file contents
- * @return true 		iff all cells were read successfully
+ * @param MN 		[in] The number of cells in a block of the board
+ * @return int 		The number of bytes per cell value
+ */
+int getBinaryBoardFileValueSize(unsigned long MN) {
+	return (MN > BINARY_BOARD_FILE_MAX_NARROW_VALUE) ? 2 : 1;
+}
+
+/**
+ * Checks whether the contents of a file start with the marker of the binary board file format.
+ * 
+ * @param contents 		[in] The contents of the file
+ * @param size 			[in] The size of the contents, in bytes
+ * @return true 		iff the contents start with the marker
  * @return false 		otherwise
  */
-bool readCellsFromFileToBoard(FILE* file, Board* boardInOut) {
-	int MN = getBoardBlockSize_MN(boardInOut);
+bool isBinaryBoardFileContents(const unsigned char* contents, long size) {
+	return (size >= BINARY_BOARD_FILE_MARKER_LENGTH) &&
+		   (memcmp(contents, BINARY_BOARD_FILE_MARKER, BINARY_BOARD_FILE_MARKER_LENGTH) == 0);
+}
+
+/**
+ * Read the entire contents of a file into a newly allocated buffer. Files whose size can
+ * be told up front are read with a single read, while others, such as pipes, are read
+ * in growing chunks.
+ * 
+ * @param filePath 						[in] Path to the file to be read
+ * @param contentsOut 					[in, out] Pointer to be assigned with the buffer, which is
+ * 										then owned by the caller
+ * @param sizeOut 						[in, out] Pointer to be assigned with the size of the buffer
+ * @return LoadBoardFromFileErrorCode 	The error that has occurred, or 0 on success. A file
+ * 										that cannot be read is treated as one whose board
+ * 										dimensions cannot be parsed
+ */
+LoadBoardFromFileErrorCode readEntireFile(char* filePath, unsigned char** contentsOut, long* sizeOut) {
+	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
+	unsigned char* contents = NULL;
+	long size = 0, capacity = READ_ENTIRE_FILE_DEFAULT_CAPACITY;
+	FILE* file = fopen(filePath, "rb");
+	if (file == NULL)
+		return LOAD_BOARD_FROM_FILE_FILE_COULD_NOT_BE_OPENED;
+
+	if (fseek(file, 0, SEEK_END) == 0) {
+		long fileSize = ftell(file);
+		if ((fileSize >= 0) && (fileSize < LONG_MAX))
+			capacity = fileSize + 1; /* Note: the extra byte lets the read reach the end of the file */
+		rewind(file);
+	}
 
-	int row = 0, col = 0;
-	for (row = 0; row < MN; row++)
-		for (col = 0; col < MN; col++)
-			if (!readCellFromFileToBoard(file, &(boardInOut->cells[row][col]), (row + 1 == MN) && (col + 1 == MN)))
-				return false;
+	contents = malloc(capacity);
+	if ((contents == NULL) && (capacity > READ_ENTIRE_FILE_DEFAULT_CAPACITY)) { /* Note: the size reported for some files, such as directories, is bogus */
+		capacity = READ_ENTIRE_FILE_DEFAULT_CAPACITY;
+		contents = malloc(capacity);
+	}
 
-	return true;
+	while (contents != NULL) {
+		unsigned char* grownContents = NULL;
+		size += (long)fread(contents + size, sizeof(unsigned char), capacity - size, file);
+		if (size < capacity)
+			break;
+
+		grownContents = realloc(contents, 2 * capacity);
+		if (grownContents == NULL)
+			free(contents);
+		contents = grownContents;
+		capacity *= 2;
+	}
+
+	if (contents == NULL) {
+		retVal = LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE;
+	} else if (ferror(file)) {
+		free(contents);
+		retVal = LOAD_BOARD_FROM_FILE_COULD_NOT_PARSE_BOARD_DIMENSIONS;
+	}
+	fclose(file);
+
+	if (retVal == ERROR_SUCCESS) {
+		*contentsOut = contents;
+		*sizeOut = size;
+	}
+	return retVal;
 }
 
 /**
- * Checks that all the values in all cells of the provided board are either
- * equal to EMPTY_CELL_VALUE or in the range [1, MN] where MN is the number of cells 
- * in a block of the board.
+ * Parse the contents of a board file in the binary format into a new board.
  * 
- * @param board 	[in] The board to be examined.
- * @return true 	iff all cell values are legal
- * @return false 	otherwise
+ * @param contents 						[in] The contents of the file
+ * @param size 							[in] The size of the contents, in bytes
+ * @param boardInOut 					[in, out] A pointer to a board to which the parsed board
+ * 										will be assigned, on success only
+ * @return LoadBoardFromFileErrorCode 	The error that has occurred, or 0 on success
  */
-bool areCellValuesInRange(Board* board) {
-	int MN = getBoardBlockSize_MN(board);
-	int row = 0;
-	int col = 0;
-	for (row = 0; row < MN; row++)
-		for (col = 0; col < MN; col++) {
-			int value = board->cells[row][col].value;
-			if ((value != EMPTY_CELL_VALUE_IN_FILE) && ((value < 1) || (value > MN)))
-				return false;
+LoadBoardFromFileErrorCode parseBinaryBoard(const unsigned char* contents, long size, Board* boardInOut) {
+	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
+	Board tempBoard = {0};
+	unsigned long m = 0, n = 0, MN = 0, MN2 = 0, index = 0;
+	unsigned long available = 0, expected = 0;
+	const unsigned char* values = NULL;
+	const unsigned char* fixedBitmap = NULL;
+	int valueSize = 0;
+
+	if ((size < BINARY_BOARD_FILE_HEADER_SIZE) ||
+		(memcmp(contents, BINARY_BOARD_FILE_MARKER, BINARY_BOARD_FILE_MARKER_LENGTH) != 0))
+		return LOAD_BOARD_FROM_FILE_COULD_NOT_PARSE_BOARD_DIMENSIONS;
+	if (contents[BINARY_BOARD_FILE_VERSION_OFFSET] != BINARY_BOARD_FILE_VERSION)
+		return LOAD_BOARD_FROM_FILE_UNSUPPORTED_VERSION;
+
+	m = readLittleEndianNumberFromBytes(contents + BINARY_BOARD_FILE_M_OFFSET, BINARY_BOARD_FILE_DIMENSION_SIZE);
+	n = readLittleEndianNumberFromBytes(contents + BINARY_BOARD_FILE_N_OFFSET, BINARY_BOARD_FILE_DIMENSION_SIZE);
+	if (!((m > 0) && (n > 0)))
+		return LOAD_BOARD_FROM_FILE_DIMENSION_ARE_NOT_POSITIVE;
+
+	/* Every cell takes at least a byte, so dimensions the contents cannot hold are rejected before they may overflow */
+	available = (unsigned long)size - BINARY_BOARD_FILE_HEADER_SIZE;
+	if (m > available / n)
+		return LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
+	MN = m * n;
+	if (MN > available / MN)
+		return LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
+	MN2 = MN * MN;
+	valueSize = getBinaryBoardFileValueSize(MN);
+	if (((contents[BINARY_BOARD_FILE_FLAGS_OFFSET] & BINARY_BOARD_FILE_FLAG_WIDE_VALUES) != 0) != (valueSize == 2))
+		return LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
+
+	expected = (MN2 * valueSize) + ((MN2 + 7) / 8);
+	if (available < expected)
+		return LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
+	if (available > expected)
+		return LOAD_BOARD_FROM_FILE_BAD_FORMAT_FILE_CONTAINS_TOO_MUCH_CONTENT;
+
+	tempBoard.numRowsInBlock_M = (int)m; tempBoard.numColumnsInBlock_N = (int)n;
+	if (!createEmptyBoard(&tempBoard))
+		return LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE;
+
+	values = contents + BINARY_BOARD_FILE_HEADER_SIZE;
+	fixedBitmap = values + (MN2 * valueSize);
+	for (index = 0; (index < MN2) && (retVal == ERROR_SUCCESS); index++) {
+		Cell* cell = &(tempBoard.cells[index]);
+		unsigned long value = readLittleEndianNumberFromBytes(values + (index * valueSize), valueSize);
+		if (value > MN) {
+			retVal = LOAD_BOARD_FROM_FILE_CELL_VALUE_NOT_IN_RANGE;
+		} else {
+			cell->value = (int)value;
+			cell->isFixed = (fixedBitmap[index / 8] & (1 << (index % 8))) != 0;
 		}
+	}
 
-	return true;
+	if (retVal != ERROR_SUCCESS) {
+		cleanupBoard(&tempBoard);
+		return retVal;
+	}
+
+	*boardInOut = tempBoard;
+	return ERROR_SUCCESS;
+}
+
+LoadBoardFromFileErrorCode loadBoardFromBinaryFile(char* filePath, Board* boardInOut) {
+	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
+	unsigned char* contents = NULL;
+	long size = 0;
+
+	retVal = readEntireFile(filePath, &contents, &size);
+	if (retVal != ERROR_SUCCESS)
+		return retVal;
+
+	retVal = parseBinaryBoard(contents, size, boardInOut);
+	free(contents);
+	return retVal;
 }
 
 LoadBoardFromFileErrorCode loadBoardFromFile(char* filePath, Board* boardInOut) {
 	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
-	FILE* file = NULL;
-	int fscanfRetVal = 0;
-	int n = 0, m = 0;
+	unsigned char* contents = NULL;
+	long size = 0;
 
-	file = fopen(filePath, "r");
-	if (file == NULL) {
-		retVal = LOAD_BOARD_FROM_FILE_FILE_COULD_NOT_BE_OPENED;
-	} else {
-		fscanfRetVal = fscanf(file, " %d %d ", &m, &n);
-		if (fscanfRetVal != 2) {
-			retVal = LOAD_BOARD_FROM_FILE_COULD_NOT_PARSE_BOARD_DIMENSIONS;
-		} else {
-			if (!((n > 0) && (m > 0))) {
-				retVal = LOAD_BOARD_FROM_FILE_DIMENSION_ARE_NOT_POSITIVE;
-			} else {
-				Board tempBoard = {0};
-				tempBoard.numRowsInBlock_M = m; tempBoard.numColumnsInBlock_N = n;
-				if (!createEmptyBoard(&tempBoard)) {
-					retVal = LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE;
-				} else {
-					if (!readCellsFromFileToBoard(file, &tempBoard)) {
-						retVal = LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
-					} else {
-						if (!isFileEmpty(file)) {
-							retVal = LOAD_BOARD_FROM_FILE_BAD_FORMAT_FILE_CONTAINS_TOO_MUCH_CONTENT;
-						} else {
-							if (!areCellValuesInRange(&tempBoard)) {
-								retVal = LOAD_BOARD_FROM_FILE_CELL_VALUE_NOT_IN_RANGE;
-							} else {
-								*boardInOut = tempBoard;
-							}
-						}
-					}
-				}
-				if (retVal != ERROR_SUCCESS)
-					cleanupBoard(&tempBoard);
-			}
-		}
-		fclose(file);
-	}
+	retVal = readEntireFile(filePath, &contents, &size);
+	if (retVal != ERROR_SUCCESS)
+		return retVal;
+
+	if (isBinaryBoardFileContents(contents, size))
+		retVal = parseBinaryBoard(contents, size, boardInOut);
+	else
+		retVal = parseTextBoard(contents, size, boardInOut);
+	free(contents);
 	return retVal;
 }
 
@@ -769,7 +1157,7 @@ LoadBoardFromFileErrorCode loadBoardFromFile(char* filePath, Board* boardInOut)
  * @return true 
  * @return false 
  */
-bool writeCellFromBoardToFile(FILE* file, Cell* cell, bool isLastInRow) {
+bool writeCellFromBoardToFile(FILE* file, const Cell* cell, bool isLastInRow) {
 	int fprintfRetVal = 0;
 	fprintfRetVal = fprintf(file, "%d", cell->value);
 	if (fprintfRetVal <= 0)
@@ -804,7 +1192,7 @@ bool writeCellsFromBoardToFile(FILE* file, const Board* boardInOut) {
 	int row = 0, col = 0;
 	for (row = 0; row < MN; row++) {
 		for (col = 0; col < MN; col++)
-			if (!writeCellFromBoardToFile(file, &(boardInOut->cells[row][col]), (col + 1 == MN)))
+			if (!writeCellFromBoardToFile(file, viewBoardCellByRow(boardInOut, row, col), (col + 1 == MN)))
 				return false;
 		fprintf(file, "\n");
 	}
@@ -812,11 +1200,74 @@ bool writeCellsFromBoardToFile(FILE* file, const Board* boardInOut) {
 	return true;
 }
 
+/**
+ * Checks whether a board should be saved to a path in the binary format, by the
+ * path's extension.
+ * 
+ * @param filePath 	[in] Path to file where the board will be saved
+ * @return true 	iff the path ends with BINARY_BOARD_FILE_EXTENSION
+ * @return false 	otherwise
+ */
+bool isBinaryBoardFilePath(char* filePath) {
+	size_t pathLength = strlen(filePath);
+	size_t extensionLength = strlen(BINARY_BOARD_FILE_EXTENSION);
+	return (pathLength > extensionLength) &&
+		   (strcmp(filePath + pathLength - extensionLength, BINARY_BOARD_FILE_EXTENSION) == 0);
+}
+
+SaveBoardToFileErrorCode saveBoardToBinaryFile(char* filePath, const Board* board) {
+	SaveBoardToFileErrorCode retVal = ERROR_SUCCESS;
+	unsigned long MN = getBoardBlockSize_MN(board);
+	unsigned long MN2 = getBoardSize_MN2(board);
+	unsigned long index = 0, size = 0;
+	int valueSize = getBinaryBoardFileValueSize(MN);
+	unsigned char* contents = NULL;
+	unsigned char* values = NULL;
+	unsigned char* fixedBitmap = NULL;
+	FILE* file = NULL;
+
+	size = BINARY_BOARD_FILE_HEADER_SIZE + (MN2 * valueSize) + ((MN2 + 7) / 8);
+	contents = calloc(size, sizeof(unsigned char));
+	if (contents == NULL)
+		return SAVE_BOARD_TO_FILE_MEMORY_ALLOCATION_FAILURE;
+
+	memcpy(contents, BINARY_BOARD_FILE_MARKER, BINARY_BOARD_FILE_MARKER_LENGTH);
+	contents[BINARY_BOARD_FILE_VERSION_OFFSET] = BINARY_BOARD_FILE_VERSION;
+	contents[BINARY_BOARD_FILE_FLAGS_OFFSET] = (valueSize == 2) ? BINARY_BOARD_FILE_FLAG_WIDE_VALUES : 0;
+	writeLittleEndianNumberToBytes(contents + BINARY_BOARD_FILE_M_OFFSET, board->numRowsInBlock_M, BINARY_BOARD_FILE_DIMENSION_SIZE);
+	writeLittleEndianNumberToBytes(contents + BINARY_BOARD_FILE_N_OFFSET, board->numColumnsInBlock_N, BINARY_BOARD_FILE_DIMENSION_SIZE);
+
+	values = contents + BINARY_BOARD_FILE_HEADER_SIZE;
+	fixedBitmap = values + (MN2 * valueSize);
+	for (index = 0; index < MN2; index++) {
+		const Cell* cell = &(board->cells[index]);
+		writeLittleEndianNumberToBytes(values + (index * valueSize), cell->value, valueSize);
+		if (cell->isFixed)
+			fixedBitmap[index / 8] |= (unsigned char)(1 << (index % 8));
+	}
+
+	file = fopen(filePath, "wb");
+	if (file == NULL) {
+		retVal = SAVE_BOARD_TO_FILE_FILE_COULD_NOT_BE_OPENED;
+	} else {
+		if (fwrite(contents, sizeof(unsigned char), size, file) != size)
+			retVal = SAVE_BOARD_TO_FILE_FAILED_TO_WRITE_A_CELL;
+		if (fclose(file) != 0)
+			retVal = SAVE_BOARD_TO_FILE_FAILED_TO_WRITE_A_CELL;
+	}
+
+	free(contents);
+	return retVal;
+}
+
 SaveBoardToFileErrorCode saveBoardToFile(char* filePath, const Board* board) {
 	SaveBoardToFileErrorCode retVal = ERROR_SUCCESS;
 	FILE* file = NULL;
 	int fprintfRetVal = 0;
 
+	if (isBinaryBoardFilePath(filePath))
+		return saveBoardToBinaryFile(filePath, board);
+
 	file = fopen(filePath, "w");
 	if (file == NULL) {
 		retVal = SAVE_BOARD_TO_FILE_FILE_COULD_NOT_BE_OPENED;
@@ -858,7 +1309,47 @@ void markFilledCellsAsFixed(Board* board) {
 
 }
 
-getBoardSolutionErrorCode getBoardSolution(const Board* board, Board* solutionOut) {
+/**
+ * The backend by which boards are currently solved.
+ */
+BoardSolverBackend boardSolverBackend = BOARD_SOLVER_BACKEND_DEFAULT;
+
+BoardSolverBackend getBoardSolverBackend() {
+	if (boardSolverBackend != BOARD_SOLVER_BACKEND_DEFAULT)
+		return boardSolverBackend;
+	return isLinearProgrammingAvailable() ? BOARD_SOLVER_BACKEND_LINEAR_PROGRAMMING : BOARD_SOLVER_BACKEND_NATIVE;
+}
+
+void setBoardSolverBackend(BoardSolverBackend backend) {
+	boardSolverBackend = backend;
+}
+
+/**
+ * Solves a particular board using the native backtracking solver.
+ * 
+ * @param board 						[in] The board to be solved
+ * @param solutionOut 					[in, out] A pointer to a board struct, which will be assigned
+ * 										with a solution to the board on success
+ * @return getBoardSolutionErrorCode 
+ */
+getBoardSolutionErrorCode getBoardSolutionUsingBacktracking(const Board* board, Board* solutionOut) {
+	bool isSolvable = false;
+
+	if (!findSolutionUsingBacktracking(board, solutionOut, &isSolvable))
+		return GET_BOARD_SOLUTION_MEMORY_ALLOCATION_FAILURE;
+
+	return isSolvable ? GET_BOARD_SOLUTION_SUCCESS : GET_BOARD_SOLUTION_BOARD_UNSOLVABLE;
+}
+
+/**
+ * Solves a particular board using ILP.
+ * 
+ * @param board 						[in] The board to be solved
+ * @param solutionOut 					[in, out] A pointer to a board struct, which will be assigned
+ * 										with a solution to the board on success
+ * @return getBoardSolutionErrorCode 
+ */
+getBoardSolutionErrorCode getBoardSolutionUsingLinearProgramming(const Board* board, Board* solutionOut) {
 	getBoardSolutionErrorCode retVal = GET_BOARD_SOLUTION_SUCCESS;
 
 	Board boardCopy = {0};
@@ -892,6 +1383,17 @@ getBoardSolutionErrorCode getBoardSolution(const Board* board, Board* solutionOu
 	return retVal;
 }
 
+getBoardSolutionErrorCode getBoardSolution(const Board* board, Board* solutionOut) {
+	switch (getBoardSolverBackend()) {
+	case BOARD_SOLVER_BACKEND_LINEAR_PROGRAMMING:
+		return getBoardSolutionUsingLinearProgramming(board, solutionOut);
+	case BOARD_SOLVER_BACKEND_NATIVE:
+	case BOARD_SOLVER_BACKEND_DEFAULT:
+	default:
+		return getBoardSolutionUsingBacktracking(board, solutionOut);
+	}
+}
+
 isBoardSolvableErrorCode isBoardSolvable(const Board* board) {
 	isBoardSolvableErrorCode retVal = IS_BOARD_SOLVABLE_BOARD_SOLVABLE;
 
@@ -2,6 +2,9 @@
 #define BOARD_H_
 
 #include <stdbool.h>
+#include <limits.h>
+
+#include "board_geometry.h"
 /**
  * The board module is designed to take care of everything related to the suduko board
  * data structure itself. 
@@ -22,24 +25,41 @@ typedef struct {
     bool isFixed;
 	bool isErroneous;} Cell;
 
+/**
+ * A single word of a candidate set. A candidate set is a bitmask of cell values, made of
+ * one or more such words: value v is a member of the set iff bit (v - 1) % CANDIDATE_SET_WORD_NUM_BITS
+ * of word (v - 1) / CANDIDATE_SET_WORD_NUM_BITS is on. Thus, boards whose blocks have no more
+ * than CANDIDATE_SET_WORD_NUM_BITS cells need only one machine word per set.
+ */
+typedef unsigned long CandidateSetWord;
+
+/**
+ * The number of values a single CandidateSetWord can hold.
+ */
+#define CANDIDATE_SET_WORD_NUM_BITS ((int)(sizeof(CandidateSetWord) * CHAR_BIT))
+
 /**
  * CellLegalValues struct holds information about optional values that may be legally
  * placed in a particular cell. It contains the number of legal values for this cell, 
- * and a boolean array: if index i is true, then i is a legal value for the corresonding
- * cell.
+ * and a candidate set: value i is a legal value for the corresonding cell iff it is
+ * a member of that set.
  * 
  */
 typedef struct {
 	int numLegalValues;
-  bool* legalValues;} CellLegalValues;
+  CandidateSetWord* legalValues;} CellLegalValues;
 
 /**
-  * Board struct represents a sudoku board.
+  * Board struct represents a sudoku board. The cells of the board are stored
+  * contiguously in a single buffer of MN*MN Cell structs, row after row, so that
+  * the cell in row r and column c is found at index r*MN + c. The geometry holds
+  * the index tables shared by all boards of the same shape.
   */
 typedef struct {
    	int numRowsInBlock_M;
    	int numColumnsInBlock_N;
-   	Cell** cells;} Board;
+   	Cell* cells;
+   	const BoardGeometry* geometry;} Board;
 
 /**
  * Functions who share a signature, used to transform cell indices from one format to another.
@@ -309,7 +329,9 @@ void setBoardCellErroneousness(Cell* cell, bool isErroneous);
 void cleanupBoard(Board* boardInOut);
 
 /**
- * Create a new, uninitialized, Board struct. 
+ * Create a new, uninitialized, Board struct. All the cells of the board are
+ * allocated at once, as one contiguous buffer, and the board is attached to the
+ * geometry of its shape.
  * 
  * @param boardInOut 		[in, out] A pointer to a board struct, filled with the new board created
  * @return true 				iff the board was allocated successfully 
@@ -343,12 +365,27 @@ void freeSpecificCellsValuesCounters(int** cellValuesCounters, const Board* boar
  * category member. 
  * 
  * @param board 							[in] The board to be examined
- * @param getCellFunc 				[in] A pointer to one of the viewCellsByCategoryFunc functions, which 
- * 														will be used to construct the counter matrix
+ * @param category 						[in] The category (row, column or block) by which the cells
+ * 														are counted
  * @return int** 							The filled counter matrix corresponding to the board and the requsted
  * 														category, or NULL if a memory error occurred
  */
-int** createCellsValuesCountersByCategory(const Board* board, viewCellsByCategoryFunc getCellFunc);
+int** createCellsValuesCountersByCategory(const Board* board, BoardCategory category);
+
+/**
+ * Creates a matrix of sums of indices of cells in a particular category of the provided
+ * board, where category is row, column, or block, laid out as the counter matrix is.
+ * The j-th index in the i-th row equals the sum of the indices, within the i-th category
+ * member, of the cells that hold the value j. Wherever the matching counter is 1, the sum
+ * is thus the index of the only cell holding that value.
+ * 
+ * @param board 			[in] The board to be examined
+ * @param category 			[in] The category (row, column or block) by which the cells
+ * 							are summed
+ * @return int** 			The filled matrix corresponding to the board and the requested
+ * 							category, or NULL if a memory error occurred
+ */
+int** createCellsValuesIndicesSumsByCategory(const Board* board, BoardCategory category);
 
 /**
  * Checks if there exist erroneous cells in a particular row, column, or block, specified by the caterogy
@@ -357,15 +394,14 @@ int** createCellsValuesCountersByCategory(const Board* board, viewCellsByCategor
  * cells in that category.
  * 
  * @param board 					[in] The board to be examined
+ * @param category 				[in] The category (row, column or block) to be scanned
  * @param categoryNo 			[in] The row, column or block number to be scanned for errors
- * @param getCellFunc 		[in] A pointer to one of the viewCellsByCategoryFunc functions which 
- * 												will be used to traverse the cells in the category
  * @param outErroneous 		[in, out] A pointer to be boolean to be set to true iff there exist
  * 												errors in that category
  * @return true 					iff the procedure was successful
  * @return false 					iff a memory error occurred during the check process
  */
-bool checkErroneousCellsInCategory(const Board* board, int categoryNo, viewCellsByCategoryFunc getCellFunc, bool* outErroneous);
+bool checkErroneousCellsInCategory(const Board* board, BoardCategory category, int categoryNo, bool* outErroneous);
 
 /**
  * Check if there exist erroneous cells by row, column or block, specified by category type.
@@ -434,23 +470,82 @@ bool fillBoardCellLegalValuesStruct(const Board* boardIn, int row, int col, Cell
 /**
  *  Free all memory allocated to all the CellLegalValues struct of an entire board.
  * 
- * @param boardIn 							[in] Board struct to which the CellLegalValues matrix is
+ * @param boardIn 							[in] Board struct to which the CellLegalValues array is
  * 															associated.
- * @param cellsLegalValuesOut 	[in, out] A matrix of CellLegalValues structs, corresponding to
+ * @param cellsLegalValuesOut 	[in, out] An array of CellLegalValues structs, corresponding to
  * 															each cell	in the board 
  */
-void freeCellsLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues** cellsLegalValuesOut);
+void freeCellsLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues* cellsLegalValuesOut);
 
 /**
- * Constructs a matrix of CellLegalValues structs corresponding to each cell in the board.
+ * Constructs an array of CellLegalValues structs corresponding to each cell in the board,
+ * where the struct of the cell in row r and column c is found at index r*MN + c. The values
+ * used in each row, column and block are gathered once, so the whole array is filled in a
+ * single pass over the board, and all of it resides in a single memory allocation.
  * 
  * @param boardIn 						[in] The board to be examined
- * @param cellsLegalValuesOut [in, out] A pointer to a CellLegalValues matrix to be assigned with
+ * @param cellsLegalValuesOut [in, out] A pointer to a CellLegalValues array to be assigned with
  * 														the result
  * @return true 							iff the procedure was successful
  * @return false 							iff a memory error occurred during the process
  */
-bool getSuperficiallyLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues*** cellsLegalValuesOut);
+bool getSuperficiallyLegalValuesForAllBoardCells(const Board* boardIn, CellLegalValues** cellsLegalValuesOut);
+
+/**
+ * Get the number of CandidateSetWord words that make up a single candidate set of
+ * the provided board.
+ * 
+ * @param board			[in] The board whose parameter is requested
+ * @return int 			The number of words in a candidate set
+ */
+int getNumCandidateSetWords(const Board* board);
+
+/**
+ * Check if a particular value is a member of a candidate set.
+ * 
+ * @param candidateSet 	[in] The candidate set to be examined
+ * @param value 				[in] The value whose membership is checked
+ * @return true 				iff value is a member of the set
+ * @return false 				otherwise
+ */
+bool isValueInCandidateSet(const CandidateSetWord* candidateSet, int value);
+
+/**
+ * Add a particular value to a candidate set.
+ * 
+ * @param candidateSet 	[in, out] The candidate set to be updated
+ * @param value 				[in] The value to be added
+ */
+void addValueToCandidateSet(CandidateSetWord* candidateSet, int value);
+
+/**
+ * Remove a particular value from a candidate set.
+ * 
+ * @param candidateSet 	[in, out] The candidate set to be updated
+ * @param value 				[in] The value to be removed
+ */
+void removeValueFromCandidateSet(CandidateSetWord* candidateSet, int value);
+
+/**
+ * Count the number of values in a candidate set.
+ * 
+ * @param candidateSet 	[in] The candidate set to be examined
+ * @param numWords 			[in] The number of words that make up the set
+ * @return int 					The number of values which are members of the set
+ */
+int countCandidateSetValues(const CandidateSetWord* candidateSet, int numWords);
+
+/**
+ * Find the smallest value in a candidate set which is greater than the one provided.
+ * Passing EMPTY_CELL_VALUE yields the smallest value in the set.
+ * 
+ * @param candidateSet 	[in] The candidate set to be examined
+ * @param numWords 			[in] The number of words that make up the set
+ * @param value 				[in] The value to start the search after
+ * @return int 					The next value in the set, or EMPTY_CELL_VALUE if there
+ * 											is no such value
+ */
+int getNextValueInCandidateSet(const CandidateSetWord* candidateSet, int numWords, int value);
 
 /**
  * Errors that may occur during loading a board from a file. 
@@ -462,10 +557,13 @@ typedef enum {
 	LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL,
 	LOAD_BOARD_FROM_FILE_BAD_FORMAT_FILE_CONTAINS_TOO_MUCH_CONTENT,
 	LOAD_BOARD_FROM_FILE_CELL_VALUE_NOT_IN_RANGE,
-	LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE
+	LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE,
+	LOAD_BOARD_FROM_FILE_UNSUPPORTED_VERSION
 } LoadBoardFromFileErrorCode;
 /**
- * Loads a board from a file and constructs a board struct accordingly.
+ * Loads a board from a file and constructs a board struct accordingly. Files in the binary
+ * format are told apart from files in the text format by the marker they start with, and
+ * are loaded by loadBoardFromBinaryFile.
  * 
  * @param filePath 							[in] Path to the file from which the board will be loaded
  * @param boardInOut 						[in, out] A pointer to a board to which the constructed board will
@@ -474,6 +572,28 @@ typedef enum {
  */
 LoadBoardFromFileErrorCode loadBoardFromFile(char* filePath, Board* boardInOut);
 
+/**
+ * The extension of paths to which boards are saved in the binary format.
+ */
+#define BINARY_BOARD_FILE_EXTENSION (".sdkb")
+
+/**
+ * Loads a board from a file in the binary format, reading the whole file at once.
+ * The format, all numbers in it being little-endian, is:
+ * - A 16 bytes header: the marker "SDKB", the version of the format (1), flags, two
+ *   reserved bytes, and the numbers of rows and columns in a block, M and N, as 32 bit
+ *   numbers. Flag 0x01 marks values that are stored in two bytes rather than one, as they
+ *   are in boards with more than 255 cells in a block.
+ * - The values of all cells, row after row, 0 standing for an empty cell.
+ * - A bitmap of the fixed cells, in the same order, the first cell in the lowest bit.
+ * 
+ * @param filePath 							[in] Path to the file from which the board will be loaded
+ * @param boardInOut 						[in, out] A pointer to a board to which the constructed board will
+ * 															be assigned. 
+ * @return LoadBoardFromFileErrorCode 
+ */
+LoadBoardFromFileErrorCode loadBoardFromBinaryFile(char* filePath, Board* boardInOut);
+
 /**
  * Errors that may occur during saving a board to a file. 
  * 
@@ -481,10 +601,13 @@ LoadBoardFromFileErrorCode loadBoardFromFile(char* filePath, Board* boardInOut);
 typedef enum {
 	SAVE_BOARD_TO_FILE_FILE_COULD_NOT_BE_OPENED = 1,
 	SAVE_BOARD_TO_FILE_DIMENSIONS_COULD_NOT_BE_WRITTEN,
-	SAVE_BOARD_TO_FILE_FAILED_TO_WRITE_A_CELL
+	SAVE_BOARD_TO_FILE_FAILED_TO_WRITE_A_CELL,
+	SAVE_BOARD_TO_FILE_MEMORY_ALLOCATION_FAILURE
 } SaveBoardToFileErrorCode;
 /**
- * Saves a board to a file in the specified format.
+ * Saves a board to a file in the specified format, or in the binary format if the path
+ * ends with BINARY_BOARD_FILE_EXTENSION. As either format is loaded by loadBoardFromFile,
+ * loading a board and saving it under the other extension converts it.
  * 
  * @param filePath 		[in] Path to file where the board will be saved
  * @param board 			[in] The board to save
@@ -492,6 +615,16 @@ typedef enum {
  */
 SaveBoardToFileErrorCode saveBoardToFile(char* filePath, const Board* board);
 
+/**
+ * Saves a board to a file in the binary format, as described for loadBoardFromBinaryFile,
+ * writing the whole file at once.
+ * 
+ * @param filePath 		[in] Path to file where the board will be saved
+ * @param board 			[in] The board to save
+ * @return SaveBoardToFileErrorCode 
+ */
+SaveBoardToFileErrorCode saveBoardToBinaryFile(char* filePath, const Board* board);
+
 /**
  * Set all the cells' isFixed marker to false.
  * 
@@ -508,7 +641,34 @@ void markAllCellsAsNotFixed(Board* board);
 void markFilledCellsAsFixed(Board* board);
 
 /**
- * Errors that may occur while solving a board with LP. 
+ * The engines by which boards are solved. The native backend is an exact backtracking
+ * search which needs no external library; the linear programming backend solves an ILP
+ * with Gurobi. The default backend is linear programming when the build has it, and the
+ * native backend otherwise.
+ */
+typedef enum {
+	BOARD_SOLVER_BACKEND_DEFAULT,
+	BOARD_SOLVER_BACKEND_NATIVE,
+	BOARD_SOLVER_BACKEND_LINEAR_PROGRAMMING
+} BoardSolverBackend;
+
+/**
+ * Get the backend by which getBoardSolution and isBoardSolvable solve boards.
+ * 
+ * @return BoardSolverBackend 	The backend in use, never BOARD_SOLVER_BACKEND_DEFAULT
+ */
+BoardSolverBackend getBoardSolverBackend();
+
+/**
+ * Set the backend by which getBoardSolution and isBoardSolvable solve boards, for the
+ * rest of the process.
+ * 
+ * @param backend 	[in] The backend to be used, or BOARD_SOLVER_BACKEND_DEFAULT
+ */
+void setBoardSolverBackend(BoardSolverBackend backend);
+
+/**
+ * Errors that may occur while solving a board. 
  */
 typedef enum {
 	GET_BOARD_SOLUTION_SUCCESS,
@@ -517,7 +677,7 @@ typedef enum {
 	GET_BOARD_SOLUTION_MEMORY_ALLOCATION_FAILURE
 } getBoardSolutionErrorCode;
 /**
- * Solves a particular board using LP.
+ * Solves a particular board using the backend set by setBoardSolverBackend.
  * 
  * @param board 								[in] The board to be solved
  * @param solutionOut 					[in, out] A pointer to a board struct, which will be assigned
@@ -0,0 +1,167 @@
+#include <stdlib.h>
+#include <limits.h>
+
+#include "board_geometry.h"
+
+/**
+ * The maximal number of entries in a peers table. Boards whose peers table would be
+ * larger get no such table.
+ */
+#define MAX_NUM_PEERS_TABLE_ENTRIES (1 << 22)
+
+/**
+ * The geometries built so far, chained in a list.
+ */
+BoardGeometry* builtBoardGeometries = NULL;
+
+/**
+ * Fills the tables of a particular category, given the category-based indices of each cell.
+ *
+ * @param categoriesCells 			[in, out] The table of cells of each category member
+ * @param cellsCategories 			[in, out] The table of category members of each cell
+ * @param cellsIndicesInCategories 	[in, out] The table of indices of each cell within its
+ * 									category member
+ * @param cell 						[in] The index of the cell
+ * @param categoryNo 				[in] The number of row, column or block the cell is in
+ * @param indexInCategory 			[in] The index of the cell within that row, column or block
+ * @param MN 						[in] The number of cells in a board block
+ */
+void setBoardGeometryCellCategory(int* categoriesCells, int* cellsCategories, int* cellsIndicesInCategories, int cell, int categoryNo, int indexInCategory, int MN) {
+	categoriesCells[categoryNo * MN + indexInCategory] = cell;
+	cellsCategories[cell] = categoryNo;
+	cellsIndicesInCategories[cell] = indexInCategory;
+}
+
+/**
+ * Fills the peers table of a board geometry, whose category tables are already filled.
+ *
+ * @param geometry 		[in] The geometry whose peers are listed
+ * @param cellsPeers 	[in, out] The peers table to be filled
+ */
+void fillBoardGeometryPeers(const BoardGeometry* geometry, int* cellsPeers) {
+	int MN = geometry->MN;
+	int cell = 0;
+
+	for (cell = 0; cell < geometry->MN2; cell++) {
+		int* peers = cellsPeers + cell * geometry->numPeers;
+		int row = geometry->cellsCategories[BOARD_CATEGORY_ROW][cell];
+		int col = geometry->cellsCategories[BOARD_CATEGORY_COLUMN][cell];
+		int block = geometry->cellsCategories[BOARD_CATEGORY_BLOCK][cell];
+		int numPeers = 0;
+		int index = 0;
+
+		for (index = 0; index < MN; index++)
+			if (index != col)
+				peers[numPeers++] = row * MN + index;
+
+		for (index = 0; index < MN; index++)
+			if (index != row)
+				peers[numPeers++] = index * MN + col;
+
+		for (index = 0; index < MN; index++) {
+			int blockCell = geometry->categoriesCells[BOARD_CATEGORY_BLOCK][block * MN + index];
+			if ((geometry->cellsCategories[BOARD_CATEGORY_ROW][blockCell] != row) &&
+				(geometry->cellsCategories[BOARD_CATEGORY_COLUMN][blockCell] != col))
+				peers[numPeers++] = blockCell;
+		}
+	}
+}
+
+/**
+ * Builds the geometry of boards whose blocks have M rows and N columns. The struct
+ * and all its tables reside in a single memory allocation.
+ *
+ * @param M 					[in] The number of rows in a board block
+ * @param N 					[in] The number of columns in a board block
+ * @return BoardGeometry* 		The new geometry, or NULL if a memory error occurred
+ */
+BoardGeometry* createBoardGeometry(int M, int N) {
+	BoardGeometry* geometry = NULL;
+	int* tables = NULL;
+	int* categoriesCells[BOARD_NUM_CATEGORIES];
+	int* cellsCategories[BOARD_NUM_CATEGORIES];
+	int* cellsIndicesInCategories[BOARD_NUM_CATEGORIES];
+	int MN = 0;
+	int MN2 = 0;
+	int numPeers = 0;
+	int numPeersTableEntries = 0;
+	int category = 0;
+	int row = 0, col = 0;
+
+	/* Note: the tables of boards this large could never be allocated, and their sizes would overflow */
+	if ((M > INT_MAX / N) || (M * N > INT_MAX / (M * N)) ||
+		((M * N) * (M * N) > (INT_MAX - MAX_NUM_PEERS_TABLE_ENTRIES) / (3 * BOARD_NUM_CATEGORIES)))
+		return NULL;
+
+	MN = M * N;
+	MN2 = MN * MN;
+	numPeers = 2 * (MN - 1) + (M - 1) * (N - 1);
+	if ((numPeers > 0) && (MN2 <= MAX_NUM_PEERS_TABLE_ENTRIES / numPeers))
+		numPeersTableEntries = MN2 * numPeers;
+
+	geometry = calloc(1, sizeof(BoardGeometry) + (3 * BOARD_NUM_CATEGORIES * MN2 + numPeersTableEntries) * sizeof(int));
+	if (geometry == NULL)
+		return NULL;
+	tables = (int*)(geometry + 1);
+
+	geometry->numRowsInBlock_M = M;
+	geometry->numColumnsInBlock_N = N;
+	geometry->MN = MN;
+	geometry->MN2 = MN2;
+	geometry->numPeers = numPeers;
+
+	for (category = 0; category < BOARD_NUM_CATEGORIES; category++) {
+		categoriesCells[category] = tables + (3 * category) * MN2;
+		cellsCategories[category] = tables + (3 * category + 1) * MN2;
+		cellsIndicesInCategories[category] = tables + (3 * category + 2) * MN2;
+		geometry->categoriesCells[category] = categoriesCells[category];
+		geometry->cellsCategories[category] = cellsCategories[category];
+		geometry->cellsIndicesInCategories[category] = cellsIndicesInCategories[category];
+	}
+
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++) {
+			int cell = row * MN + col;
+			/* Note: blocks are numbered left to right and top to bottom, and so are the cells within them */
+			int block = (row / M) * M + (col / N);
+			int indexInBlock = (row % M) * N + (col % N);
+
+			setBoardGeometryCellCategory(categoriesCells[BOARD_CATEGORY_ROW], cellsCategories[BOARD_CATEGORY_ROW], cellsIndicesInCategories[BOARD_CATEGORY_ROW], cell, row, col, MN);
+			setBoardGeometryCellCategory(categoriesCells[BOARD_CATEGORY_COLUMN], cellsCategories[BOARD_CATEGORY_COLUMN], cellsIndicesInCategories[BOARD_CATEGORY_COLUMN], cell, col, row, MN);
+			setBoardGeometryCellCategory(categoriesCells[BOARD_CATEGORY_BLOCK], cellsCategories[BOARD_CATEGORY_BLOCK], cellsIndicesInCategories[BOARD_CATEGORY_BLOCK], cell, block, indexInBlock, MN);
+		}
+
+	if (numPeersTableEntries > 0) {
+		int* cellsPeers = tables + 3 * BOARD_NUM_CATEGORIES * MN2;
+		fillBoardGeometryPeers(geometry, cellsPeers);
+		geometry->cellsPeers = cellsPeers;
+	}
+
+	return geometry;
+}
+
+const BoardGeometry* getBoardGeometry(int numRowsInBlock_M, int numColumnsInBlock_N) {
+	BoardGeometry* geometry = builtBoardGeometries;
+
+	while (geometry != NULL) {
+		if ((geometry->numRowsInBlock_M == numRowsInBlock_M) && (geometry->numColumnsInBlock_N == numColumnsInBlock_N))
+			return geometry;
+		geometry = geometry->next;
+	}
+
+	geometry = createBoardGeometry(numRowsInBlock_M, numColumnsInBlock_N);
+	if (geometry != NULL) {
+		geometry->next = builtBoardGeometries;
+		builtBoardGeometries = geometry;
+	}
+
+	return geometry;
+}
+
+void cleanupBoardGeometries() {
+	while (builtBoardGeometries != NULL) {
+		BoardGeometry* next = builtBoardGeometries->next;
+		free(builtBoardGeometries);
+		builtBoardGeometries = next;
+	}
+}
@@ -0,0 +1,70 @@
+/**
+ * BOARD_GEOMETRY Summary:
+ *
+ * A module designed to hold the index tables describing the shape of sudoku boards of
+ * particular dimensions. The tables of each shape (M, N) are built once, when a board of
+ * that shape is first created, and are shared by all boards of that shape, so that
+ * traversals of rows, columns, blocks and peers of cells become straight loops over
+ * flat arrays of cell indices (a cell's index being row * MN + column).
+ *
+ * getBoardGeometry 		- gets the geometry of boards of a particular shape, building it if needed
+ * cleanupBoardGeometries 	- frees the geometries of all shapes built so far
+ */
+
+#ifndef BOARD_GEOMETRY_H_
+#define BOARD_GEOMETRY_H_
+
+/**
+ * The categories by which the cells of a board are grouped.
+ */
+typedef enum {
+	BOARD_CATEGORY_ROW,
+	BOARD_CATEGORY_COLUMN,
+	BOARD_CATEGORY_BLOCK,
+	BOARD_NUM_CATEGORIES
+} BoardCategory;
+
+/**
+ * BoardGeometry struct holds the index tables of boards of a particular shape:
+ * 	categoriesCells[category][categoryNo * MN + index] is the index of the index-th cell of
+ * 		row, column or block number categoryNo
+ * 	cellsCategories[category][cell] is the number of row, column or block the cell is in
+ * 	cellsIndicesInCategories[category][cell] is the index of the cell within that row, column
+ * 		or block
+ * 	cellsPeers[cell * numPeers + i] is the index of the i-th peer of the cell, that is,
+ * 		of the i-th other cell sharing a row, column or block with it. Since this table
+ * 		grows as MN^3, it is only built for reasonably sized boards, and is NULL otherwise.
+ * Note: the geometry of a shape is built once and is never changed afterwards.
+ */
+typedef struct BoardGeometry {
+	int numRowsInBlock_M;
+	int numColumnsInBlock_N;
+	int MN;
+	int MN2;
+	int numPeers;
+	const int* categoriesCells[BOARD_NUM_CATEGORIES];
+	const int* cellsCategories[BOARD_NUM_CATEGORIES];
+	const int* cellsIndicesInCategories[BOARD_NUM_CATEGORIES];
+	const int* cellsPeers;
+	struct BoardGeometry* next;
+} BoardGeometry;
+
+/**
+ * Gets the geometry of boards whose blocks have M rows and N columns. The geometry of
+ * each shape is built upon the first request, and the same one is returned afterwards.
+ * Note: this function is not thread-safe, as it may build a new geometry.
+ *
+ * @param numRowsInBlock_M 			[in] The number of rows in a board block
+ * @param numColumnsInBlock_N 		[in] The number of columns in a board block
+ * @return const BoardGeometry* 	The geometry of the requested shape, or NULL if a memory
+ * 									error occurred
+ */
+const BoardGeometry* getBoardGeometry(int numRowsInBlock_M, int numColumnsInBlock_N);
+
+/**
+ * Frees all the geometries built so far. Boards which refer to them must not be used
+ * afterwards.
+ */
+void cleanupBoardGeometries();
+
+#endif /* BOARD_GEOMETRY_H_ */
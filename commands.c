@@ -9,6 +9,9 @@
 #include "parser.h"
 #include "LP_solver.h"
 #include "BT_solver.h"
+#include "DLX_solver.h"
+#include "parallel_solver.h"
+#include "journal.h"
 
 #define UNUSED(x) (void)(x)
 
@@ -28,8 +31,8 @@
 
 /**
  * Function pointer to a concrete implementation of a specific command type's
- * GetExpectedRangeString. Such functions exist for Set, Generate, Hint, Guess and
- * Guess-Hint.
+ * GetExpectedRangeString. Such functions exist for Set, Generate, Hint, Guess,
+ * Guess-Hint, Num Solutions and Solver.
  * 
  */
 typedef char* (*commandArgsGetExpectedRangeStringFunc)(int argNo, GameState* gameState);
@@ -75,6 +78,7 @@ bool isCommandAllowed(GameMode gameMode, CommandType commandType) {
 		switch (commandType) {
 		case COMMAND_TYPE_SOLVE:
 		case COMMAND_TYPE_EDIT:
+		case COMMAND_TYPE_SOLVER:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
 			return true;
@@ -95,6 +99,8 @@ bool isCommandAllowed(GameMode gameMode, CommandType commandType) {
 		case COMMAND_TYPE_SAVE:
 		case COMMAND_TYPE_NUM_SOLUTIONS:
 		case COMMAND_TYPE_RESET:
+		case COMMAND_TYPE_SOLVER:
+		case COMMAND_TYPE_JOURNAL:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
 			return true;
@@ -119,6 +125,8 @@ bool isCommandAllowed(GameMode gameMode, CommandType commandType) {
 		case COMMAND_TYPE_NUM_SOLUTIONS:
 		case COMMAND_TYPE_AUTOFILL:
 		case COMMAND_TYPE_RESET:
+		case COMMAND_TYPE_SOLVER:
+		case COMMAND_TYPE_JOURNAL:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
 			return true;
@@ -176,6 +184,10 @@ char* getAllowingModesString(CommandType commandType) {
 		return AUTOFILL_COMMAND_LIST_OF_ALLOWING_STATES;
 	case COMMAND_TYPE_RESET:
 		return RESET_COMMAND_LIST_OF_ALLOWING_STATES;
+	case COMMAND_TYPE_SOLVER:
+		return SOLVER_COMMAND_LIST_OF_ALLOWING_STATES;
+	case COMMAND_TYPE_JOURNAL:
+		return JOURNAL_COMMAND_LIST_OF_ALLOWING_STATES;
 	case COMMAND_TYPE_EXIT:
 		return EXIT_COMMAND_LIST_OF_ALLOWING_STATES;
 	default:
@@ -189,8 +201,6 @@ bool isCorrectArgumentsNum(Command* command) {
 	case COMMAND_TYPE_VALIDATE:
 	case COMMAND_TYPE_UNDO:
 	case COMMAND_TYPE_REDO:
-	case COMMAND_TYPE_NUM_SOLUTIONS:
-	case COMMAND_TYPE_AUTOFILL:
 	case COMMAND_TYPE_RESET:
 	case COMMAND_TYPE_EXIT:
 	case COMMAND_TYPE_IGNORE:
@@ -201,6 +211,8 @@ bool isCorrectArgumentsNum(Command* command) {
 	case COMMAND_TYPE_MARK_ERRORS:
 	case COMMAND_TYPE_GUESS:
 	case COMMAND_TYPE_SAVE:
+	case COMMAND_TYPE_SOLVER:
+	case COMMAND_TYPE_JOURNAL:
 		if (command->argumentsNum == 1)
 			return true;
 		break;
@@ -215,9 +227,14 @@ bool isCorrectArgumentsNum(Command* command) {
 			return true;
 		break;
 	case COMMAND_TYPE_EDIT:
+	case COMMAND_TYPE_AUTOFILL:
 		if (command->argumentsNum >= 0 && command->argumentsNum <= 1)
 			return true;
 		break;
+	case COMMAND_TYPE_NUM_SOLUTIONS:
+		if (command->argumentsNum >= 0 && command->argumentsNum <= 4)
+			return true;
+		break;
 	}
 	return false;
 }
@@ -256,6 +273,10 @@ char* getCommandUsage(CommandType commandType) {
 		return AUTOFILL_COMMAND_USAGE;
 	case COMMAND_TYPE_RESET:
 		return RESET_COMMAND_USAGE;
+	case COMMAND_TYPE_SOLVER:
+		return SOLVER_COMMAND_USAGE;
+	case COMMAND_TYPE_JOURNAL:
+		return JOURNAL_COMMAND_USAGE;
 	case COMMAND_TYPE_EXIT:
 		return EXIT_COMMAND_USAGE;
 	default:
@@ -298,6 +319,10 @@ bool identifyCommandByType(char* commandType, Command* commandOut) {
 		commandOut->type = COMMAND_TYPE_AUTOFILL;
 	} else if (strcmp(commandType, RESET_COMMAND_TYPE_STRING) == 0) {
 		commandOut->type = COMMAND_TYPE_RESET;
+	} else if (strcmp(commandType, SOLVER_COMMAND_TYPE_STRING) == 0) {
+		commandOut->type = COMMAND_TYPE_SOLVER;
+	} else if (strcmp(commandType, JOURNAL_COMMAND_TYPE_STRING) == 0) {
+		commandOut->type = COMMAND_TYPE_JOURNAL;
 	} else if (strcmp(commandType, EXIT_COMMAND_TYPE_STRING) == 0) {
 		commandOut->type = COMMAND_TYPE_EXIT;
 	} else {
@@ -340,6 +365,10 @@ int getSizeofCommandArgsStruct(CommandType commandType) {
 		return sizeof(AutofillCommandArguments);
 	case COMMAND_TYPE_RESET:
 		return sizeof(ResetCommandArguments);
+	case COMMAND_TYPE_SOLVER:
+		return sizeof(SolverCommandArguments);
+	case COMMAND_TYPE_JOURNAL:
+		return sizeof(JournalCommandArguments);
 	case COMMAND_TYPE_EXIT:
 		return sizeof(ExitCommandArguments);
 	case COMMAND_TYPE_IGNORE:
@@ -390,6 +419,7 @@ typedef enum {
 #define FILES_COMMANDS_ERROR_BAD_FORMAT_CELL_NOT_PARSED_STR ("could not parse one of the cells\n")
 #define FILES_COMMANDS_ERROR_BAD_FORMAT_TOO_MUCH_CONTENT_STR ("file contains too much content\n")
 #define FILES_COMMANDS_ERROR_BAD_FORMAT_CELL_VALUE_NOT_IN_RANGE_STR ("the value of one of the cells is not in the appropriate range\n")
+#define FILES_COMMANDS_ERROR_BAD_FORMAT_UNSUPPORTED_VERSION_STR ("the file's format version is not supported\n")
 /* Used exclusively for Save command */
 #define FILES_COMMANDS_ERROR_WRITING_DIMENSIONS_ERROR_STR ("could not write board dimensions\n")
 #define FILES_COMMANDS_ERROR_WRITING_CELL_ERROR_STR ("could not write a cell\n")
@@ -424,6 +454,8 @@ char* getEditCommandErrorString(int error) {
 			return FILES_COMMANDS_ERROR_BAD_FORMAT_CELL_VALUE_NOT_IN_RANGE_STR;
 		case LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE:
 			return COMMAND_ERROR_MEMORY_ALLOCATION_FAILURE_STR;
+		case LOAD_BOARD_FROM_FILE_UNSUPPORTED_VERSION:
+			return FILES_COMMANDS_ERROR_BAD_FORMAT_UNSUPPORTED_VERSION_STR;
 		}
 	}
 	}
@@ -475,6 +507,11 @@ PerformEditCommandErrorCode performEditCommand(State* state, Command* command) {
 	if (command->argumentsNum == 0) { /* Start editing an empty 9x9 board */
 		board.numRowsInBlock_M = DEFAULT_M;
 		board.numColumnsInBlock_N = DEFAULT_N;
+	} else if (isJournalFile(editArguments->filePath)) { /* Restore from journal */
+		PerformEditCommandErrorCode retVal = ERROR_SUCCESS;
+		retVal = (PerformEditCommandErrorCode)createGameStateFromJournal(editArguments->filePath, GAME_MODE_EDIT, &newGameState);
+		if (retVal != ERROR_SUCCESS)
+			return PERFORM_EDIT_COMMAND_ERROR_IN_LOAD_BOARD_FROM_FILE + retVal;
 	} else { 						  /* Open from file */
 		PerformEditCommandErrorCode retVal = ERROR_SUCCESS;
 		retVal = (PerformEditCommandErrorCode)loadBoardFromFile(editArguments->filePath, &board);
@@ -482,12 +519,14 @@ PerformEditCommandErrorCode performEditCommand(State* state, Command* command) {
 			return PERFORM_EDIT_COMMAND_ERROR_IN_LOAD_BOARD_FROM_FILE + retVal;
 	}
 
-	newGameState = createGameState(&board, GAME_MODE_EDIT);
 	if (newGameState == NULL) {
+		newGameState = createGameState(&board, GAME_MODE_EDIT);
+		if (newGameState == NULL) {
+			cleanupBoard(&board);
+			return PERFORM_EDIT_COMMAND_MEMORY_ALLOCATION_FAILURE;
+		}
 		cleanupBoard(&board);
-		return PERFORM_EDIT_COMMAND_MEMORY_ALLOCATION_FAILURE;
-	 }
-	cleanupBoard(&board);
+	}
 
 	cleanupGameState(state->gameState); state->gameState = NULL;
 
@@ -582,6 +621,8 @@ char* getSolveCommandErrorString(int error) {
 			return FILES_COMMANDS_ERROR_BAD_FORMAT_CELL_VALUE_NOT_IN_RANGE_STR;
 		case LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE:
 			return COMMAND_ERROR_MEMORY_ALLOCATION_FAILURE_STR;
+		case LOAD_BOARD_FROM_FILE_UNSUPPORTED_VERSION:
+			return FILES_COMMANDS_ERROR_BAD_FORMAT_UNSUPPORTED_VERSION_STR;
 		}
 	}
 	}
@@ -631,7 +672,11 @@ PerformSolveCommandErrorCode performSolveCommand(State* state, Command* command)
 
 	Board board = {0};
 	PerformSolveCommandErrorCode retVal = ERROR_SUCCESS;
-	retVal = (PerformSolveCommandErrorCode)loadBoardFromFile(solveArguments->filePath, &board); /* Note: any superficially legitimate board may be
+
+	if (isJournalFile(solveArguments->filePath)) /* Restore from journal */
+		retVal = (PerformSolveCommandErrorCode)createGameStateFromJournal(solveArguments->filePath, GAME_MODE_SOLVE, &newGameState);
+	else
+		retVal = (PerformSolveCommandErrorCode)loadBoardFromFile(solveArguments->filePath, &board); /* Note: any superficially legitimate board may be
 		 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	   loaded for solving, even one that's inherently
 		 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	   unsolvable (i.e.: two fixed cells that are
 		 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	   neighbours and share the same value). */
@@ -639,12 +684,14 @@ PerformSolveCommandErrorCode performSolveCommand(State* state, Command* command)
 	if (retVal != ERROR_SUCCESS)
 		return PERFORM_SOLVE_COMMAND_ERROR_IN_LOAD_BOARD_FROM_FILE + retVal;
 
-	newGameState = createGameState(&board, GAME_MODE_SOLVE);
 	if (newGameState == NULL) {
+		newGameState = createGameState(&board, GAME_MODE_SOLVE);
+		if (newGameState == NULL) {
+			cleanupBoard(&board);
+			return PERFORM_SOLVE_COMMAND_MEMORY_ALLOCATION_FAILURE;
+		}
 		cleanupBoard(&board);
-		return PERFORM_SOLVE_COMMAND_MEMORY_ALLOCATION_FAILURE;
 	}
-	cleanupBoard(&board);
 
 	cleanupGameState(state->gameState); state->gameState = NULL;
 
@@ -1119,7 +1166,7 @@ randomlyFillEmptyCellErrorCode randomlyFillEmptyCell(Board* boardInOut, int row,
 		while (true) {
 			int MN = getBoardBlockSize_MN(boardInOut);
 			int value = (rand() % MN) + 1;
-			if (cellLegalValues.legalValues[value]) {
+			if (isValueInCandidateSet(cellLegalValues.legalValues, value)) {
 				setBoardCellValue(boardInOut, row, col, value);
 				break;
 			}
@@ -1297,6 +1344,7 @@ PerformGenerateCommandErrorCode performGenerateCommand(State* state, Command* co
 	PerformGenerateCommandErrorCode retVal = ERROR_SUCCESS;
 	bool severeErrorOccurred = false;
 	bool succeeded = false;
+	bool isSolvable = false;
 
 	int numTries = 0;
 	Board board = {0};
@@ -1324,25 +1372,25 @@ PerformGenerateCommandErrorCode performGenerateCommand(State* state, Command* co
 				continue;
 		}
 
-		switch (getBoardSolution(&board, &boardSolution)) {
-		case GET_BOARD_SOLUTION_SUCCESS:
-			randomlyClearYCells(&boardSolution, generateArguments->numCellsToClear);
-
-			if (makeMultiCellMove(state->gameState, &boardSolution)) {
-				retVal = ERROR_SUCCESS;
-				succeeded = true;
-			} else {
-				retVal = PERFORM_GENERATE_COMMAND_MEMORY_ALLOCATION_FAILURE;
-				severeErrorOccurred = true;
-			}
+		/* the board is completed into a random solution by the backtracking solver, which
+		   is far quicker than solving a fresh linear program on every try */
+		if (!findRandomSolutionUsingBacktracking(&board, &boardSolution, &isSolvable)) {
+			retVal = PERFORM_GENERATE_COMMAND_MEMORY_ALLOCATION_FAILURE;
+			severeErrorOccurred = true;
+			continue;
+		}
 
-			break;
-		case GET_BOARD_SOLUTION_BOARD_UNSOLVABLE:
-		case GET_BOARD_SOLUTION_COULD_NOT_SOLVE_BOARD:
+		if (!isSolvable)
 			continue;
-		case GET_BOARD_SOLUTION_MEMORY_ALLOCATION_FAILURE:
+
+		randomlyClearYCells(&boardSolution, generateArguments->numCellsToClear);
+
+		if (makeMultiCellMove(state->gameState, &boardSolution)) {
+			retVal = ERROR_SUCCESS;
+			succeeded = true;
+		} else {
+			retVal = PERFORM_GENERATE_COMMAND_MEMORY_ALLOCATION_FAILURE;
 			severeErrorOccurred = true;
-			continue;
 		}
 	}
 	cleanupBoard(&board);
@@ -1448,6 +1496,8 @@ char* getSaveCommandErrorString(int error) {
 			return FILES_COMMANDS_ERROR_WRITING_DIMENSIONS_ERROR_STR;
 		case SAVE_BOARD_TO_FILE_FAILED_TO_WRITE_A_CELL:
 			return FILES_COMMANDS_ERROR_WRITING_CELL_ERROR_STR;
+		case SAVE_BOARD_TO_FILE_MEMORY_ALLOCATION_FAILURE:
+			return COMMAND_ERROR_MEMORY_ALLOCATION_FAILURE_STR;
 		}
 	}
 	}
@@ -1471,7 +1521,15 @@ bool isSaveCommandErrorRecoverable(int error) {
 	case PERFORM_SAVE_COMMAND_MEMORY_ALLOCATION_FAILURE:
 		return false;
 	default:
-		return true;
+	{
+		SaveBoardToFileErrorCode errorCode = (SaveBoardToFileErrorCode)(error - PERFORM_SAVE_COMMAND_ERROR_IN_SAVE_BOARD_TO_FILE);
+		switch (errorCode) {
+		case SAVE_BOARD_TO_FILE_MEMORY_ALLOCATION_FAILURE:
+			return false;
+		default:
+			return true;
+		}
+	}
 	}
 }
 
@@ -2448,15 +2506,17 @@ size_t getMoveStrOutputSize(const Move* move, bool undo) {
  */
 size_t sprintMoveStrOutput(char* outStr, const Move* move, bool undo) {
 	char* start = outStr;
-	const Node* curr;
+	const CellChange* changes = NULL;
+	int i = 0;
  
 	if (move == NULL || getMoveSize(move) == 0) {
 		return sprintf(outStr, MOVE_EMPTY_OUTPUT_FORMAT);
 	}
 
-	curr = getFirstCellChange(move);
-	while (curr != NULL) {
-		CellChange* change = (CellChange*)getNodeData(curr);
+	/* Note: changes are listed most recent first */
+	changes = getMoveCellChanges(move);
+	for (i = getMoveSize(move) - 1; i >= 0; i--) {
+		const CellChange* change = &(changes[i]);
 		outStr += sprintf(
 				outStr,
 				undo ? SINGLE_CELL_MOVE_UNDO_OUTPUT_FORMAT : SINGLE_CELL_MOVE_REDO_OUTPUT_FORMAT,
@@ -2464,7 +2524,6 @@ size_t sprintMoveStrOutput(char* outStr, const Move* move, bool undo) {
 				change->row + 1, /* Note: +1 because user indicies are not zero based */
 				change->prevVal,
 				change->newVal);
-		curr = getNodeNext(curr);
 	}
 
 	return outStr - start;
@@ -2586,6 +2645,80 @@ char* getRedoCommandStrOutput(Command* command, GameState* gameState) {
 
 /*************************** AUTOFILL ***************************/
 
+/**
+ * The names of the modes the Autofill command may be applied in.
+ */
+#define AUTOFILL_MODE_SINGLE_PASS_STRING ("once")
+#define AUTOFILL_MODE_FIXPOINT_STRING ("fixpoint")
+#define AUTOFILL_MODES_RANGE_STRING ("once, fixpoint")
+
+/**
+ * autofillArgsParser concretely implements an argument parser for the 'autofill' command.
+ *
+ * @param arg			[in] the string containing the specific argument currently
+ * 						being parsed and assigned to the appropriate attribute
+ * @param arguments		[in, out] a generic pointer to a command argument struct, casted
+ * 						to be a AutofillCommandArguments struct containing the arguments
+ * @param argNo 		[in] the parsed argument's index: 1 is the name of the mode
+ * @return true 		iff parseStringArg successfully parsed and set the argument
+ * @return false 		iff the parsing failed
+ */
+bool autofillArgsParser(char* arg, int argNo, void* arguments) {
+	AutofillCommandArguments* autofillArguments = (AutofillCommandArguments*)arguments;
+	switch (argNo) {
+	case 1:
+		return parseStringArg(arg, &(autofillArguments->modeName));
+	}
+	return false;
+}
+
+/**
+ * Checks if a particular argument of the Autofill command is in its correct range.
+ * 
+ * @param arguments 	[in] AutofillCommandArguments cast to a void pointer for generality
+ * 						purposes
+ * @param argNo 		[in] The index of the argument examined: 1 is the name of the mode
+ * @param gameState 	[in] The GameState to which this Autofill Command is applied
+ * @return true 		iff the argument is in its correct range
+ * @return false 		iff the argument is out of range
+ */
+bool autofillArgsRangeChecker(void* arguments, int argNo, GameState* gameState) {
+	AutofillCommandArguments* autofillArguments = (AutofillCommandArguments*)arguments;
+
+	UNUSED(gameState);
+
+	switch (argNo) {
+	case 1:
+		return (strcmp(autofillArguments->modeName, AUTOFILL_MODE_SINGLE_PASS_STRING) == 0) ||
+			   (strcmp(autofillArguments->modeName, AUTOFILL_MODE_FIXPOINT_STRING) == 0);
+	}
+	return false;
+}
+
+/**
+ * Get a string describing the range of legal values for a particular argument of the
+ * Autofill command.
+ * 
+ * @param argNo 		[in] The index of the argument examined: 1 is the name of the mode
+ * @param gameState 	[in] The GameState on which the Autofill Command was attempted
+ * @return char* 		The requested output string
+ */
+char* autofillArgsGetExpectedRangeString(int argNo, GameState* gameState) {
+	char* str = NULL;
+
+	UNUSED(gameState);
+
+	switch (argNo) {
+	case 1:
+		str = calloc(sizeof(AUTOFILL_MODES_RANGE_STRING), sizeof(char));
+		if (str != NULL)
+			strcpy(str, AUTOFILL_MODES_RANGE_STRING);
+		break;
+	}
+
+	return str;
+}
+
 /**
  * Errors that may occur while performing the Autofill command. 
  */
@@ -2631,7 +2764,7 @@ bool isAutofillCommandErrorRecoverable(int error) {
 }
 
 /**
- * Performs the Autofill command.
+ * Performs the Autofill command, in single pass mode unless another mode was provided.
  * 
  * @param state 			[in, out] State to which the command will be applied
  * @param command 			[in] Command to perform, containing the AutofillCommandArguments
@@ -2640,9 +2773,14 @@ bool isAutofillCommandErrorRecoverable(int error) {
  */
 PerformAutofillCommandErrorCode performAutofillCommand(State* state, Command* command) {
 	AutofillCommandArguments* autofillArguments = (AutofillCommandArguments*)(command->arguments);
-	Move* move = NULL;
+	AutofillMode mode = AUTOFILL_MODE_SINGLE_PASS;
+	const Move* move = NULL;
+
+	if ((autofillArguments->modeName != NULL) &&
+		(strcmp(autofillArguments->modeName, AUTOFILL_MODE_FIXPOINT_STRING) == 0))
+		mode = AUTOFILL_MODE_FIXPOINT;
 
-	if (!autofill(state->gameState, &move)) {
+	if (!autofill(state->gameState, mode, &move)) {
 		return PERFORM_AUTO_FILL_COMMAND_MEMORY_ALLOCATION_FAILURE;
 	}
 
@@ -2676,6 +2814,8 @@ char* getAutofillCommandStrOutput(Command* command, GameState* gameState) {
 }
 
 /*************************** RESET ***************************/
+#define RESET_COMMAND_NOTHING_TO_RESET_FAILURE_STR ("No move to reset\n")
+
 /**
  * Errors that may occur while performing the Reset command. 
  */
@@ -2683,6 +2823,22 @@ typedef enum {
 	PERFORM_RESET_COMMAND_NO_CHANGES = 1
 } PerformResetCommandErrorCode;
 
+/**
+ * Get the string description to match the provided PerformResetCommandErrorCode.
+ * 
+ * @param error     [in] The error number cast to an integer, for signature generality purposes
+ * @return char*    String description of the error to output
+ */
+char* getResetCommandErrorString(int error) {
+	PerformResetCommandErrorCode errorCode = (PerformResetCommandErrorCode)error;
+
+	switch (errorCode) {
+	case PERFORM_RESET_COMMAND_NO_CHANGES:
+		return RESET_COMMAND_NOTHING_TO_RESET_FAILURE_STR;
+	}
+	return NULL;
+}
+
 /**
  * Checks whether an error that occurred while performing the Reset command
  * can be recovered from or not. If the error is fatal, the game cannot continue and is
@@ -2749,6 +2905,162 @@ char* getResetCommandStrOutput(Command* command, GameState* gameState) {
 
 /*************************** NUM SOLUTIONS ***************************/
 #define NUM_SOLUTIONS_OUTPUT_FORMAT ("Number of solutions: %d\n")
+#define NUM_SOLUTIONS_LIMITED_OUTPUT_FORMAT ("Number of solutions: at least %d\n")
+#define NUM_SOLUTIONS_LIMIT_RANGE_STRING ("non-negative integers, 0 meaning no limit")
+#define NUM_SOLUTIONS_SPLIT_DEPTH_RANGE_STRING ("positive integers")
+
+/**
+ * The names of the search methods the Num Solutions command may count by. The first is
+ * the default one.
+ */
+#define NUM_SOLUTIONS_METHOD_MRV_STRING ("mrv")
+#define NUM_SOLUTIONS_METHOD_ORDERED_STRING ("ordered")
+#define NUM_SOLUTIONS_METHOD_DLX_STRING ("dlx")
+#define NUM_SOLUTIONS_METHODS_RANGE_STRING ("mrv, ordered, dlx")
+
+/**
+ * numSolutionsArgsParser concretely implements an argument parser for the 'num_solutions' command.
+ *
+ * @param arg			[in] the string containing the specific argument currently
+ * 						being parsed and assigned to the appropriate attribute
+ * @param arguments		[in, out] a generic pointer to a command argument struct, casted
+ * 						to be a NumSolutionsCommandArguments struct containing the arguments
+ * @param argNo 		[in] the parsed argument's index: 1 is the name of the search method,
+ * 						2 is the number of threads, 3 is the number of solutions to stop at,
+ * 						4 is the depth to which the search tree is split among the threads
+ * @return true 		iff parseStringArg or parseIntArg successfully parsed and set the argument
+ * @return false 		iff the parsing failed
+ */
+bool numSolutionsArgsParser(char* arg, int argNo, void* arguments) {
+	NumSolutionsCommandArguments* numSolutionsArguments = (NumSolutionsCommandArguments*)arguments;
+	switch (argNo) {
+	case 1:
+		return parseStringArg(arg, &(numSolutionsArguments->methodName));
+	case 2:
+		return parseIntArg(arg, &(numSolutionsArguments->numThreads));
+	case 3:
+		return parseIntArg(arg, &(numSolutionsArguments->maxNumSolutions));
+	case 4:
+		return parseIntArg(arg, &(numSolutionsArguments->splitDepth));
+	}
+	return false;
+}
+
+/**
+ * Checks if a particular argument of the Num Solutions command is in its correct range.
+ * 
+ * @param arguments 	[in] NumSolutionsCommandArguments cast to a void pointer for generality
+ * 						purposes
+ * @param argNo 		[in] The index of the argument examined: 1 is the name of the search method,
+ * 						2 is the number of threads, 3 is the number of solutions to stop at,
+ * 						4 is the depth to which the search tree is split among the threads
+ * @param gameState 	[in] The GameState to which this Num Solutions Command is applied
+ * @return true 		iff the argument is in its correct range
+ * @return false 		iff the argument is out of range
+ */
+bool numSolutionsArgsRangeChecker(void* arguments, int argNo, GameState* gameState) {
+	NumSolutionsCommandArguments* numSolutionsArguments = (NumSolutionsCommandArguments*)arguments;
+
+	UNUSED(gameState);
+
+	switch (argNo) {
+	case 1:
+		return (strcmp(numSolutionsArguments->methodName, NUM_SOLUTIONS_METHOD_MRV_STRING) == 0) ||
+			   (strcmp(numSolutionsArguments->methodName, NUM_SOLUTIONS_METHOD_ORDERED_STRING) == 0) ||
+			   (strcmp(numSolutionsArguments->methodName, NUM_SOLUTIONS_METHOD_DLX_STRING) == 0);
+	case 2:
+		return (numSolutionsArguments->numThreads >= 1) &&
+			   (numSolutionsArguments->numThreads <= PARALLEL_SOLVER_MAX_NUM_THREADS);
+	case 3:
+		return numSolutionsArguments->maxNumSolutions >= 0; /* Note: 0 lifts the limit, so that a split depth may follow */
+	case 4:
+		return numSolutionsArguments->splitDepth >= 1;
+	}
+	return false;
+}
+
+/**
+ * Get a string describing the range of legal values for a particular argument of the
+ * Num Solutions command.
+ * 
+ * @param argNo 		[in] The index of the argument examined: 1 is the name of the search method,
+ * 						2 is the number of threads, 3 is the number of solutions to stop at,
+ * 						4 is the depth to which the search tree is split among the threads
+ * @param gameState 	[in] The GameState on which the Num Solutions Command was attempted
+ * @return char* 		The requested output string
+ */
+char* numSolutionsArgsGetExpectedRangeString(int argNo, GameState* gameState) {
+	char* str = NULL;
+
+	UNUSED(gameState);
+
+	switch (argNo) {
+	case 1:
+		str = calloc(sizeof(NUM_SOLUTIONS_METHODS_RANGE_STRING), sizeof(char));
+		if (str != NULL)
+			strcpy(str, NUM_SOLUTIONS_METHODS_RANGE_STRING);
+		break;
+	case 2:
+		str = calloc(INT_RANGE_FORMAT_SIZE, sizeof(char));
+		if (str != NULL)
+			sprintf(str, INT_RANGE_FORMAT, INCLUSIVE_OPENER, 1, PARALLEL_SOLVER_MAX_NUM_THREADS, INCLUSIVE_CLOSER);
+		break;
+	case 3:
+		str = calloc(sizeof(NUM_SOLUTIONS_LIMIT_RANGE_STRING), sizeof(char));
+		if (str != NULL)
+			strcpy(str, NUM_SOLUTIONS_LIMIT_RANGE_STRING);
+		break;
+	case 4:
+		str = calloc(sizeof(NUM_SOLUTIONS_SPLIT_DEPTH_RANGE_STRING), sizeof(char));
+		if (str != NULL)
+			strcpy(str, NUM_SOLUTIONS_SPLIT_DEPTH_RANGE_STRING);
+		break;
+	}
+
+	return str;
+}
+
+/**
+ * Checks whether the provided NumSolutionsCommandArguments name a particular method.
+ * 
+ * @param args 			[in] The arguments of the Num Solutions command
+ * @param methodName 	[in] The name of the method
+ * @return true 		iff the arguments name that method
+ * @return false 		otherwise, including when no method was named
+ */
+bool isNumSolutionsCommandMethod(const NumSolutionsCommandArguments* args, const char* methodName) {
+	return (args->methodName != NULL) && (strcmp(args->methodName, methodName) == 0);
+}
+
+/**
+ * Calculates the number of solutions to a board using the ordered backtracking method,
+ * with the signature of a SubtreeSolutionsCounter.
+ * 
+ * @param board 			[in] Board to calculate the number of solutions for
+ * @param maxNumSolutions 	[in] The number of solutions at which the search stops, or 0
+ * 							to exhaust the search
+ * @param numSolutions 		[in, out] Pointer to an integer to be assigned with the result
+ * @return true 			iff the procedure was successful
+ * @return false 			iff a memory error occurred
+ */
+bool calculateNumSolutionsInOrder(const Board* board, int maxNumSolutions, int* numSolutions) {
+	return calculateNumSolutionsUsingMethod(board, BACKTRACK_SOLVER_METHOD_ORDERED, maxNumSolutions, numSolutions, NULL);
+}
+
+/**
+ * Get the counter of the method named in the provided NumSolutionsCommandArguments.
+ * 
+ * @param args 						[in] The arguments of the Num Solutions command
+ * @return SubtreeSolutionsCounter 	The counter of the named method, or of the default
+ * 									method if none was named
+ */
+SubtreeSolutionsCounter getNumSolutionsCommandCounter(const NumSolutionsCommandArguments* args) {
+	if (isNumSolutionsCommandMethod(args, NUM_SOLUTIONS_METHOD_DLX_STRING))
+		return calculateNumSolutionsUsingDancingLinksUpToLimit;
+	if (isNumSolutionsCommandMethod(args, NUM_SOLUTIONS_METHOD_ORDERED_STRING))
+		return calculateNumSolutionsInOrder;
+	return calculateNumSolutionsUpToLimit;
+}
 
 /**
  * Errors that may occur while performing the Num Solutions command. 
@@ -2805,8 +3117,9 @@ bool isNumSolutionsCommandErrorRecoverable(int error) {
 PerformNumSoltionsCommandErrorCode performNumSolutionsCommand(State* state, Command* command) {	
 	NumSolutionsCommandArguments* args = (NumSolutionsCommandArguments*) command->arguments;
 	int numSolutions = 0;
+	int numThreads = (args->numThreads > 0) ? args->numThreads : getDefaultNumSolverThreads();
 
-	if (!calculateNumSolutions(getPuzzle(state->gameState), &numSolutions)) {
+	if (!calculateNumSolutionsInParallel(getPuzzle(state->gameState), getNumSolutionsCommandCounter(args), numThreads, args->splitDepth, args->maxNumSolutions, &numSolutions)) {
 		return PERFORM_NUM_SOLUTIONS_COMMAND_MEMORY_ALLOCATION_FAILURE;
 	}
 
@@ -2827,13 +3140,19 @@ char* getNumSolutionsCommandStrOutput(Command* command, GameState* gameState) {
 	char* str = NULL;
 	size_t numCharsRequired = 0;
 
+	const char* format = NUM_SOLUTIONS_OUTPUT_FORMAT;
+
 	UNUSED(gameState);
 
-	numCharsRequired = sizeof(NUM_SOLUTIONS_OUTPUT_FORMAT) + getNumDecDigitsInNumber(numSolutionsArguments->numSolutionsOut); /* Note: conservative upper boundary */
+	if ((numSolutionsArguments->maxNumSolutions > 0) &&
+		(numSolutionsArguments->numSolutionsOut >= numSolutionsArguments->maxNumSolutions))
+		format = NUM_SOLUTIONS_LIMITED_OUTPUT_FORMAT; /* the count stopped at the limit */
+
+	numCharsRequired = strlen(format) + 1 + getNumDecDigitsInNumber(numSolutionsArguments->numSolutionsOut); /* Note: conservative upper boundary */
 
 	str = calloc(numCharsRequired, sizeof(char));
 	if (str != NULL) {
-		sprintf(str, NUM_SOLUTIONS_OUTPUT_FORMAT, numSolutionsArguments->numSolutionsOut);
+		sprintf(str, format, numSolutionsArguments->numSolutionsOut);
 	}
 
 	return str;
@@ -2916,6 +3235,284 @@ char* getIgnoreCommandStrOutput(Command* command, GameState* gameState) { /* Not
 }
 
 
+/*************************** SOLVER ***************************/
+
+/**
+ * The names of the backends the Solver command may select.
+ */
+#define SOLVER_BACKEND_NATIVE_STRING ("native")
+#define SOLVER_BACKEND_LINEAR_PROGRAMMING_STRING ("ilp")
+#define SOLVER_BACKENDS_RANGE_STRING ("native, ilp")
+
+/**
+ * solverArgsParser concretely implements an argument parser for the 'solver' command.
+ *
+ * @param arg			[in] the string containing the specific argument currently
+ * 						being parsed and assigned to the appropriate attribute
+ * @param arguments		[in, out] a generic pointer to a command argument struct, casted
+ * 						to be a SolverCommandArguments struct containing the arguments
+ * @param argNo 		[in] the parsed argument's index: 1 is the name of the backend
+ * @return true 		iff parseStringArg successfully parsed and set the argument
+ * @return false 		iff the parsing failed
+ */
+bool solverArgsParser(char* arg, int argNo, void* arguments) {
+	SolverCommandArguments* solverArguments = (SolverCommandArguments*)arguments;
+	switch (argNo) {
+	case 1:
+		return parseStringArg(arg, &(solverArguments->backendName));
+	}
+	return false;
+}
+
+/**
+ * Checks if a particular argument of the Solver command is in its correct range.
+ * 
+ * @param arguments 	[in] SolverCommandArguments cast to a void pointer for generality
+ * 						purposes
+ * @param argNo 		[in] The index of the argument examined: 1 is the name of the backend
+ * @param gameState 	[in] The GameState to which this Solver Command is applied
+ * @return true 		iff the argument is in its correct range
+ * @return false 		iff the argument is out of range
+ */
+bool solverArgsRangeChecker(void* arguments, int argNo, GameState* gameState) {
+	SolverCommandArguments* solverArguments = (SolverCommandArguments*)arguments;
+
+	UNUSED(gameState);
+
+	switch (argNo) {
+	case 1:
+		return (strcmp(solverArguments->backendName, SOLVER_BACKEND_NATIVE_STRING) == 0) ||
+			   (strcmp(solverArguments->backendName, SOLVER_BACKEND_LINEAR_PROGRAMMING_STRING) == 0);
+	}
+	return false;
+}
+
+/**
+ * Get a string describing the range of legal values for a particular argument of the
+ * Solver command.
+ * 
+ * @param argNo 		[in] The index of the argument examined: 1 is the name of the backend
+ * @param gameState 	[in] The GameState on which the Solver Command was attempted
+ * @return char* 		The requested output string
+ */
+char* solverArgsGetExpectedRangeString(int argNo, GameState* gameState) {
+	char* str = NULL;
+
+	UNUSED(gameState);
+
+	switch (argNo) {
+	case 1:
+		str = calloc(sizeof(SOLVER_BACKENDS_RANGE_STRING), sizeof(char));
+		if (str != NULL)
+			strcpy(str, SOLVER_BACKENDS_RANGE_STRING);
+		break;
+	}
+
+	return str;
+}
+
+/**
+ * Errors that may occur while performing the Solver command. 
+ */
+typedef enum {
+	PERFORM_SOLVER_COMMAND_BACKEND_NOT_AVAILABLE = 1
+} PerformSolverCommandErrorCode;
+
+#define SOLVER_ERROR_BACKEND_NOT_AVAILABLE_STR ("linear programming is not available in this build\n")
+
+/**
+ * Get the string description to match the provided PerformSolverCommandErrorCode.
+ * 
+ * @param error 	[in] The error number cast to an integer, for signature generality purposes
+ * @return char* 	String description of the error to output
+ */
+char* getSolverCommandErrorString(int error) {
+	PerformSolverCommandErrorCode errorCode = (PerformSolverCommandErrorCode)error;
+
+	switch (errorCode) {
+	case PERFORM_SOLVER_COMMAND_BACKEND_NOT_AVAILABLE:
+		return SOLVER_ERROR_BACKEND_NOT_AVAILABLE_STR;
+	}
+
+	return NULL;
+}
+
+/**
+ * Checks whether an error that occurred while performing the Solver command
+ * can be recovered from or not. If the error is fatal, the game cannot continue and is
+ * exited.
+ * 
+ * @param error 	[in] The error number cast to an integer, for signature generality purposes
+ * @return true 	iff the error can be recovered from. 
+ * 					All errors for this command are recoverable.
+ * @return false 	false is never returned
+ */
+bool isSolverCommandErrorRecoverable(int error) {
+	PerformSolverCommandErrorCode errorCode = (PerformSolverCommandErrorCode)error;
+
+	switch (errorCode) {
+	default:
+		return true;
+	}
+}
+
+/**
+ * Performs the Solver command, selecting the backend by which boards are solved from
+ * now on.
+ * 
+ * @param state 			[in, out] State to which the command will be applied
+ * @param command 			[in] Command to perform, containing the SolverCommandArguments
+ * @return PerformSolverCommandErrorCode 	The number of error that has occurred, or ERROR_SUCCESS
+ * 											on success
+ */
+PerformSolverCommandErrorCode performSolverCommand(State* state, Command* command) {
+	SolverCommandArguments* solverArguments = (SolverCommandArguments*)(command->arguments);
+
+	UNUSED(state);
+
+	if (strcmp(solverArguments->backendName, SOLVER_BACKEND_LINEAR_PROGRAMMING_STRING) == 0) {
+		if (!isLinearProgrammingAvailable())
+			return PERFORM_SOLVER_COMMAND_BACKEND_NOT_AVAILABLE;
+		setBoardSolverBackend(BOARD_SOLVER_BACKEND_LINEAR_PROGRAMMING);
+	} else {
+		setBoardSolverBackend(BOARD_SOLVER_BACKEND_NATIVE);
+	}
+
+	return ERROR_SUCCESS;
+}
+
+/**
+ * Get the output string for a Solver command.
+ * Solver does not actually output anything, this function exists for generality and
+ * completeness purposes.
+ * 
+ * @param command 		[in] Command struct - unused
+ * @param gameState 	[in] Game state - unused
+ * @return char* 		The appropriate output string - in this case, an empty string
+ */
+char* getSolverCommandStrOutput(Command* command, GameState* gameState) {
+	char* str = NULL;
+	size_t numCharsRequired = 0;
+	char* emptyString = "";
+
+	UNUSED(command);
+	UNUSED(gameState);
+
+	numCharsRequired = strlen(emptyString) + 1;
+	str = calloc(numCharsRequired, sizeof(char));
+
+	return str;
+}
+
+/*************************** JOURNAL ***************************/
+
+/**
+ * journalArgsParser concretely implements an argument parser for the 'journal' command.
+ *
+ * @param arg			[in] the string containing the specific argument currently
+ * 						being parsed and assigned to the appropriate attribute
+ * @param arguments		[in, out] a generic pointer to a command argument struct, casted
+ * 						to be a JournalCommandArguments struct containing the arguments
+ * @param argNo 		[in] the parsed argument's index: 1 is the path to the file the
+ * 						game is journaled to
+ * @return true 		iff parseStringArg successfully parsed and set the argument
+ * @return false 		iff the parsing failed
+ */
+bool journalArgsParser(char* arg, int argNo, void* arguments) {
+	JournalCommandArguments* journalArguments = (JournalCommandArguments*)arguments;
+	switch (argNo) {
+	case 1:
+		return parseStringArg(arg, &(journalArguments->filePath));
+	}
+	return false;
+}
+
+/**
+ * Errors that may occur while performing the Journal command. 
+ */
+typedef enum {
+	PERFORM_JOURNAL_COMMAND_FILE_COULD_NOT_BE_WRITTEN = 1
+} PerformJournalCommandErrorCode;
+
+#define JOURNAL_ERROR_FILE_COULD_NOT_BE_WRITTEN_STR ("journal file could not be written\n")
+
+/**
+ * Get the string description to match the provided PerformJournalCommandErrorCode.
+ * 
+ * @param error 	[in] The error number cast to an integer, for signature generality purposes
+ * @return char* 	String description of the error to output
+ */
+char* getJournalCommandErrorString(int error) {
+	PerformJournalCommandErrorCode errorCode = (PerformJournalCommandErrorCode)error;
+
+	switch (errorCode) {
+	case PERFORM_JOURNAL_COMMAND_FILE_COULD_NOT_BE_WRITTEN:
+		return JOURNAL_ERROR_FILE_COULD_NOT_BE_WRITTEN_STR;
+	}
+
+	return NULL;
+}
+
+/**
+ * Checks whether an error that occurred while performing the Journal command
+ * can be recovered from or not. If the error is fatal, the game cannot continue and is
+ * exited.
+ * 
+ * @param error 	[in] The error number cast to an integer, for signature generality purposes
+ * @return true 	iff the error can be recovered from. 
+ * 					All errors for this command are recoverable.
+ * @return false 	false is never returned
+ */
+bool isJournalCommandErrorRecoverable(int error) {
+	PerformJournalCommandErrorCode errorCode = (PerformJournalCommandErrorCode)error;
+
+	switch (errorCode) {
+	default:
+		return true;
+	}
+}
+
+/**
+ * Performs the Journal command, journaling the current game to the provided file from
+ * now on. Loading that file with a Solve or an Edit command restores the game.
+ * 
+ * @param state 			[in, out] State to which the command will be applied
+ * @param command 			[in] Command to perform, containing the JournalCommandArguments
+ * @return PerformJournalCommandErrorCode 	The number of error that has occurred, or ERROR_SUCCESS
+ * 											on success
+ */
+PerformJournalCommandErrorCode performJournalCommand(State* state, Command* command) {
+	JournalCommandArguments* journalArguments = (JournalCommandArguments*)(command->arguments);
+
+	if (!startGameJournal(state->gameState, journalArguments->filePath))
+		return PERFORM_JOURNAL_COMMAND_FILE_COULD_NOT_BE_WRITTEN;
+
+	return ERROR_SUCCESS;
+}
+
+/**
+ * Get the output string for a Journal command.
+ * Journal does not actually output anything, this function exists for generality and
+ * completeness purposes.
+ * 
+ * @param command 		[in] Command struct - unused
+ * @param gameState 	[in] Game state - unused
+ * @return char* 		The appropriate output string - in this case, an empty string
+ */
+char* getJournalCommandStrOutput(Command* command, GameState* gameState) {
+	char* str = NULL;
+	size_t numCharsRequired = 0;
+	char* emptyString = "";
+
+	UNUSED(command);
+	UNUSED(gameState);
+
+	numCharsRequired = strlen(emptyString) + 1;
+	str = calloc(numCharsRequired, sizeof(char));
+
+	return str;
+}
+
 /***************************************************************************************/
 
 commandArgsParser getCommandArgsParser(CommandType commandType) {
@@ -2938,12 +3535,18 @@ commandArgsParser getCommandArgsParser(CommandType commandType) {
 		return hintArgsParser;
 	case COMMAND_TYPE_GUESS_HINT:
 		return guessHintArgsParser;
+	case COMMAND_TYPE_NUM_SOLUTIONS:
+		return numSolutionsArgsParser;
+	case COMMAND_TYPE_SOLVER:
+		return solverArgsParser;
+	case COMMAND_TYPE_JOURNAL:
+		return journalArgsParser;
+	case COMMAND_TYPE_AUTOFILL:
+		return autofillArgsParser;
 	case COMMAND_TYPE_PRINT_BOARD:
 	case COMMAND_TYPE_VALIDATE:
 	case COMMAND_TYPE_UNDO:
 	case COMMAND_TYPE_REDO:
-	case COMMAND_TYPE_NUM_SOLUTIONS:
-	case COMMAND_TYPE_AUTOFILL:
 	case COMMAND_TYPE_RESET:
 	case COMMAND_TYPE_EXIT:
 	case COMMAND_TYPE_IGNORE:
@@ -2964,6 +3567,13 @@ commandArgsRangeChecker getCommandArgsRangeChecker(CommandType commandType) {
 		return guessHintArgsRangeChecker;
 	case COMMAND_TYPE_GUESS:
 		return guessArgsRangeChecker;
+	case COMMAND_TYPE_NUM_SOLUTIONS:
+		return numSolutionsArgsRangeChecker;
+	case COMMAND_TYPE_SOLVER:
+		return solverArgsRangeChecker;
+	case COMMAND_TYPE_AUTOFILL:
+		return autofillArgsRangeChecker;
+	case COMMAND_TYPE_JOURNAL:
 	case COMMAND_TYPE_SOLVE:
 	case COMMAND_TYPE_EDIT:
 	case COMMAND_TYPE_MARK_ERRORS:
@@ -2972,8 +3582,6 @@ commandArgsRangeChecker getCommandArgsRangeChecker(CommandType commandType) {
 	case COMMAND_TYPE_UNDO:
 	case COMMAND_TYPE_REDO:
 	case COMMAND_TYPE_SAVE:
-	case COMMAND_TYPE_NUM_SOLUTIONS:
-	case COMMAND_TYPE_AUTOFILL:
 	case COMMAND_TYPE_RESET:
 	case COMMAND_TYPE_EXIT:
 	case COMMAND_TYPE_IGNORE:
@@ -3000,6 +3608,13 @@ commandArgsGetExpectedRangeStringFunc getGetCommandArgsExpectedRangeStringFunc(C
 			return guessHintArgsGetExpectedRangeString;
 		case COMMAND_TYPE_GUESS:
 			return guessArgsGetExpectedRangeString;
+		case COMMAND_TYPE_NUM_SOLUTIONS:
+			return numSolutionsArgsGetExpectedRangeString;
+		case COMMAND_TYPE_SOLVER:
+			return solverArgsGetExpectedRangeString;
+		case COMMAND_TYPE_AUTOFILL:
+			return autofillArgsGetExpectedRangeString;
+		case COMMAND_TYPE_JOURNAL:
 		case COMMAND_TYPE_SOLVE:
 		case COMMAND_TYPE_EDIT:
 		case COMMAND_TYPE_MARK_ERRORS:
@@ -3008,8 +3623,6 @@ commandArgsGetExpectedRangeStringFunc getGetCommandArgsExpectedRangeStringFunc(C
 		case COMMAND_TYPE_UNDO:
 		case COMMAND_TYPE_REDO:
 		case COMMAND_TYPE_SAVE:
-		case COMMAND_TYPE_NUM_SOLUTIONS:
-		case COMMAND_TYPE_AUTOFILL:
 		case COMMAND_TYPE_RESET:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
@@ -3042,6 +3655,8 @@ commandArgsValidator getCommandArgsValidator(CommandType commandType) {
 	case COMMAND_TYPE_NUM_SOLUTIONS:
 	case COMMAND_TYPE_AUTOFILL:
 	case COMMAND_TYPE_RESET:
+	case COMMAND_TYPE_SOLVER:
+	case COMMAND_TYPE_JOURNAL:
 	case COMMAND_TYPE_EXIT:
 	case COMMAND_TYPE_IGNORE:
 		return NULL;
@@ -3074,6 +3689,8 @@ getCommandArgsValidatorErrorStringFunc getGetCommandArgsValidatorErrorString(Com
 	case COMMAND_TYPE_NUM_SOLUTIONS:
 	case COMMAND_TYPE_AUTOFILL:
 	case COMMAND_TYPE_RESET:
+	case COMMAND_TYPE_SOLVER:
+	case COMMAND_TYPE_JOURNAL:
 	case COMMAND_TYPE_EXIT:
 	case COMMAND_TYPE_IGNORE:
 		return NULL;
@@ -3292,6 +3909,8 @@ IsBoardValidForCommandErrorCode isBoardValidForCommand(State* state, Command* co
 		case COMMAND_TYPE_UNDO:
 		case COMMAND_TYPE_REDO:
 		case COMMAND_TYPE_RESET:
+		case COMMAND_TYPE_SOLVER:
+		case COMMAND_TYPE_JOURNAL:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
 			return ERROR_SUCCESS;
@@ -3377,6 +3996,10 @@ int performCommand(State* state, Command* command) {
 			return performAutofillCommand(state, command);
 		case COMMAND_TYPE_RESET:
 			return performResetCommand(state, command);
+		case COMMAND_TYPE_SOLVER:
+			return performSolverCommand(state, command);
+		case COMMAND_TYPE_JOURNAL:
+			return performJournalCommand(state, command);
 		case COMMAND_TYPE_PRINT_BOARD:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
@@ -3422,7 +4045,12 @@ getCommandErrorStringFunc getGetCommandErrorStringFunc(CommandType type) {
 			return getNumSolutionsCommandErrorString;
 		case COMMAND_TYPE_AUTOFILL:
 			return getAutoFillCommandErrorString;
+		case COMMAND_TYPE_SOLVER:
+			return getSolverCommandErrorString;
+		case COMMAND_TYPE_JOURNAL:
+			return getJournalCommandErrorString;
 		case COMMAND_TYPE_RESET:
+			return getResetCommandErrorString;
 		case COMMAND_TYPE_PRINT_BOARD:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
@@ -3475,6 +4103,10 @@ isCommandErrorRecoverableFunc getIsCommandErrorRecoverableFunc(CommandType type)
 			return isAutofillCommandErrorRecoverable;
 		case COMMAND_TYPE_RESET:
 			return isResetCommandErrorRecoverable;
+		case COMMAND_TYPE_SOLVER:
+			return isSolverCommandErrorRecoverable;
+		case COMMAND_TYPE_JOURNAL:
+			return isJournalCommandErrorRecoverable;
 		case COMMAND_TYPE_PRINT_BOARD:
 		case COMMAND_TYPE_EXIT:
 		case COMMAND_TYPE_IGNORE:
@@ -3527,6 +4159,10 @@ getCommandStrOutputFunc getGetCommandStrOutputFunc(CommandType type) {
 			return getAutofillCommandStrOutput;
 		case COMMAND_TYPE_RESET:
 			return getResetCommandStrOutput;
+		case COMMAND_TYPE_SOLVER:
+			return getSolverCommandStrOutput;
+		case COMMAND_TYPE_JOURNAL:
+			return getJournalCommandStrOutput;
 		case COMMAND_TYPE_PRINT_BOARD:
 			return getPrintBoardCommandStrOutput;
 		case COMMAND_TYPE_EXIT:
@@ -3561,6 +4197,8 @@ bool shouldPrintBoardPostCommand(CommandType commandType) {
 	case COMMAND_TYPE_HINT:
 	case COMMAND_TYPE_GUESS_HINT:
 	case COMMAND_TYPE_NUM_SOLUTIONS:
+	case COMMAND_TYPE_SOLVER:
+	case COMMAND_TYPE_JOURNAL:
 	case COMMAND_TYPE_EXIT:
 	case COMMAND_TYPE_IGNORE:
 		return false;
@@ -3756,6 +4394,8 @@ commandArgsCleaner getCommandArgsCleaner(CommandType commandType) {
 	case COMMAND_TYPE_NUM_SOLUTIONS:
 	case COMMAND_TYPE_AUTOFILL:
 	case COMMAND_TYPE_RESET:
+	case COMMAND_TYPE_SOLVER:
+	case COMMAND_TYPE_JOURNAL:
 	case COMMAND_TYPE_EXIT:
 	case COMMAND_TYPE_IGNORE:
 		return NULL;
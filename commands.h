@@ -43,6 +43,8 @@
 #define NUM_SOLUTIONS_COMMAND_TYPE_STRING ("num_solutions")
 #define AUTOFILL_COMMAND_TYPE_STRING ("autofill")
 #define RESET_COMMAND_TYPE_STRING ("reset")
+#define SOLVER_COMMAND_TYPE_STRING ("solver")
+#define JOURNAL_COMMAND_TYPE_STRING ("journal")
 #define EXIT_COMMAND_TYPE_STRING ("exit")
 #define IGNORE_COMMAND_TYPE_STRING ("ignore")
 
@@ -50,9 +52,9 @@
  * Map between the three game modes and the commands each of them allows.
  * 
  */
-#define INIT_MODE_LIST_OF_ALLOWED_COMMANDS ("solve, edit, exit")
-#define EDIT_MODE_LIST_OF_ALLOWED_COMMANDS ("solve, edit, print_board, set, validate, generate, undo, redo, save, num_solutions, reset, exit")
-#define SOLVE_MODE_LIST_OF_ALLOWED_COMMANDS ("solve, edit, mark_errors, print_board, set, validate, guess, undo, redo, save, hint, guess_hint, num_solutions, autofill, reset, exit")
+#define INIT_MODE_LIST_OF_ALLOWED_COMMANDS ("solve, edit, solver, exit")
+#define EDIT_MODE_LIST_OF_ALLOWED_COMMANDS ("solve, edit, print_board, set, validate, generate, undo, redo, save, num_solutions, reset, solver, journal, exit")
+#define SOLVE_MODE_LIST_OF_ALLOWED_COMMANDS ("solve, edit, mark_errors, print_board, set, validate, guess, undo, redo, save, hint, guess_hint, num_solutions, autofill, reset, solver, journal, exit")
 
 /**
  * Map between the commands and the game modes they are allowed in.
@@ -74,6 +76,8 @@
 #define NUM_SOLUTIONS_COMMAND_LIST_OF_ALLOWING_STATES ("Edit, Solve")
 #define AUTOFILL_COMMAND_LIST_OF_ALLOWING_STATES ("Solve")
 #define RESET_COMMAND_LIST_OF_ALLOWING_STATES ("Edit, Solve")
+#define SOLVER_COMMAND_LIST_OF_ALLOWING_STATES ("Init, Edit, Solve")
+#define JOURNAL_COMMAND_LIST_OF_ALLOWING_STATES ("Edit, Solve")
 #define EXIT_COMMAND_LIST_OF_ALLOWING_STATES ("Init, Edit, Solve")
 
 /**
@@ -93,9 +97,11 @@
 #define SAVE_COMMAND_USAGE ("save <path (str)>")
 #define HINT_COMMAND_USAGE ("hint <column_no (int)> <row_no (int)>")
 #define GUESS_HINT_COMMAND_USAGE ("guess_hint <column_no (int)> <row_no (int)>")
-#define NUM_SOLUTIONS_COMMAND_USAGE ("num_solutions")
-#define AUTOFILL_COMMAND_USAGE ("autofill")
+#define NUM_SOLUTIONS_COMMAND_USAGE ("num_solutions (<method (str)>) (<num_threads (int)>) (<max_num_solutions (int)>) (<split_depth (int)>)")
+#define AUTOFILL_COMMAND_USAGE ("autofill (<once|fixpoint (str)>)")
 #define RESET_COMMAND_USAGE ("reset")
+#define SOLVER_COMMAND_USAGE ("solver <native|ilp (str)>")
+#define JOURNAL_COMMAND_USAGE ("journal <path (str)>")
 #define EXIT_COMMAND_USAGE ("exit")
 
 
@@ -121,6 +127,8 @@ typedef enum commandType {
 	COMMAND_TYPE_NUM_SOLUTIONS,
 	COMMAND_TYPE_AUTOFILL,
 	COMMAND_TYPE_RESET,
+	COMMAND_TYPE_SOLVER,
+	COMMAND_TYPE_JOURNAL,
 	COMMAND_TYPE_EXIT,
 	COMMAND_TYPE_IGNORE} CommandType;
 
@@ -160,7 +168,8 @@ typedef bool (*commandArgsParser)(char* arg, int argNo, void* arguments);
 
 /**
  * Function pointer to a concrete command type's RangeChecker.
- * There is one for the following commands: Set, Guess, Generate, Hint and Guess-Hint.
+ * There is one for the following commands: Set, Guess, Generate, Hint, Guess-Hint,
+ * Num Solutions, Autofill and Solver.
  * 
  */
 typedef bool (*commandArgsRangeChecker)(void* arguments, int argNo, GameState* gameState);
@@ -251,15 +260,26 @@ typedef struct { /* Note: order of row and col is reverse to that provided by us
 } GuessHintCommandArguments;
 
 /**
- * UndoCommandArguments, RedoCommandArguments, AutofillCommandArguments are
- * structs that contain the output of these types of commands - a read-only
- * pointer to a Move struct, for further processing necessary according to 
- * the command type.
+ * UndoCommandArguments, RedoCommandArguments are structs that contain the output
+ * of these types of commands - a read-only pointer to a Move struct, for further
+ * processing necessary according to the command type.
  * 
  */
 typedef struct {
 	const Move* movesListOut;
-} UndoCommandArguments, RedoCommandArguments, AutofillCommandArguments;
+} UndoCommandArguments, RedoCommandArguments;
+
+/**
+ * AutofillCommandArguments is a struct that contains the argument the user may provide
+ * for an 'autofill' command - the name of the mode to autofill in, or NULL if none was
+ * provided - and the output of the command - a read-only pointer to the Move struct
+ * documenting the cells filled.
+ * 
+ */
+typedef struct {
+	char* modeName;
+	const Move* movesListOut;
+} AutofillCommandArguments;
 
 /**
  * ValidateCommandArguments is a struct that contains the output of a 'validate'
@@ -271,14 +291,39 @@ typedef struct {
 } ValidateCommandArguments;
 
 /**
- * ValidateCommandArguments is a struct that contains the output of a 'validate'
- * command - true if exists a solution to the board, otherwise false. 
+ * NumSolutionsCommandArguments is a struct that contains the arguments the user may provide
+ * for a 'num_solutions' command - the name of the search method to count by, or NULL if
+ * none was provided, the number of threads to count on, or 0 if none was provided, and
+ * the number of solutions at which counting stops, or 0 if none was provided, and the
+ * depth to which the search tree is split among the threads, or 0 if none was provided (in
+ * which case it is chosen automatically) - and the output of the command - the number of
+ * solutions to the board, up to that number.
  * 
  */
 typedef struct {
+	char* methodName;
+	int numThreads;
+	int maxNumSolutions;
+	int splitDepth;
 	int numSolutionsOut;
 } NumSolutionsCommandArguments;
 
+/**
+ * SolverCommandArguments is a struct that contains the arguments the user provided
+ * for a 'solver' command - the name of the backend to solve boards by.
+ */
+typedef struct {
+	char* backendName;
+} SolverCommandArguments;
+
+/**
+ * JournalCommandArguments is a struct that contains the arguments the user provided
+ * for a 'journal' command - the path to the file the game is journaled to.
+ */
+typedef struct {
+	char* filePath;
+} JournalCommandArguments;
+
 /**
  * For consistency, we use an minimal size struct to respresent the arguments of
  * commands with no arguments: 'validate', 'restart' and 'exit'
@@ -307,6 +352,8 @@ typedef struct {
 									sizeof(NumSolutionsCommandArguments) + \
 									sizeof(AutofillCommandArguments) + \
 									sizeof(ResetCommandArguments) + \
+									sizeof(SolverCommandArguments) + \
+									sizeof(JournalCommandArguments) + \
 									sizeof(ExitCommandArguments) + \
 									sizeof(IgnoreCommandArguments))
 
@@ -0,0 +1,586 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "corpus.h"
+
+#define ERROR_SUCCESS (0)
+
+#define PUZZLE_CORPUS_BUFFER_SIZE (1 << 16)
+#define PUZZLE_CORPUS_INITIAL_TOKEN_CAPACITY (256)
+
+#define FIXED_CELL_MARKER_IN_CORPUS ('.')
+#define EMPTY_CELL_CHAR_IN_LINE_FORMAT ('.')
+#define ALTERNATIVE_EMPTY_CELL_CHAR_IN_LINE_FORMAT ('0')
+
+#define MAX_NUM_DIGITS_IN_INT (11)
+
+struct PuzzleCorpusReader {
+	FILE* file;
+	unsigned char* buffer;
+	size_t position;
+	size_t length;
+	unsigned long numLineEnds;
+	bool hasReadFailed;
+	char* token;
+	size_t tokenCapacity;
+};
+
+struct PuzzleCorpusWriter {
+	FILE* file;
+	PuzzleCorpusFormat format;
+	char* record;
+	size_t recordCapacity;
+};
+
+PuzzleCorpusReader* openPuzzleCorpusReader(char* filePath) {
+	PuzzleCorpusReader* reader = calloc(1, sizeof(PuzzleCorpusReader));
+	if (reader == NULL)
+		return NULL;
+
+	reader->buffer = malloc(PUZZLE_CORPUS_BUFFER_SIZE);
+	reader->token = malloc(PUZZLE_CORPUS_INITIAL_TOKEN_CAPACITY);
+	reader->tokenCapacity = PUZZLE_CORPUS_INITIAL_TOKEN_CAPACITY;
+	if ((reader->buffer == NULL) || (reader->token == NULL)) {
+		closePuzzleCorpusReader(reader);
+		return NULL;
+	}
+
+	reader->file = fopen(filePath, "rb");
+	if (reader->file == NULL) {
+		closePuzzleCorpusReader(reader);
+		return NULL;
+	}
+
+	return reader;
+}
+
+void closePuzzleCorpusReader(PuzzleCorpusReader* reader) {
+	if (reader == NULL)
+		return;
+
+	if (reader->file != NULL)
+		fclose(reader->file);
+	free(reader->buffer);
+	free(reader->token);
+	free(reader);
+}
+
+/**
+ * Get the next character of a corpus without consuming it, refilling the reader's buffer
+ * from the file when it runs out.
+ *
+ * @param reader 	[in, out] The reader to be read from
+ * @return int 		The next character, or EOF if the corpus has ended or could not be read
+ */
+int peekCorpusChar(PuzzleCorpusReader* reader) {
+	if (reader->position == reader->length) {
+		reader->position = 0;
+		reader->length = fread(reader->buffer, sizeof(unsigned char), PUZZLE_CORPUS_BUFFER_SIZE, reader->file);
+		if (reader->length == 0) {
+			reader->hasReadFailed = reader->hasReadFailed || (ferror(reader->file) != 0);
+			return EOF;
+		}
+	}
+
+	return reader->buffer[reader->position];
+}
+
+/**
+ * Consume the next character of a corpus, which must have been peeked at with peekCorpusChar,
+ * counting the line ends consumed.
+ *
+ * @param reader 	[in, out] The reader to be advanced
+ */
+void skipCorpusChar(PuzzleCorpusReader* reader) {
+	if (reader->buffer[reader->position] == '\n')
+		reader->numLineEnds++;
+	reader->position++;
+}
+
+/**
+ * Consume the characters of a corpus up to and including its numLineEnds-th line end (counted
+ * from its start), or up to its end if it has fewer.
+ *
+ * @param reader 		[in, out] The reader to be advanced
+ * @param numLineEnds 	[in] The number of line ends the reader is to have consumed
+ */
+void skipCorpusLines(PuzzleCorpusReader* reader, unsigned long numLineEnds) {
+	while ((reader->numLineEnds < numLineEnds) && (peekCorpusChar(reader) != EOF))
+		skipCorpusChar(reader);
+}
+
+/**
+ * Checks whether a character is a whitespace character, as isspace does in the "C" locale.
+ *
+ * @param chr 		[in] The character to be examined
+ * @return true 	iff the character is a whitespace character
+ * @return false 	otherwise
+ */
+bool isCorpusWhitespace(int chr) {
+	return (chr == ' ') || ((chr >= '\t') && (chr <= '\r'));
+}
+
+/**
+ * Checks whether a character is a decimal digit.
+ *
+ * @param chr 		[in] The character to be examined
+ * @return true 	iff the character is a decimal digit
+ * @return false 	otherwise
+ */
+bool isCorpusDigit(int chr) {
+	return (chr >= '0') && (chr <= '9');
+}
+
+/**
+ * Consume whitespace characters of a corpus, up to its next other character.
+ *
+ * @param reader 				[in, out] The reader to be advanced
+ * @param shouldSkipLineEnds 	[in] true iff line ends should be consumed as well. Otherwise,
+ * 								consumption stops at a line end
+ */
+void skipCorpusWhitespace(PuzzleCorpusReader* reader, bool shouldSkipLineEnds) {
+	int chr = peekCorpusChar(reader);
+	while (isCorpusWhitespace(chr) && (shouldSkipLineEnds || (chr != '\n'))) {
+		skipCorpusChar(reader);
+		chr = peekCorpusChar(reader);
+	}
+}
+
+/**
+ * Consume a run of non-whitespace characters of a corpus into the reader's token buffer,
+ * which grows as needed.
+ *
+ * @param reader 							[in, out] The reader to be read from
+ * @param lengthOut 						[in, out] Pointer to be assigned with the length of the token
+ * @return ReadPuzzleFromCorpusErrorCode 	The error that has occurred, or 0 on success
+ */
+ReadPuzzleFromCorpusErrorCode readCorpusToken(PuzzleCorpusReader* reader, size_t* lengthOut) {
+	size_t length = 0;
+	int chr = peekCorpusChar(reader);
+
+	while ((chr != EOF) && !isCorpusWhitespace(chr)) {
+		if (length == reader->tokenCapacity) {
+			char* grownToken = realloc(reader->token, 2 * reader->tokenCapacity);
+			if (grownToken == NULL)
+				return READ_PUZZLE_FROM_CORPUS_MEMORY_ALLOCATION_FAILURE;
+			reader->token = grownToken;
+			reader->tokenCapacity *= 2;
+		}
+		reader->token[length++] = (char)chr;
+		skipCorpusChar(reader);
+		chr = peekCorpusChar(reader);
+	}
+
+	*lengthOut = length;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * Add a digit to an integer being parsed, saturating its magnitude at INT_MAX.
+ *
+ * @param value 	[in] The magnitude parsed so far
+ * @param chr 		[in] The next digit
+ * @return int 		The new magnitude
+ */
+int addDigitToCorpusInteger(int value, int chr) {
+	int digit = chr - '0';
+	return (value > (INT_MAX - digit) / 10) ? INT_MAX : (value * 10) + digit;
+}
+
+/**
+ * Parse a token as an integer: an optional sign followed by decimal digits.
+ *
+ * @param token 		[in] The token to be parsed
+ * @param length 		[in] The length of the token
+ * @param valueOut 		[in, out] Pointer to be assigned with the integer
+ * @return true 		iff the whole token is an integer
+ * @return false 		otherwise
+ */
+bool parseCorpusTokenAsInteger(const char* token, size_t length, int* valueOut) {
+	size_t i = 0;
+	bool isNegative = false;
+	int value = 0;
+
+	if ((length > 0) && ((token[0] == '+') || (token[0] == '-'))) {
+		isNegative = (token[0] == '-');
+		i++;
+	}
+	if (i == length)
+		return false;
+
+	for (; i < length; i++) {
+		if (!isCorpusDigit(token[i]))
+			return false;
+		value = addDigitToCorpusInteger(value, token[i]);
+	}
+
+	*valueOut = isNegative ? -value : value;
+	return true;
+}
+
+/**
+ * Consume an integer from a corpus: an optional sign followed by decimal digits.
+ *
+ * @param reader 		[in, out] The reader to be read from
+ * @param valueOut 		[in, out] Pointer to be assigned with the integer
+ * @return true 		iff an integer was read
+ * @return false 		iff the corpus is not at an integer
+ */
+bool scanCorpusInteger(PuzzleCorpusReader* reader, int* valueOut) {
+	bool isNegative = false;
+	int value = 0;
+	int chr = peekCorpusChar(reader);
+
+	if ((chr == '+') || (chr == '-')) {
+		isNegative = (chr == '-');
+		skipCorpusChar(reader);
+		chr = peekCorpusChar(reader);
+	}
+	if (!isCorpusDigit(chr))
+		return false;
+
+	while (isCorpusDigit(chr)) {
+		value = addDigitToCorpusInteger(value, chr);
+		skipCorpusChar(reader);
+		chr = peekCorpusChar(reader);
+	}
+
+	*valueOut = isNegative ? -value : value;
+	return true;
+}
+
+/**
+ * Make a board hold cells of the provided dimensions, reusing the cells it already holds
+ * if they are of these dimensions.
+ *
+ * @param boardInOut 	[in, out] The board to be prepared
+ * @param M 			[in] The number of rows in a block
+ * @param N 			[in] The number of columns in a block
+ * @return true 		iff the board holds cells of the provided dimensions
+ * @return false 		iff a memory error occurred
+ */
+bool prepareCorpusBoard(Board* boardInOut, int M, int N) {
+	if ((boardInOut->cells != NULL) && (boardInOut->numRowsInBlock_M == M) && (boardInOut->numColumnsInBlock_N == N))
+		return true;
+
+	cleanupBoard(boardInOut);
+	boardInOut->numRowsInBlock_M = M;
+	boardInOut->numColumnsInBlock_N = N;
+	return createEmptyBoard(boardInOut);
+}
+
+/**
+ * Get the value represented by a character of a puzzle in the line format.
+ *
+ * @param chr 		[in] The character to be translated
+ * @return int 		The value represented by the character, or -1 if it represents none
+ */
+int getLineFormatCellValue(char chr) {
+	if ((chr == EMPTY_CELL_CHAR_IN_LINE_FORMAT) || (chr == ALTERNATIVE_EMPTY_CELL_CHAR_IN_LINE_FORMAT))
+		return EMPTY_CELL_VALUE;
+	if ((chr >= '1') && (chr <= '9'))
+		return chr - '0';
+	if ((chr >= 'A') && (chr <= 'Z'))
+		return chr - 'A' + 10;
+	return -1;
+}
+
+/**
+ * Get the character representing a value in a puzzle in the line format.
+ *
+ * @param value 	[in] The value to be translated, no larger than
+ * 					PUZZLE_CORPUS_LINE_FORMAT_MAX_BLOCK_SIZE
+ * @return char 	The character representing the value
+ */
+char getLineFormatCellChar(int value) {
+	if (value == EMPTY_CELL_VALUE)
+		return EMPTY_CELL_CHAR_IN_LINE_FORMAT;
+	if (value <= 9)
+		return (char)('0' + value);
+	return (char)('A' + value - 10);
+}
+
+/**
+ * Get the number of rows in a block of a board of the provided block size, as deduced for
+ * a puzzle in the line format: the largest divisor of MN which is no larger than its
+ * square root.
+ *
+ * @param MN 	[in] The number of cells in a block
+ * @return int 	The number of rows in a block
+ */
+int getLineFormatNumRowsInBlock(int MN) {
+	int M = 1;
+
+	while ((M + 1) * (M + 1) <= MN)
+		M++;
+	while (MN % M != 0)
+		M--;
+
+	return M;
+}
+
+/**
+ * Parse a token holding a puzzle in the line format into a board.
+ *
+ * @param token 							[in] The token to be parsed
+ * @param length 							[in] The length of the token
+ * @param boardInOut 						[in, out] The board to be filled with the puzzle
+ * @return ReadPuzzleFromCorpusErrorCode 	The error that has occurred, or 0 on success
+ */
+ReadPuzzleFromCorpusErrorCode parseLineFormatPuzzle(const char* token, size_t length, Board* boardInOut) {
+	size_t MN = 0, index = 0;
+	int M = 0;
+	bool areValuesInRange = true;
+
+	while ((MN + 1) * (MN + 1) <= length)
+		MN++;
+	if ((MN * MN != length) || (MN > INT_MAX / MN))
+		return READ_PUZZLE_FROM_CORPUS_BAD_FORMAT;
+
+	M = getLineFormatNumRowsInBlock((int)MN);
+	if (!prepareCorpusBoard(boardInOut, M, (int)MN / M))
+		return READ_PUZZLE_FROM_CORPUS_MEMORY_ALLOCATION_FAILURE;
+
+	for (index = 0; index < length; index++) {
+		Cell* cell = &(boardInOut->cells[index]);
+		int value = getLineFormatCellValue(token[index]);
+		if (value < 0)
+			return READ_PUZZLE_FROM_CORPUS_BAD_FORMAT;
+		areValuesInRange = areValuesInRange && ((size_t)value <= MN);
+		cell->value = value;
+		cell->isFixed = (value != EMPTY_CELL_VALUE);
+		cell->isErroneous = false;
+	}
+
+	return areValuesInRange ? ERROR_SUCCESS : READ_PUZZLE_FROM_CORPUS_CELL_VALUE_NOT_IN_RANGE;
+}
+
+/**
+ * Parse a puzzle in the block format into a board, reading its cells off the corpus.
+ * A cell is an integer followed by a single character, FIXED_CELL_MARKER_IN_CORPUS marking
+ * fixed cells, except for the last cell of the corpus which may end it.
+ * A puzzle that cannot be parsed is skipped past, taking it to span the line of its dimensions
+ * and a line per row after it, as saveBoardToFile writes it (or only the line of its dimensions,
+ * if these cannot be parsed), so that reading may go on with the next one.
+ *
+ * @param reader 							[in, out] The reader to be read from, past the
+ * 											dimensions' first number
+ * @param token 							[in] The token holding the dimensions' first number
+ * @param length 							[in] The length of the token
+ * @param boardInOut 						[in, out] The board to be filled with the puzzle
+ * @return ReadPuzzleFromCorpusErrorCode 	The error that has occurred, or 0 on success
+ */
+ReadPuzzleFromCorpusErrorCode parseBlockFormatPuzzle(PuzzleCorpusReader* reader, const char* token, size_t length, Board* boardInOut) {
+	int m = 0, n = 0, MN = 0, MN2 = 0, index = 0;
+	bool areValuesInRange = true;
+	unsigned long numLineEndsBefore = reader->numLineEnds; /* Note: the dimensions' line has yet to end */
+
+	if (!parseCorpusTokenAsInteger(token, length, &m) || !scanCorpusInteger(reader, &n)) {
+		skipCorpusLines(reader, numLineEndsBefore + 1);
+		return READ_PUZZLE_FROM_CORPUS_BAD_FORMAT;
+	}
+	if (!((m > 0) && (n > 0))) {
+		skipCorpusLines(reader, numLineEndsBefore + 1);
+		return READ_PUZZLE_FROM_CORPUS_DIMENSIONS_ARE_NOT_POSITIVE;
+	}
+	if (!prepareCorpusBoard(boardInOut, m, n))
+		return READ_PUZZLE_FROM_CORPUS_MEMORY_ALLOCATION_FAILURE;
+
+	MN = getBoardBlockSize_MN(boardInOut);
+	MN2 = getBoardSize_MN2(boardInOut);
+	for (index = 0; index < MN2; index++) {
+		Cell* cell = &(boardInOut->cells[index]);
+		int chr = EOF;
+
+		skipCorpusWhitespace(reader, true);
+		if (!scanCorpusInteger(reader, &(cell->value))) {
+			skipCorpusLines(reader, numLineEndsBefore + 1 + MN);
+			return READ_PUZZLE_FROM_CORPUS_BAD_FORMAT;
+		}
+
+		chr = peekCorpusChar(reader);
+		if (chr != EOF)
+			skipCorpusChar(reader);
+		else if (index + 1 < MN2)
+			return READ_PUZZLE_FROM_CORPUS_BAD_FORMAT;
+		cell->isFixed = (chr == FIXED_CELL_MARKER_IN_CORPUS);
+		cell->isErroneous = false;
+		areValuesInRange = areValuesInRange && (cell->value >= EMPTY_CELL_VALUE) && (cell->value <= MN);
+	}
+
+	return areValuesInRange ? ERROR_SUCCESS : READ_PUZZLE_FROM_CORPUS_CELL_VALUE_NOT_IN_RANGE;
+}
+
+ReadPuzzleFromCorpusErrorCode readPuzzleFromCorpus(PuzzleCorpusReader* reader, Board* boardInOut) {
+	ReadPuzzleFromCorpusErrorCode retVal = ERROR_SUCCESS;
+	size_t length = 0;
+	int chr = EOF;
+
+	skipCorpusWhitespace(reader, true);
+	if (peekCorpusChar(reader) == EOF)
+		return reader->hasReadFailed ? READ_PUZZLE_FROM_CORPUS_FILE_COULD_NOT_BE_READ : READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES;
+
+	retVal = readCorpusToken(reader, &length);
+	if (retVal != ERROR_SUCCESS)
+		return retVal;
+
+	/* Note: a token alone on its line is a puzzle in the line format, while one followed
+	 * by another token is the first of a block format puzzle's dimensions */
+	skipCorpusWhitespace(reader, false);
+	chr = peekCorpusChar(reader);
+	if ((chr == '\n') || (chr == EOF))
+		retVal = parseLineFormatPuzzle(reader->token, length, boardInOut);
+	else
+		retVal = parseBlockFormatPuzzle(reader, reader->token, length, boardInOut);
+
+	if (reader->hasReadFailed)
+		return READ_PUZZLE_FROM_CORPUS_FILE_COULD_NOT_BE_READ;
+	return retVal;
+}
+
+PuzzleCorpusWriter* openPuzzleCorpusWriter(char* filePath, PuzzleCorpusFormat format) {
+	PuzzleCorpusWriter* writer = calloc(1, sizeof(PuzzleCorpusWriter));
+	if (writer == NULL)
+		return NULL;
+
+	writer->format = format;
+	writer->file = fopen(filePath, "wb");
+	if (writer->file == NULL) {
+		free(writer);
+		return NULL;
+	}
+	setvbuf(writer->file, NULL, _IOFBF, PUZZLE_CORPUS_BUFFER_SIZE);
+
+	return writer;
+}
+
+bool closePuzzleCorpusWriter(PuzzleCorpusWriter* writer) {
+	bool isFlushed = true;
+	if (writer == NULL)
+		return true;
+
+	isFlushed = (fclose(writer->file) == 0);
+	free(writer->record);
+	free(writer);
+	return isFlushed;
+}
+
+/**
+ * Make sure a writer's record buffer can hold at least the provided number of characters.
+ *
+ * @param writer 		[in, out] The writer whose buffer is to be grown
+ * @param capacity 		[in] The number of characters the buffer must hold
+ * @return true 		iff the buffer can hold that many characters
+ * @return false 		iff a memory error occurred
+ */
+bool reserveCorpusRecord(PuzzleCorpusWriter* writer, size_t capacity) {
+	char* grownRecord = NULL;
+	if (writer->recordCapacity >= capacity)
+		return true;
+
+	grownRecord = realloc(writer->record, capacity);
+	if (grownRecord == NULL)
+		return false;
+
+	writer->record = grownRecord;
+	writer->recordCapacity = capacity;
+	return true;
+}
+
+/**
+ * Format a non-negative integer in decimal digits.
+ *
+ * @param out 		[in, out] The buffer to be written to
+ * @param value 	[in] The integer to be formatted
+ * @return char* 	The position in the buffer right after the formatted integer
+ */
+char* formatCorpusInteger(char* out, int value) {
+	char digits[MAX_NUM_DIGITS_IN_INT];
+	int numDigits = 0;
+
+	do {
+		digits[numDigits++] = (char)('0' + (value % 10));
+		value /= 10;
+	} while (value > 0);
+
+	while (numDigits > 0)
+		*(out++) = digits[--numDigits];
+	return out;
+}
+
+/**
+ * Format a puzzle in the block format, as saveBoardToFile would write it.
+ *
+ * @param writer 		[in, out] The writer to format the puzzle in
+ * @param board 		[in] The puzzle to be formatted
+ * @return size_t 		The length of the formatted puzzle, or 0 if a memory error occurred
+ */
+size_t formatBlockFormatPuzzle(PuzzleCorpusWriter* writer, const Board* board) {
+	int MN = getBoardBlockSize_MN(board);
+	int row = 0, col = 0;
+	char* out = NULL;
+
+	/* Note: every cell takes up to the digits of MN, a fixed marker and a separator */
+	if (!reserveCorpusRecord(writer, (2 * MAX_NUM_DIGITS_IN_INT + 2) + ((size_t)MN * MN * (MAX_NUM_DIGITS_IN_INT + 2))))
+		return 0;
+
+	out = writer->record;
+	out = formatCorpusInteger(out, board->numRowsInBlock_M);
+	*(out++) = ' ';
+	out = formatCorpusInteger(out, board->numColumnsInBlock_N);
+	*(out++) = '\n';
+	for (row = 0; row < MN; row++) {
+		for (col = 0; col < MN; col++) {
+			const Cell* cell = viewBoardCellByRow(board, row, col);
+			out = formatCorpusInteger(out, getBoardCellValue(cell));
+			if (isBoardCellFixed(cell))
+				*(out++) = FIXED_CELL_MARKER_IN_CORPUS;
+			*(out++) = (col + 1 == MN) ? '\n' : ' ';
+		}
+	}
+
+	return out - writer->record;
+}
+
+/**
+ * Format a puzzle in the line format.
+ *
+ * @param writer 		[in, out] The writer to format the puzzle in
+ * @param board 		[in] The puzzle to be formatted
+ * @return size_t 		The length of the formatted puzzle, or 0 if the puzzle cannot be
+ * 						formatted in the line format or a memory error occurred. A puzzle
+ * 						whose blocks are not of the dimensions that would be deduced when
+ * 						reading it back cannot be formatted
+ */
+size_t formatLineFormatPuzzle(PuzzleCorpusWriter* writer, const Board* board) {
+	int MN = getBoardBlockSize_MN(board);
+	int MN2 = getBoardSize_MN2(board);
+	int index = 0;
+
+	if ((MN > PUZZLE_CORPUS_LINE_FORMAT_MAX_BLOCK_SIZE) ||
+		(board->numRowsInBlock_M != getLineFormatNumRowsInBlock(MN)) ||
+		!reserveCorpusRecord(writer, MN2 + 1))
+		return 0;
+
+	for (index = 0; index < MN2; index++)
+		writer->record[index] = getLineFormatCellChar(getBoardCellValue(&(board->cells[index])));
+	writer->record[MN2] = '\n';
+
+	return MN2 + 1;
+}
+
+bool writePuzzleToCorpus(PuzzleCorpusWriter* writer, const Board* board) {
+	size_t length = 0;
+
+	switch (writer->format) {
+	case PUZZLE_CORPUS_FORMAT_BLOCK:
+		length = formatBlockFormatPuzzle(writer, board);
+		break;
+	case PUZZLE_CORPUS_FORMAT_LINE:
+		length = formatLineFormatPuzzle(writer, board);
+		break;
+	}
+
+	return (length > 0) && (fwrite(writer->record, sizeof(char), length, writer->file) == length);
+}
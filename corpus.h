@@ -0,0 +1,135 @@
+/**
+ * The corpus module reads and writes files holding many puzzles, one after the other, as
+ * streams. Puzzles are read one at a time into a board provided by the caller, which is
+ * reused from one puzzle to the next, so that reading a corpus of puzzles of the same
+ * dimensions allocates nothing per puzzle. Two formats are supported, and may be mixed in
+ * a single corpus:
+ * - The block format: boards in the format of board files, as saved by saveBoardToFile,
+ *   one after the other. Both of the dimensions of each board must be on the same line, and
+ *   each row is expected on a line of its own.
+ * - The line format: a puzzle per line, a character per cell, row after row. '.' or '0'
+ *   stand for an empty cell, '1' to '9' for the values 1 to 9, and 'A' to 'Z' for the
+ *   values 10 to 35. The dimensions are deduced from the length of the line: a line of
+ *   MN*MN characters holds a board whose blocks have M rows and N columns, M being the
+ *   largest divisor of MN which is no larger than its square root (so a 6x6 board has
+ *   blocks of 2 rows and 3 columns). Boards whose blocks have other dimensions, such as
+ *   6x6 boards with blocks of 3 rows and 2 columns, cannot be written in the line format.
+ *
+ * openPuzzleCorpusReader - Opens a corpus file for reading.
+ * readPuzzleFromCorpus - Reads the next puzzle of a corpus.
+ * closePuzzleCorpusReader - Closes a corpus reader.
+ * openPuzzleCorpusWriter - Opens a corpus file for writing, in either format.
+ * writePuzzleToCorpus - Appends a puzzle to a corpus.
+ * closePuzzleCorpusWriter - Closes a corpus writer.
+ */
+
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <stdbool.h>
+
+#include "board.h"
+
+/**
+ * The largest number of cells in a block of a board written in the line format.
+ */
+#define PUZZLE_CORPUS_LINE_FORMAT_MAX_BLOCK_SIZE (35)
+
+/**
+ * PuzzleCorpusReader struct holds a corpus file open for reading, along with the buffers
+ * it is read through.
+ */
+typedef struct PuzzleCorpusReader PuzzleCorpusReader;
+
+/**
+ * Opens a corpus file for reading.
+ *
+ * @param filePath 				[in] Path to the corpus
+ * @return PuzzleCorpusReader* 	The reader, or NULL if the file could not be opened or a
+ * 								memory error occurred
+ */
+PuzzleCorpusReader* openPuzzleCorpusReader(char* filePath);
+
+/**
+ * Errors that may occur while reading a puzzle from a corpus.
+ */
+typedef enum {
+	READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES = 1,
+	READ_PUZZLE_FROM_CORPUS_FILE_COULD_NOT_BE_READ,
+	READ_PUZZLE_FROM_CORPUS_BAD_FORMAT,
+	READ_PUZZLE_FROM_CORPUS_DIMENSIONS_ARE_NOT_POSITIVE,
+	READ_PUZZLE_FROM_CORPUS_CELL_VALUE_NOT_IN_RANGE,
+	READ_PUZZLE_FROM_CORPUS_MEMORY_ALLOCATION_FAILURE
+} ReadPuzzleFromCorpusErrorCode;
+
+/**
+ * Reads the next puzzle of a corpus into a board. If the board already holds cells of the
+ * puzzle's dimensions, they are overwritten in place. Otherwise, they are replaced with
+ * new ones. Filled cells of puzzles in the line format are marked as fixed.
+ * A puzzle that cannot be parsed is skipped past, so that reading may go on with the next
+ * one: in the line format, its line, and in the block format, the line of its dimensions and
+ * the line of each of its rows (or only the former, if the dimensions cannot be parsed).
+ * Either way, the contents of the board's cells are unspecified on error.
+ *
+ * @param reader 							[in, out] The reader to be read from
+ * @param boardInOut 						[in, out] A board, either empty (all zeroes) or holding
+ * 											a previous puzzle, to be filled with the puzzle. It is
+ * 											to be cleaned up with cleanupBoard by the caller
+ * @return ReadPuzzleFromCorpusErrorCode 	The error that has occurred, or 0 on success
+ */
+ReadPuzzleFromCorpusErrorCode readPuzzleFromCorpus(PuzzleCorpusReader* reader, Board* boardInOut);
+
+/**
+ * Closes a corpus reader and frees its resources.
+ *
+ * @param reader 	[in] The reader to be closed, or NULL
+ */
+void closePuzzleCorpusReader(PuzzleCorpusReader* reader);
+
+/**
+ * The formats in which puzzles may be written to a corpus.
+ */
+typedef enum {
+	PUZZLE_CORPUS_FORMAT_BLOCK,
+	PUZZLE_CORPUS_FORMAT_LINE
+} PuzzleCorpusFormat;
+
+/**
+ * PuzzleCorpusWriter struct holds a corpus file open for writing, along with the buffer
+ * records are formatted in.
+ */
+typedef struct PuzzleCorpusWriter PuzzleCorpusWriter;
+
+/**
+ * Opens a corpus file for writing, overwriting any file in its path.
+ *
+ * @param filePath 				[in] Path to the corpus
+ * @param format 				[in] The format in which the puzzles will be written
+ * @return PuzzleCorpusWriter* 	The writer, or NULL if the file could not be opened or a
+ * 								memory error occurred
+ */
+PuzzleCorpusWriter* openPuzzleCorpusWriter(char* filePath, PuzzleCorpusFormat format);
+
+/**
+ * Appends a puzzle to a corpus. The line format does not record which cells are fixed,
+ * and only holds boards with up to PUZZLE_CORPUS_LINE_FORMAT_MAX_BLOCK_SIZE cells in a block,
+ * whose blocks have as many rows as the line format deduces (see above).
+ *
+ * @param writer 	[in, out] The writer to be written to
+ * @param board 	[in] The puzzle to be written
+ * @return true 	iff the puzzle was written successfully
+ * @return false 	iff the puzzle cannot be written in the writer's format, or a write or
+ * 					memory error has occurred
+ */
+bool writePuzzleToCorpus(PuzzleCorpusWriter* writer, const Board* board);
+
+/**
+ * Closes a corpus writer, flushing whatever it has yet to write, and frees its resources.
+ *
+ * @param writer 	[in] The writer to be closed, or NULL
+ * @return true 	iff everything written to the corpus has reached the file
+ * @return false 	iff a write error has occurred
+ */
+bool closePuzzleCorpusWriter(PuzzleCorpusWriter* writer);
+
+#endif /* CORPUS_H */
@@ -0,0 +1,231 @@
+/**
+ * CORPUS_TEST Summary:
+ *
+ * A standalone program designed to test the corpus reader on corpora holding puzzles that
+ * cannot be parsed in the middle of valid ones, in either format. Each corpus is written to
+ * the working directory, read back puzzle after puzzle, and removed when done. The error
+ * code of every read, and the first row of every puzzle read successfully, are checked
+ * against the expected ones, so that a bad puzzle is shown to cost a single error, after
+ * which the reader is back in step with the corpus.
+ *
+ * The line format writer is also checked to reject boards whose block dimensions would not
+ * be read back as they are.
+ *
+ * Usage: sudoku-corpus-test
+ */
+
+#include <stdio.h>
+
+#include "board.h"
+#include "corpus.h"
+
+#define ERROR_SUCCESS (0)
+
+#define CORPUS_TEST_FILE_PATH ("corpus_test.txt")
+
+#define CORPUS_TEST_MAX_NUM_READS (16)
+
+/**
+ * CorpusTestRead struct describes the expected outcome of a read from a test corpus: its
+ * error code, and, on success, the values of the first row of the puzzle read, one character
+ * per cell as in the line format.
+ */
+typedef struct {
+	ReadPuzzleFromCorpusErrorCode error;
+	const char* firstRow;
+} CorpusTestRead;
+
+/**
+ * CorpusTest struct describes a test of the corpus reader: the contents of the corpus, and
+ * the outcomes of reading it, up to and including the read that finds no more puzzles.
+ */
+typedef struct {
+	const char* name;
+	const char* contents;
+	CorpusTestRead reads[CORPUS_TEST_MAX_NUM_READS];
+} CorpusTest;
+
+CorpusTest corpusTests[] = {
+	{
+		"bad cell in a block puzzle",
+		"2 2\n1. 2. 0 0\n0 0 0 0\n0 0 0 0\n0 0 0 0\n"
+		"2 2\n3 0 0 0\n0 x 0 0\n0 0 0 0\n0 0 0 0\n"
+		"2 2\n4. 0 0 1\n0 0 0 0\n0 0 0 0\n0 0 0 0\n",
+		{
+			{ERROR_SUCCESS, "1200"},
+			{READ_PUZZLE_FROM_CORPUS_BAD_FORMAT, NULL},
+			{ERROR_SUCCESS, "4001"},
+			{READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES, NULL}
+		}
+	},
+	{
+		"bad dimensions of a block puzzle",
+		"2 2\n1 0 0 0\n0 0 0 0\n0 0 0 0\n0 0 0 0\n"
+		"2 y\n"
+		"0 2\n"
+		"2 2\n0 0 0 2\n0 0 0 0\n0 0 0 0\n0 0 0 0\n",
+		{
+			{ERROR_SUCCESS, "1000"},
+			{READ_PUZZLE_FROM_CORPUS_BAD_FORMAT, NULL},
+			{READ_PUZZLE_FROM_CORPUS_DIMENSIONS_ARE_NOT_POSITIVE, NULL},
+			{ERROR_SUCCESS, "0002"},
+			{READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES, NULL}
+		}
+	},
+	{
+		"bad puzzles in a mixed corpus",
+		"12..............\n"
+		"2 2\n0 0 0 0\n0 0 0 0\n0 0 0 -\n0 0 0 0\n"
+		"3.4.............\n"
+		"1!..............\n"
+		"2 2\n0 3 0 0\n0 0 0 0\n0 0 0 0\n0 0 0 0\n",
+		{
+			{ERROR_SUCCESS, "1200"},
+			{READ_PUZZLE_FROM_CORPUS_BAD_FORMAT, NULL},
+			{ERROR_SUCCESS, "3040"},
+			{READ_PUZZLE_FROM_CORPUS_BAD_FORMAT, NULL},
+			{ERROR_SUCCESS, "0300"},
+			{READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES, NULL}
+		}
+	},
+	{NULL, NULL, {{ERROR_SUCCESS, NULL}}}
+};
+
+/**
+ * Checks whether the first row of a board holds the provided values.
+ *
+ * @param board 	[in] The board to be examined
+ * @param firstRow 	[in] The values, one character per cell as in the line format
+ * @return true 	iff the first row of the board holds the values
+ * @return false 	otherwise
+ */
+bool isFirstBoardRow(const Board* board, const char* firstRow) {
+	int MN = getBoardBlockSize_MN(board);
+	int col = 0;
+
+	for (col = 0; col < MN; col++) {
+		int expectedValue = (firstRow[col] == '0') ? EMPTY_CELL_VALUE : firstRow[col] - '0';
+		if (getBoardCellValue(viewBoardCellByRow(board, 0, col)) != expectedValue)
+			return false;
+	}
+
+	return firstRow[MN] == '\0';
+}
+
+/**
+ * Runs a test of the corpus reader, printing the first read whose outcome is not the
+ * expected one, if any.
+ *
+ * @param test 		[in] The test to be run
+ * @return true 	iff every read had the expected outcome
+ * @return false 	otherwise, or if the corpus could not be written or opened
+ */
+bool runCorpusTest(const CorpusTest* test) {
+	PuzzleCorpusReader* reader = NULL;
+	Board board = {0};
+	bool success = true;
+	int readNo = 0;
+	FILE* file = fopen(CORPUS_TEST_FILE_PATH, "wb");
+
+	if ((file == NULL) || (fputs(test->contents, file) == EOF)) {
+		if (file != NULL)
+			fclose(file);
+		printf("%s: corpus could not be written\n", test->name);
+		return false;
+	}
+	fclose(file);
+
+	reader = openPuzzleCorpusReader(CORPUS_TEST_FILE_PATH);
+	if (reader == NULL) {
+		printf("%s: corpus could not be opened\n", test->name);
+		remove(CORPUS_TEST_FILE_PATH);
+		return false;
+	}
+
+	for (readNo = 0; success; readNo++) {
+		const CorpusTestRead* expected = &(test->reads[readNo]);
+		ReadPuzzleFromCorpusErrorCode error = readPuzzleFromCorpus(reader, &board);
+
+		if (error != expected->error) {
+			printf("%s: read %d returned %d, expected %d\n", test->name, readNo + 1, error, expected->error);
+			success = false;
+		} else if ((error == ERROR_SUCCESS) && !isFirstBoardRow(&board, expected->firstRow)) {
+			printf("%s: read %d did not read a puzzle starting with %s\n", test->name, readNo + 1, expected->firstRow);
+			success = false;
+		}
+
+		if (error == READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES)
+			break;
+	}
+
+	closePuzzleCorpusReader(reader);
+	cleanupBoard(&board);
+	remove(CORPUS_TEST_FILE_PATH);
+	return success;
+}
+
+/**
+ * Tests that the line format writer only accepts boards whose block dimensions the reader
+ * deduces: a 6x6 board with blocks of 2 rows and 3 columns is written and read back as
+ * such, while one with blocks of 3 rows and 2 columns is rejected.
+ *
+ * @return true 	iff the writer and the reader behaved as expected
+ * @return false 	otherwise, or if a memory error occurred
+ */
+bool runLineFormatBlockDimensionsTest() {
+	PuzzleCorpusWriter* writer = NULL;
+	PuzzleCorpusReader* reader = NULL;
+	Board wideBlocksBoard = {0};
+	Board tallBlocksBoard = {0};
+	Board readBoard = {0};
+	bool success = false;
+
+	wideBlocksBoard.numRowsInBlock_M = 2;
+	wideBlocksBoard.numColumnsInBlock_N = 3;
+	tallBlocksBoard.numRowsInBlock_M = 3;
+	tallBlocksBoard.numColumnsInBlock_N = 2;
+	writer = openPuzzleCorpusWriter(CORPUS_TEST_FILE_PATH, PUZZLE_CORPUS_FORMAT_LINE);
+	if (createEmptyBoard(&wideBlocksBoard) && createEmptyBoard(&tallBlocksBoard) && (writer != NULL)) {
+		success = writePuzzleToCorpus(writer, &wideBlocksBoard) &&
+				  !writePuzzleToCorpus(writer, &tallBlocksBoard);
+		success = closePuzzleCorpusWriter(writer) && success;
+		writer = NULL;
+	}
+	closePuzzleCorpusWriter(writer);
+
+	if (success) {
+		reader = openPuzzleCorpusReader(CORPUS_TEST_FILE_PATH);
+		success = (reader != NULL) &&
+				  (readPuzzleFromCorpus(reader, &readBoard) == ERROR_SUCCESS) &&
+				  (readBoard.numRowsInBlock_M == 2) && (readBoard.numColumnsInBlock_N == 3) &&
+				  (readPuzzleFromCorpus(reader, &readBoard) == READ_PUZZLE_FROM_CORPUS_NO_MORE_PUZZLES);
+		closePuzzleCorpusReader(reader);
+	}
+
+	cleanupBoard(&wideBlocksBoard);
+	cleanupBoard(&tallBlocksBoard);
+	cleanupBoard(&readBoard);
+	remove(CORPUS_TEST_FILE_PATH);
+	return success;
+}
+
+int main() {
+	const CorpusTest* test = NULL;
+	int numFailures = 0;
+	bool success = false;
+
+	for (test = corpusTests; test->name != NULL; test++) {
+		success = runCorpusTest(test);
+		printf("%-40s %s\n", test->name, success ? "passed" : "FAILED");
+		if (!success)
+			numFailures++;
+	}
+
+	success = runLineFormatBlockDimensionsTest();
+	printf("%-40s %s\n", "block dimensions in the line format", success ? "passed" : "FAILED");
+	if (!success)
+		numFailures++;
+
+	cleanupBoardGeometries();
+	return (numFailures == 0) ? 0 : 1;
+}
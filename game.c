@@ -1,11 +1,18 @@
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "game.h"
 
 #include "undo_redo_list.h"
+#include "journal.h"
 
 #define UNUSED(x) (void)(x)
 
+#define ERROR_SUCCESS (0)
+
+#define JOURNAL_TEMP_FILE_SUFFIX (".tmp")
+
 #define GAME_MODE_INIT_STRING ("INIT")
 #define GAME_MODE_EDIT_STRING ("EDIT")
 #define GAME_MODE_SOLVE_STRING ("SOLVE")
@@ -14,16 +21,28 @@
  * GameState struct represents a sudoku game in its current GameState. It contains the board itself, a 
  * possible solution for it, and the number of cells left to fill in the board in its current
  * configuration.
+ * Alongside the counter of each value in each row, column and block, it keeps the sum of the
+ * indices of the cells holding that value there. Once a counter drops to 1, the sum is the index
+ * of the only cell left holding the value, so that cell is found without scanning.
+ * A copy of the board as it was when the GameState was created is kept, so that a Reset
+ * may return to it directly rather than undo every move in turn.
+ * If the game is journaled, the journal file is kept open, to append every change to the
+ * undo-redo list to it as it is made.
  * Note: the implementation of this struct is meant to be hidden from the user.
  */
 struct GameState {
 	Board puzzle;
+	Board initialPuzzle;
 	int numEmpty;
 	int numErroneous;
 	int** rowsCellsValuesCounters;
 	int** columnsCellsValuesCounters;
 	int** blocksCellsValuesCounters;
+	int** rowsCellsValuesIndicesSums;
+	int** columnsCellsValuesIndicesSums;
+	int** blocksCellsValuesIndicesSums;
 	UndoRedoList moveList;
+	FILE* journal;
 };
 
 
@@ -126,7 +145,7 @@ isPuzzleSolvableErrorCode isPuzzleSolvable(GameState* gameState) {
 }
 
 bool isCellEmpty(GameState* gameState, int row, int col) {
-	return gameState->puzzle.cells[row][col].value == EMPTY_CELL_VALUE;
+	return isBoardCellEmpty(viewBoardCellByRow(&(gameState->puzzle), row, col));
 }
 
 bool isCellFixed(GameState* gameState, int row, int col) {
@@ -150,7 +169,8 @@ void setMarkErrors(State* state, bool shouldMarkErrors) {
 }
 
 /**
- * Free all memory allocated to all counter matrices in the GameState.
+ * Free all memory allocated to all counter matrices in the GameState, and to the matrices
+ * of indices sums alongside them.
  * 
  * @param gameState 	[in, out] GameState whose counter matrices are freed
  */
@@ -167,6 +187,18 @@ void freeCellsValuesCounters(GameState* gameState) {
 		freeSpecificCellsValuesCounters(gameState->blocksCellsValuesCounters, &(gameState->puzzle));
 		gameState->blocksCellsValuesCounters = NULL;
 	}
+	if (gameState->rowsCellsValuesIndicesSums != NULL) {
+		freeSpecificCellsValuesCounters(gameState->rowsCellsValuesIndicesSums, &(gameState->puzzle));
+		gameState->rowsCellsValuesIndicesSums = NULL;
+	}
+	if (gameState->columnsCellsValuesIndicesSums != NULL) {
+		freeSpecificCellsValuesCounters(gameState->columnsCellsValuesIndicesSums, &(gameState->puzzle));
+		gameState->columnsCellsValuesIndicesSums = NULL;
+	}
+	if (gameState->blocksCellsValuesIndicesSums != NULL) {
+		freeSpecificCellsValuesCounters(gameState->blocksCellsValuesIndicesSums, &(gameState->puzzle));
+		gameState->blocksCellsValuesIndicesSums = NULL;
+	}
 }
 
 /**
@@ -209,46 +241,95 @@ void updateCellErroneousness(GameState* gameState, int row, int col) {
 }
 
 /**
- * Update the erroneousness status of all cells in a row.
+ * Update the counter of a value in the row, column or block of a cell, along with the sum
+ * of the indices of the cells holding the value there, as the value is placed in the cell
+ * or removed from it.
  * 
- * @param gameState 	[in, out] GameState to be examined and updated accordingly
- * @param row 			[in] Number of row to update
+ * @param gameState 			[in] GameState whose board the cell belongs to
+ * @param category 				[in] The category (row, column or block) of the counter
+ * @param cellsValuesCounters 	[in, out] The counter matrix of the category
+ * @param cellsValuesIndicesSums 	[in, out] The matrix of indices sums of the category
+ * @param row 					[in] The number of row in which the cell is located
+ * @param col 					[in] The number of column in which the cell is located
+ * @param value 				[in] The value placed or removed
+ * @param delta 				[in] +1 if the value is placed, -1 if it is removed
  */
-void updateCellErroneousnessInRow(GameState* gameState, int row) {
-	int MN = gameState->puzzle.numColumnsInBlock_N * gameState->puzzle.numRowsInBlock_M;
-	int i = 0;
-	for (i = 0; i < MN; i++)
-		updateCellErroneousness(gameState, row, i);
+void updateCellsValuesCounter(GameState* gameState, BoardCategory category, int** cellsValuesCounters, int** cellsValuesIndicesSums, int row, int col, int value, int delta) {
+	const BoardGeometry* geometry = gameState->puzzle.geometry;
+	int cell = row * geometry->MN + col;
+	int categoryNo = geometry->cellsCategories[category][cell];
+
+	cellsValuesCounters[categoryNo][value] += delta;
+	cellsValuesIndicesSums[categoryNo][value] += delta * geometry->cellsIndicesInCategories[category][cell];
 }
 
 /**
- * Update the erroneousness status of all cells in a column.
+ * Once a value has been placed in a cell or removed from it, and the counters updated,
+ * update the erroneousness status of the other cells holding the value in the cell's row,
+ * column or block. Their status may only change when the counter crosses between 1 and 2,
+ * and then there is exactly one other cell holding the value, found by the indices sum.
  * 
- * @param gameState 	[in, out] GameState to be examined and updated accordingly
- * @param col 			[in] Number of column to update
+ * @param gameState 			[in, out] GameState to be examined and updated accordingly
+ * @param category 				[in] The category (row, column or block) of the counter
+ * @param cellsValuesCounters 	[in] The counter matrix of the category
+ * @param cellsValuesIndicesSums 	[in] The matrix of indices sums of the category
+ * @param row 					[in] The number of row in which the cell is located
+ * @param col 					[in] The number of column in which the cell is located
+ * @param value 				[in] The value placed or removed
+ * @param isPlaced 				[in] true if the value was placed in the cell, false if it
+ * 								was removed from it
  */
-void updateCellErroneousnessInColumn(GameState* gameState, int col) {
-	int MN = gameState->puzzle.numColumnsInBlock_N * gameState->puzzle.numRowsInBlock_M;
-	int i = 0;
-	for (i = 0; i < MN; i++)
-		updateCellErroneousness(gameState, i, col);
+void updateOtherValueCellErroneousness(GameState* gameState, BoardCategory category, int** cellsValuesCounters, int** cellsValuesIndicesSums, int row, int col, int value, bool isPlaced) {
+	const BoardGeometry* geometry = gameState->puzzle.geometry;
+	int cell = row * geometry->MN + col;
+	int categoryNo = geometry->cellsCategories[category][cell];
+	int otherIndexInCategory = 0, otherCell = 0;
+
+	if (isPlaced) {
+		if (cellsValuesCounters[categoryNo][value] != 2)
+			return;
+		otherIndexInCategory = cellsValuesIndicesSums[categoryNo][value] - geometry->cellsIndicesInCategories[category][cell];
+	} else {
+		if (cellsValuesCounters[categoryNo][value] != 1)
+			return;
+		otherIndexInCategory = cellsValuesIndicesSums[categoryNo][value];
+	}
+
+	otherCell = geometry->categoriesCells[category][categoryNo * geometry->MN + otherIndexInCategory];
+	updateCellErroneousness(gameState, otherCell / geometry->MN, otherCell % geometry->MN);
 }
 
 /**
- * Update the erroneousness status of all cells in a block.
+ * Place a value in a cell or remove it from it, in terms of the counters of the cell's row,
+ * column and block.
  * 
- * @param gameState 	[in, out] GameState to be examined and updated accordingly
- * @param block 		[in] Number of block to update
+ * @param gameState 	[in, out] GameState whose counters are updated
+ * @param row 			[in] The number of row in which the cell is located
+ * @param col 			[in] The number of column in which the cell is located
+ * @param value 		[in] The value placed or removed
+ * @param delta 		[in] +1 if the value is placed, -1 if it is removed
  */
-void updateCellErroneousnessInBlock(GameState* gameState, int block) {
-	int MN = gameState->puzzle.numColumnsInBlock_N * gameState->puzzle.numRowsInBlock_M;
-	int i = 0;
-	for (i = 0; i < MN; i++) {
-		int row = 0, col = 0;
-		getRowBasedIDGivenBlockBasedID(&(gameState->puzzle), block, i, &row, &col);
-		updateCellErroneousness(gameState, row, col);
-	}
+void updateCellValueCounters(GameState* gameState, int row, int col, int value, int delta) {
+	updateCellsValuesCounter(gameState, BOARD_CATEGORY_ROW, gameState->rowsCellsValuesCounters, gameState->rowsCellsValuesIndicesSums, row, col, value, delta);
+	updateCellsValuesCounter(gameState, BOARD_CATEGORY_COLUMN, gameState->columnsCellsValuesCounters, gameState->columnsCellsValuesIndicesSums, row, col, value, delta);
+	updateCellsValuesCounter(gameState, BOARD_CATEGORY_BLOCK, gameState->blocksCellsValuesCounters, gameState->blocksCellsValuesIndicesSums, row, col, value, delta);
+}
 
+/**
+ * Update the erroneousness status of the other cells holding a value in the row, column
+ * and block of a cell, once the value has been placed in the cell or removed from it.
+ * 
+ * @param gameState 	[in, out] GameState to be examined and updated accordingly
+ * @param row 			[in] The number of row in which the cell is located
+ * @param col 			[in] The number of column in which the cell is located
+ * @param value 		[in] The value placed or removed
+ * @param isPlaced 		[in] true if the value was placed in the cell, false if it was
+ * 						removed from it
+ */
+void updateOtherValueCellsErroneousness(GameState* gameState, int row, int col, int value, bool isPlaced) {
+	updateOtherValueCellErroneousness(gameState, BOARD_CATEGORY_ROW, gameState->rowsCellsValuesCounters, gameState->rowsCellsValuesIndicesSums, row, col, value, isPlaced);
+	updateOtherValueCellErroneousness(gameState, BOARD_CATEGORY_COLUMN, gameState->columnsCellsValuesCounters, gameState->columnsCellsValuesIndicesSums, row, col, value, isPlaced);
+	updateOtherValueCellErroneousness(gameState, BOARD_CATEGORY_BLOCK, gameState->blocksCellsValuesCounters, gameState->blocksCellsValuesIndicesSums, row, col, value, isPlaced);
 }
 
 /**
@@ -267,7 +348,7 @@ void updateCellsErroneousness(GameState* gameState) {
 
 /**
  * Create all three counter matrices for the provided GameState's board, for rows, columns
- * and blocks.
+ * and blocks, and the three matrices of indices sums alongside them.
  * 
  * @param gameState 	[in, out] GameState for whom the counters are created
  * @return true 		iff the procedure was successful and all counters were assigned
@@ -276,13 +357,19 @@ void updateCellsErroneousness(GameState* gameState) {
 bool createCellsValuesCounters(GameState* gameState) {
 	const Board* puzzle = getPuzzle(gameState);
 
-	gameState->rowsCellsValuesCounters = createCellsValuesCountersByCategory(puzzle, viewBoardCellByRow);
-	gameState->columnsCellsValuesCounters = createCellsValuesCountersByCategory(puzzle, viewBoardCellByColumn);
-	gameState->blocksCellsValuesCounters = createCellsValuesCountersByCategory(puzzle, viewBoardCellByBlock);
+	gameState->rowsCellsValuesCounters = createCellsValuesCountersByCategory(puzzle, BOARD_CATEGORY_ROW);
+	gameState->columnsCellsValuesCounters = createCellsValuesCountersByCategory(puzzle, BOARD_CATEGORY_COLUMN);
+	gameState->blocksCellsValuesCounters = createCellsValuesCountersByCategory(puzzle, BOARD_CATEGORY_BLOCK);
+	gameState->rowsCellsValuesIndicesSums = createCellsValuesIndicesSumsByCategory(puzzle, BOARD_CATEGORY_ROW);
+	gameState->columnsCellsValuesIndicesSums = createCellsValuesIndicesSumsByCategory(puzzle, BOARD_CATEGORY_COLUMN);
+	gameState->blocksCellsValuesIndicesSums = createCellsValuesIndicesSumsByCategory(puzzle, BOARD_CATEGORY_BLOCK);
 
 	if ((gameState->rowsCellsValuesCounters != NULL) &&
 		(gameState->columnsCellsValuesCounters != NULL) &&
-		(gameState->blocksCellsValuesCounters != NULL)) {
+		(gameState->blocksCellsValuesCounters != NULL) &&
+		(gameState->rowsCellsValuesIndicesSums != NULL) &&
+		(gameState->columnsCellsValuesIndicesSums != NULL) &&
+		(gameState->blocksCellsValuesIndicesSums != NULL)) {
 		return true;
 	}
 
@@ -309,14 +396,20 @@ GameState* createGameState(Board* board, GameMode mode) {
 			if (!createCellsValuesCounters(gameState))
 				success = false;
 
+		if (success)
+			if (!copyBoard(&(gameState->puzzle), &(gameState->initialPuzzle)))
+				success = false;
+
 		if (success) {
 			gameState->numEmpty = countNumEmptyCells(&(gameState->puzzle));
 			gameState->numErroneous = 0;
 			updateCellsErroneousness(gameState);
-			initUndoRedo(&(gameState->moveList));
+			initUndoRedo(&(gameState->moveList), getBlockSize_MN(gameState));
 
-			if (mode == GAME_MODE_EDIT)
+			if (mode == GAME_MODE_EDIT) {
 				markAllCellsAsNotFixed(&(gameState->puzzle));
+				markAllCellsAsNotFixed(&(gameState->initialPuzzle));
+			}
 
 			return gameState;
 		}
@@ -333,9 +426,12 @@ void cleanupGameState(GameState* gameState) {
 	freeCellsValuesCounters(gameState);
 
 	cleanupBoard(&(gameState->puzzle));
+	cleanupBoard(&(gameState->initialPuzzle));
 
 	cleanupUndoRedoList(&(gameState->moveList));
 
+	closeJournal(gameState->journal);
+
 	free(gameState);
 }
 
@@ -379,25 +475,17 @@ bool isValueLegalForCell(GameState* gameState, int row, int col, int value) {
 }
 
 int setPuzzleCell(GameState* gameState, int row, int col, int value) {
-	int block, prevValue = getCellValue(gameState, row, col);
+	int prevValue = getCellValue(gameState, row, col);
 	if (prevValue == value) {
 		/* Nothing to be done */
 		return value;
 	}
 
-	block = whichBlock(&(gameState->puzzle), row, col);
+	if (prevValue != EMPTY_CELL_VALUE)
+		updateCellValueCounters(gameState, row, col, prevValue, -1);
 
-	if (prevValue != EMPTY_CELL_VALUE) {
-		gameState->rowsCellsValuesCounters[row][prevValue]--;
-		gameState->columnsCellsValuesCounters[col][prevValue]--;
-		gameState->blocksCellsValuesCounters[block][prevValue]--;
-	}
-
-	if (value != EMPTY_CELL_VALUE) {
-		gameState->rowsCellsValuesCounters[row][value]++;
-		gameState->columnsCellsValuesCounters[col][value]++;
-		gameState->blocksCellsValuesCounters[block][value]++;
-	}
+	if (value != EMPTY_CELL_VALUE)
+		updateCellValueCounters(gameState, row, col, value, +1);
 
 	if (isCellEmpty(gameState, row, col) && value != EMPTY_CELL_VALUE) {
 		gameState->numEmpty--;
@@ -406,12 +494,41 @@ int setPuzzleCell(GameState* gameState, int row, int col, int value) {
 		gameState->numEmpty++;
 	}
 	setBoardCellValue(&(gameState->puzzle), row, col, value);
-	updateCellErroneousnessInRow(gameState, row);
-	updateCellErroneousnessInColumn(gameState, col);
-	updateCellErroneousnessInBlock(gameState, block);
+
+	/* only the cell itself, and cells sharing one of its values with it, may change status */
+	updateCellErroneousness(gameState, row, col);
+	if (prevValue != EMPTY_CELL_VALUE)
+		updateOtherValueCellsErroneousness(gameState, row, col, prevValue, false);
+	if (value != EMPTY_CELL_VALUE)
+		updateOtherValueCellsErroneousness(gameState, row, col, value, true);
 	return prevValue;
 }
 
+/**
+ * Append a record to the GameState's journal, if it is journaled. Should the write fail,
+ * the journal is closed and journaling stops, but the game itself goes on unaffected.
+ * 
+ * @param gameState 	[in, out] GameState whose journal is appended to
+ * @param type 			[in] The type of the record
+ * @param move 			[in] The move added to the undo-redo list, for a move record
+ */
+void appendToGameJournal(GameState* gameState, JournalRecordType type, const Move* move) {
+	bool success = false;
+
+	if (gameState->journal == NULL)
+		return;
+
+	if (type == JOURNAL_RECORD_TYPE_MOVE)
+		success = appendMoveToJournal(gameState->journal, move);
+	else
+		success = appendRecordToJournal(gameState->journal, type);
+
+	if (!success) {
+		closeJournal(gameState->journal);
+		gameState->journal = NULL;
+	}
+}
+
 bool makeCellChangeMove(GameState* gameState, int value, int row, int col) {
 	int prevVal;
 	Move* move = createMove();
@@ -430,6 +547,7 @@ bool makeCellChangeMove(GameState* gameState, int value, int row, int col) {
 		return false;
 	}
 
+	appendToGameJournal(gameState, JOURNAL_RECORD_TYPE_MOVE, getCurrentMove(&(gameState->moveList)));
 	return true;
 }
 
@@ -441,15 +559,12 @@ bool makeCellChangeMove(GameState* gameState, int value, int row, int col) {
  * @param undo 			iff true, move is undo. Else, move is redone
  */
 void applyMoveToBoard(GameState* gameState, const Move* move, bool undo) {
-	const Node* currNode;
-	CellChange* change;
+	const CellChange* changes = getMoveCellChanges(move);
+	int i = 0;
 
-	currNode = getFirstCellChange(move);
-	while (currNode != NULL) {
-		change = (CellChange*) getNodeData(currNode);
-		setPuzzleCell(gameState, change->row, change->col, undo ? change->prevVal : change->newVal);
-		currNode = getNodeNext(currNode);
-	}
+	/* Note: changes are applied most recent first, as they are listed in the output */
+	for (i = getMoveSize(move) - 1; i >= 0; i--)
+		setPuzzleCell(gameState, changes[i].row, changes[i].col, undo ? changes[i].prevVal : changes[i].newVal);
 }
 
 
@@ -461,8 +576,9 @@ bool makeMove(GameState* gameState, Move* move) {
 		return false;
 	}
 
-	/* perform all single cell moves */
-	applyMoveToBoard(gameState, move, false);
+	/* perform all single cell moves, as copied to the move list */
+	applyMoveToBoard(gameState, getCurrentMove(&(gameState->moveList)), false);
+	appendToGameJournal(gameState, JOURNAL_RECORD_TYPE_MOVE, getCurrentMove(&(gameState->moveList)));
 	return true;
 }
 
@@ -510,6 +626,7 @@ const Move* undoMove(GameState* gameState) {
 		return NULL; /* nothing to undo */
 	}
 	applyMoveToBoard(gameState, moveToUndo, true);
+	appendToGameJournal(gameState, JOURNAL_RECORD_TYPE_UNDO, NULL);
 	return moveToUndo;
 }
 
@@ -519,16 +636,143 @@ const Move* redoMove(GameState* gameState) {
 		return NULL; /* nothing to redo */
 	}
 	applyMoveToBoard(gameState, moveToRedo, false);
+	appendToGameJournal(gameState, JOURNAL_RECORD_TYPE_REDO, NULL);
 	return moveToRedo;
 }
 
 bool resetMoves(GameState* gameState) {
-	bool changed = false;
-    while (canUndo(&(gameState->moveList))) {
+	const Board* initialPuzzle = &(gameState->initialPuzzle);
+	int MN = getBlockSize_MN(gameState);
+	int row = 0, col = 0;
+
+	if (!undoAllInList(&(gameState->moveList))) {
+		return false; /* nothing to undo */
+	}
+
+	/* undoing every move leads back to the initial board, so only the cells that differ from it are set */
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++)
+			setPuzzleCell(gameState, row, col, getBoardCellValue(viewBoardCellByRow(initialPuzzle, row, col)));
+
+	appendToGameJournal(gameState, JOURNAL_RECORD_TYPE_RESET, NULL);
+	return true;
+}
+
+bool startGameJournal(GameState* gameState, char* filePath) {
+	UndoRedoList* moveList = &(gameState->moveList);
+	char* tempFilePath = NULL;
+	FILE* journal = NULL;
+	bool success = true;
+	int i = 0;
+
+	tempFilePath = calloc(strlen(filePath) + strlen(JOURNAL_TEMP_FILE_SUFFIX) + 1, sizeof(char));
+	if (tempFilePath == NULL)
+		return false;
+	strcpy(tempFilePath, filePath);
+	strcat(tempFilePath, JOURNAL_TEMP_FILE_SUFFIX);
+
+	/* the moves in the list lead from the board the GameState was created with to its current board */
+	journal = createJournal(tempFilePath, &(gameState->initialPuzzle));
+	success = (journal != NULL);
+	for (i = 0; success && (i < getNumMovesInList(moveList)); i++)
+		success = writeMoveToJournal(journal, getMoveInList(moveList, i));
+	for (i = 0; success && (i < getNumUndosInList(moveList)); i++)
+		success = writeRecordToJournal(journal, JOURNAL_RECORD_TYPE_UNDO);
+	/* the records are synchronized once, and before the rename, which replaces the file in the path atomically */
+	success = success && syncJournal(journal);
+	closeJournal(journal);
+
+	if (success)
+		success = (rename(tempFilePath, filePath) == 0);
+	if (!success)
+		remove(tempFilePath);
+	free(tempFilePath);
+
+	if (success) {
+		journal = fopen(filePath, "ab");
+		success = (journal != NULL);
+	}
+	if (success) {
+		closeJournal(gameState->journal);
+		gameState->journal = journal;
+	}
+
+	return success;
+}
+
+/**
+ * Replay a record read from a journal on the GameState. Moves that cannot be undone or
+ * redone are skipped, as they were not recorded in the first place.
+ * 
+ * @param gameState 					[in, out] GameState to which the record is applied
+ * @param type 							[in] The type of the record
+ * @param move 							[in] The move of a move record, owned by the function
+ * @return ReadJournalRecordErrorCode 	READ_JOURNAL_RECORD_MEMORY_ALLOCATION_FAILURE if a
+ * 										memory error occurred, or 0 otherwise
+ */
+ReadJournalRecordErrorCode replayJournalRecord(GameState* gameState, JournalRecordType type, Move* move) {
+	switch (type) {
+	case JOURNAL_RECORD_TYPE_MOVE:
+		if (!makeMove(gameState, move)) {
+			destroyMove(move);
+			return READ_JOURNAL_RECORD_MEMORY_ALLOCATION_FAILURE;
+		}
+		break;
+	case JOURNAL_RECORD_TYPE_UNDO:
 		undoMove(gameState);
-        changed = true;
-    }
-    return changed;
+		break;
+	case JOURNAL_RECORD_TYPE_REDO:
+		redoMove(gameState);
+		break;
+	case JOURNAL_RECORD_TYPE_RESET:
+		resetMoves(gameState);
+		break;
+	}
+
+	return ERROR_SUCCESS;
+}
+
+LoadBoardFromFileErrorCode createGameStateFromJournal(char* filePath, GameMode mode, GameState** gameStateOut) {
+	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
+	ReadJournalRecordErrorCode readRetVal = ERROR_SUCCESS;
+	FILE* journal = NULL;
+	Board board = {0};
+	GameState* gameState = NULL;
+
+	retVal = openJournal(filePath, &journal, &board);
+	if (retVal != ERROR_SUCCESS)
+		return retVal;
+
+	gameState = createGameState(&board, mode);
+	cleanupBoard(&board);
+	if (gameState == NULL) {
+		closeJournal(journal);
+		return LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE;
+	}
+
+	/* Note: the GameState is not journaled yet, so replaying the records does not append them again */
+	do {
+		JournalRecordType type = JOURNAL_RECORD_TYPE_MOVE;
+		Move* move = NULL;
+		readRetVal = readJournalRecord(journal, &(gameState->puzzle), &type, &move);
+		if (readRetVal == ERROR_SUCCESS)
+			readRetVal = replayJournalRecord(gameState, type, move);
+	} while (readRetVal == ERROR_SUCCESS);
+	closeJournal(journal);
+
+	if (readRetVal == READ_JOURNAL_RECORD_MEMORY_ALLOCATION_FAILURE) {
+		cleanupGameState(gameState);
+		return LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE;
+	}
+
+	/* rewriting the journal drops a record cut short at its end, which appending would follow */
+	if (!startGameJournal(gameState, filePath)) {
+		cleanupGameState(gameState);
+		return LOAD_BOARD_FROM_FILE_FILE_COULD_NOT_BE_OPENED;
+	}
+
+	*gameStateOut = gameState;
+	return ERROR_SUCCESS;
 }
 
 bool isSolutionSuccessful(GameState* gameState) {
@@ -541,60 +785,311 @@ bool isSolutionFailing(GameState* gameState) {
 		   (isBoardErroneous(gameState));
 }
 
-bool autofill(GameState* gameState, Move** outMove) {
-	int MN, row, col, val;
-	CellLegalValues** cellsLegalValues = NULL;
-	Move* move = createMove();
-	if (move == NULL) {
+/**
+ * Get the only legal value of an empty cell, according to the counters of its row, column
+ * and block.
+ * 
+ * @param gameState 	[in] GameState whose board's cell is examined
+ * @param row 			[in] The number of row in which the cell is located
+ * @param col 			[in] The number of column in which the cell is located
+ * @return int 			The cell's only legal value, or EMPTY_CELL_VALUE if it has none or
+ * 						more than one
+ */
+int getSingleLegalValueForCell(GameState* gameState, int row, int col) {
+	int MN = getBlockSize_MN(gameState);
+	int value = 0, singleValue = EMPTY_CELL_VALUE;
+
+	for (value = 1; value <= MN; value++) {
+		if (isValueLegalForCell(gameState, row, col, value)) {
+			if (singleValue != EMPTY_CELL_VALUE)
+				return EMPTY_CELL_VALUE;
+			singleValue = value;
+		}
+	}
+
+	return singleValue;
+}
+
+/**
+ * Document in a Move struct the empty cells of the GameState's board that have a single
+ * legal value, setting each to it. All of them are found on the board as it is, before
+ * any is set, so the board itself is left unchanged.
+ * 
+ * @param gameState 	[in] GameState whose board is examined
+ * @param move 			[in, out] Move to which the changes are added
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool findSingleLegalValues(GameState* gameState, Move* move) {
+	int MN = getBlockSize_MN(gameState);
+	int row = 0, col = 0;
+
+	for (row = 0; row < MN; row++) {
+		for (col = 0; col < MN; col++) {
+			if (isCellEmpty(gameState, row, col)) {
+				int value = getSingleLegalValueForCell(gameState, row, col);
+				if ((value != EMPTY_CELL_VALUE) &&
+					!addCellChangeToMove(move, EMPTY_CELL_VALUE, value, row, col))
+					return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * AutofillUnitsQueue is a work queue of the units - rows, columns and blocks - of a board
+ * that may hold singles to place. A unit is numbered by its category and its number
+ * within it, as category * MN + categoryNo, and is queued at most once at a time.
+ */
+typedef struct {
+	int* units;
+	bool* isQueued;
+	int head;
+	int numQueued;
+	int capacity;
+} AutofillUnitsQueue;
+
+/**
+ * Create an AutofillUnitsQueue holding all the units of the GameState's board.
+ * 
+ * @param gameState 	[in] GameState whose board's units are queued
+ * @param queue 		[in, out] The queue to be created
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool createAutofillUnitsQueue(GameState* gameState, AutofillUnitsQueue* queue) {
+	int unit = 0;
+
+	queue->capacity = BOARD_NUM_CATEGORIES * getBlockSize_MN(gameState);
+	queue->units = calloc(queue->capacity, sizeof(int));
+	queue->isQueued = calloc(queue->capacity, sizeof(bool));
+	if ((queue->units == NULL) || (queue->isQueued == NULL)) {
+		free(queue->units);
+		free(queue->isQueued);
 		return false;
 	}
 
-	if (!getSuperficiallyLegalValuesForAllBoardCells(&(gameState->puzzle), &cellsLegalValues)) {
-		destroyMove(move);
+	for (unit = 0; unit < queue->capacity; unit++) {
+		queue->units[unit] = unit;
+		queue->isQueued[unit] = true;
+	}
+	queue->head = 0;
+	queue->numQueued = queue->capacity;
+	return true;
+}
+
+/**
+ * Free all memory allocated to an AutofillUnitsQueue.
+ * 
+ * @param queue 	[in, out] The queue to be freed
+ */
+void cleanupAutofillUnitsQueue(AutofillUnitsQueue* queue) {
+	free(queue->units);
+	free(queue->isQueued);
+}
+
+/**
+ * Queue a unit, unless it is queued already.
+ * 
+ * @param queue 	[in, out] The queue to which the unit is added
+ * @param unit 		[in] The number of the unit
+ */
+void enqueueAutofillUnit(AutofillUnitsQueue* queue, int unit) {
+	if (queue->isQueued[unit])
+		return;
+
+	queue->units[(queue->head + queue->numQueued) % queue->capacity] = unit;
+	queue->isQueued[unit] = true;
+	queue->numQueued++;
+}
+
+/**
+ * Take the first unit out of a queue that is not empty.
+ * 
+ * @param queue 	[in, out] The queue from which the unit is taken
+ * @return int 		The number of the unit
+ */
+int dequeueAutofillUnit(AutofillUnitsQueue* queue) {
+	int unit = queue->units[queue->head];
+
+	queue->head = (queue->head + 1) % queue->capacity;
+	queue->numQueued--;
+	queue->isQueued[unit] = false;
+	return unit;
+}
+
+/**
+ * Get the counter matrix of the provided category.
+ * 
+ * @param gameState 	[in] GameState whose counters are requested
+ * @param category 		[in] The category (row, column or block) of the counters
+ * @return int** 		The counter matrix
+ */
+int** getCellsValuesCountersByCategory(GameState* gameState, BoardCategory category) {
+	switch (category) {
+	case BOARD_CATEGORY_ROW:
+		return gameState->rowsCellsValuesCounters;
+	case BOARD_CATEGORY_COLUMN:
+		return gameState->columnsCellsValuesCounters;
+	default:
+		return gameState->blocksCellsValuesCounters;
+	}
+}
+
+/**
+ * Place a single in an empty cell, documenting it in a Move struct, and queue the units
+ * in which new singles may have appeared as a result: the units of the cell, whose other
+ * cells can no longer take the value, and the units of those cells, in which the value
+ * now has fewer cells to go to.
+ * 
+ * @param gameState 	[in, out] GameState whose board's cell is set
+ * @param queue 		[in, out] The work queue of units
+ * @param move 			[in, out] Move to which the change is added
+ * @param cell 			[in] The index of the cell, in row-major order
+ * @param value 		[in] The value to place in the cell
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool placeAutofillSingle(GameState* gameState, AutofillUnitsQueue* queue, Move* move, int cell, int value) {
+	const BoardGeometry* geometry = gameState->puzzle.geometry;
+	int MN = geometry->MN;
+	int category = 0, peerCategory = 0, i = 0;
+
+	if (!addCellChangeToMove(move, EMPTY_CELL_VALUE, value, cell / MN, cell % MN))
 		return false;
+	setPuzzleCell(gameState, cell / MN, cell % MN, value);
+
+	for (category = 0; category < BOARD_NUM_CATEGORIES; category++) {
+		int categoryNo = geometry->cellsCategories[category][cell];
+		enqueueAutofillUnit(queue, category * MN + categoryNo);
+
+		for (i = 0; i < MN; i++) {
+			int peer = geometry->categoriesCells[category][categoryNo * MN + i];
+			if (!isCellEmpty(gameState, peer / MN, peer % MN))
+				continue;
+			for (peerCategory = 0; peerCategory < BOARD_NUM_CATEGORIES; peerCategory++) {
+				int peerCategoryNo = geometry->cellsCategories[peerCategory][peer];
+				if (getCellsValuesCountersByCategory(gameState, (BoardCategory)peerCategory)[peerCategoryNo][value] == 0)
+					enqueueAutofillUnit(queue, peerCategory * MN + peerCategoryNo);
+			}
+		}
 	}
 
-	MN = getBlockSize_MN(gameState);
-	for (row = 0; row < MN; row++) {
-		for (col = 0; col < MN; col++) {
-			CellLegalValues* legalValuesStruct = &(cellsLegalValues[row][col]);
-			/* if only one legal value, set it in the board */
-			if (isCellEmpty(gameState, row, col) &&
-				legalValuesStruct->numLegalValues == 1) {
-				for (val = 1; val <= MN; val++) {
-					if (legalValuesStruct->legalValues[val]) {
-						if (!addCellChangeToMove(move, EMPTY_CELL_VALUE, val, row, col)) {
-							destroyMove(move);
-							freeCellsLegalValuesForAllBoardCells(&(gameState->puzzle), cellsLegalValues);
-							return false;
-						}
-						break;
-					}
-				}
+	return true;
+}
+
+/**
+ * Place the singles of a unit: its naked singles, empty cells with a single legal value,
+ * and its hidden singles, values missing from it that only one of its empty cells may
+ * take.
+ * 
+ * @param gameState 	[in, out] GameState whose board's cells are set
+ * @param queue 		[in, out] The work queue of units
+ * @param move 			[in, out] Move to which the changes are added
+ * @param unit 			[in] The number of the unit
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool placeAutofillSinglesInUnit(GameState* gameState, AutofillUnitsQueue* queue, Move* move, int unit) {
+	const BoardGeometry* geometry = gameState->puzzle.geometry;
+	int MN = geometry->MN;
+	BoardCategory category = (BoardCategory)(unit / MN);
+	int categoryNo = unit % MN;
+	const int* unitCells = &(geometry->categoriesCells[category][categoryNo * MN]);
+	int** cellsValuesCounters = getCellsValuesCountersByCategory(gameState, category);
+	int i = 0, value = 0;
+
+	for (i = 0; i < MN; i++) {
+		int cell = unitCells[i];
+		if (isCellEmpty(gameState, cell / MN, cell % MN)) {
+			value = getSingleLegalValueForCell(gameState, cell / MN, cell % MN);
+			if ((value != EMPTY_CELL_VALUE) &&
+				!placeAutofillSingle(gameState, queue, move, cell, value))
+				return false;
+		}
+	}
+
+	for (value = 1; value <= MN; value++) {
+		int numCells = 0, singleCell = 0;
+		if (cellsValuesCounters[categoryNo][value] != 0)
+			continue;
+
+		for (i = 0; (i < MN) && (numCells < 2); i++) {
+			int cell = unitCells[i];
+			if (isCellEmpty(gameState, cell / MN, cell % MN) &&
+				isValueLegalForCell(gameState, cell / MN, cell % MN, value)) {
+				numCells++;
+				singleCell = cell;
 			}
 		}
+
+		if ((numCells == 1) &&
+			!placeAutofillSingle(gameState, queue, move, singleCell, value))
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Place naked and hidden singles on the GameState's board until there are none left,
+ * documenting them in a Move struct. Rather than rescanning the whole board after each
+ * round, only the units queued as a single is placed are examined again.
+ * Every value placed is legal when placed, so no errors are introduced.
+ * 
+ * @param gameState 	[in, out] GameState whose board's cells are set
+ * @param move 			[in, out] Move to which the changes are added
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool placeSinglesUntilFixpoint(GameState* gameState, Move* move) {
+	AutofillUnitsQueue queue = {0};
+	bool success = true;
+
+	if (!createAutofillUnitsQueue(gameState, &queue))
+		return false;
+
+	while (success && (queue.numQueued > 0))
+		success = placeAutofillSinglesInUnit(gameState, &queue, move, dequeueAutofillUnit(&queue));
+
+	cleanupAutofillUnitsQueue(&queue);
+	return success;
+}
+
+bool autofill(GameState* gameState, AutofillMode mode, const Move** outMove) {
+	bool success = true;
+	Move* move = createMove();
+	if (move == NULL) {
+		return false;
 	}
-	/* we are done with this */
-	freeCellsLegalValuesForAllBoardCells(&(gameState->puzzle), cellsLegalValues);
 
+	if (mode == AUTOFILL_MODE_FIXPOINT)
+		success = placeSinglesUntilFixpoint(gameState, move);
+	else
+		success = findSingleLegalValues(gameState, move);
+
+	*outMove = NULL;
 	/* if move had any changes */
-	if (getMoveSize(move) > 0) {
+	if (success && (getMoveSize(move) > 0)) {
 		/* add move to move list */
-		if (!addNewMoveToList(&(gameState->moveList), move)) {
-			/* memory error, cleanup and return */
-			destroyMove(move);
-			return false;
+		if (addNewMoveToList(&(gameState->moveList), move)) {
+			/* perform all single cell moves on board, as copied to the move list. Cells set already are left as they are */
+			*outMove = getCurrentMove(&(gameState->moveList));
+			applyMoveToBoard(gameState, *outMove, false);
+			appendToGameJournal(gameState, JOURNAL_RECORD_TYPE_MOVE, *outMove);
+			return true;
 		}
-
-		/* perform all single cell moves on board */
-		applyMoveToBoard(gameState, move, false);
-		*outMove = move;
-	} else {
-		destroyMove(move);
-		*outMove = NULL;
+		success = false;
 	}
 
-	return true;
+	if (!success) {
+		/* memory error, clear the cells set already before returning */
+		applyMoveToBoard(gameState, move, true);
+	}
+	destroyMove(move);
+	return success;
 }
 
 char* getPuzzleAsString(State* state) {
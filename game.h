@@ -348,18 +348,34 @@ bool makeCellChangeMove(GameState* gameState, int value, int row, int col);
 bool makeMultiCellMove(GameState* gameState, Board* newBoard);
 
 /**
- * Autofills the GameState's board according to the instructions, that is: if a cell
+ * The modes in which autofill may be applied:
+ * - Single pass, in which the cells that have a single legal value on the board as it is
+ *   are set to it, all at once, as the instructions specify.
+ * - Fixpoint, in which naked singles (cells with a single legal value) and hidden singles
+ *   (values that only one cell of a row, column or block may take) are placed one after
+ *   the other, each on the board left by the previous ones, until there are none left.
+ */
+typedef enum {
+	AUTOFILL_MODE_SINGLE_PASS,
+	AUTOFILL_MODE_FIXPOINT
+} AutofillMode;
+
+/**
+ * Autofills the GameState's board in the provided mode. In single pass mode, if a cell
  * has only one legal value in the current game's setup, it is set to it, although it 
- * may be erroneous due to prior errors. The changes are reflected in the board and 
- * documented in the Move struct that is provided as output.
+ * may be erroneous due to prior errors. The legal values are derived from the counters
+ * of values in the rows, columns and blocks. The changes are reflected in the board and 
+ * documented in the Move struct that is provided as output, as a single move.
  * 
  * @param gameState 	[in, out] GameState to which autofill is applied
+ * @param mode 			[in] The mode in which autofill is applied
  * @param outMove 		[in, out] Pointer to be assigned with a pointed to the Move struct
- * 						produced according to the changes in the board
+ * 						produced according to the changes in the board, or NULL if the
+ * 						board has not changed
 * @return true 			iff the procedure was successful
  * @return false 		iff a memory error occurred
  */
-bool autofill(GameState* gameState, Move** outMove);
+bool autofill(GameState* gameState, AutofillMode mode, const Move** outMove);
 
 /**
  * Applies an Undo command to the provided GameState, based on its undo-redo list.
@@ -381,7 +397,8 @@ const Move* redoMove(GameState* gameState);
 
 /**
  * Applies a Reset command to the provided GameState, by undoing all moves in its undo-redo
- * list in order.
+ * list. Rather than undoing them in order, the board is set straight back to the board the
+ * GameState was created with, which is where undoing them all leads.
  * 
  * @param gameState 	[in, out] GameState to which Reset is applied
  * @return true 		iff the board has changed as a result
@@ -389,6 +406,37 @@ const Move* redoMove(GameState* gameState);
  */
 bool resetMoves(GameState* gameState);
 
+/**
+ * Starts journaling the provided GameState to a file: from then on, every move added to
+ * its undo-redo list, and every Undo, Redo and Reset, is appended to the file as it is
+ * made. The file starts with the board the GameState was created with, followed by the
+ * moves already in its undo-redo list, so that replaying it restores the GameState as
+ * it is now. The file is first written under a temporary name and synchronized to the
+ * storage device, and then renamed over its path, so any file in its path is atomically
+ * replaced only once the journal is complete. A journal the GameState had is closed.
+ * If a write to the journal fails later on, journaling stops.
+ * 
+ * @param gameState 	[in, out] GameState to be journaled
+ * @param filePath 		[in] Path to the journal file
+ * @return true 		iff the journal was written successfully
+ * @return false 		iff the file could not be written, or a memory error occurred
+ */
+bool startGameJournal(GameState* gameState, char* filePath);
+
+/**
+ * Creates a GameState by replaying a journal: the board the journaled GameState was
+ * created with is loaded from the journal, and the moves, Undos, Redos and Resets in it
+ * are then made in order, restoring its board and undo-redo list. A record cut short at
+ * the end of the journal, as may be left by a crash, is ignored. The journal is then
+ * rewritten without it, and the new GameState goes on journaling to it.
+ * 
+ * @param filePath 						[in] Path to the journal file
+ * @param mode 							[in] The mode of the game the GameState is created for
+ * @param gameStateOut 					[in, out] Pointer to be assigned with the new GameState
+ * @return LoadBoardFromFileErrorCode 	The error that has occurred, or 0 on success
+ */
+LoadBoardFromFileErrorCode createGameStateFromJournal(char* filePath, GameMode mode, GameState** gameStateOut);
+
 /**
  * Checks whether the GameState's board is successfully solved.
  * 
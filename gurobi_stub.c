@@ -0,0 +1,806 @@
+/**
+ * GUROBI_STUB Summary:
+ *
+ * A stand-in for the Gurobi library, implementing those of the GRB functions declared in
+ * gurobi_c.h which LP_solver.c calls, so that the linear programming code paths may be built,
+ * run and checked without Gurobi or its licence.
+ *
+ * The stub records its use: each environment loaded or freed and each model created or freed
+ * is reported on stderr, along with the number of environments and models created so far, so
+ * that the reports may be told apart by the commands issued between them. If the environment
+ * variable GRB_STUB_MODEL_DUMP names a file, every model optimized is appended to it in a
+ * textual form (the number of calls which added its constraints, its variables with their
+ * bounds, then its constraint matrix row by row), so that the models built by two versions of
+ * LP_solver.c may be compared.
+ *
+ * Models are "optimized" by a depth-first search for a point all of whose variables are either
+ * 0 or 1 and which satisfies all constraints and bounds. Such a point is an optimal solution of the ILP
+ * models of LP_solver.c, whose objective is constant, and a feasible (though generally not
+ * optimal) solution of its LP models. A model with no such point is reported infeasible.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gurobi_c.h"
+
+#define UNUSED(x) (void)(x)
+
+#define GRB_STUB_EPSILON (1e-9)
+
+#define GRB_STUB_MODEL_DUMP_ENVIRONMENT_VARIABLE ("GRB_STUB_MODEL_DUMP")
+
+#define GRB_STUB_VALUE_UNKNOWN (-1)
+
+struct _GRBenv {
+	int logToConsole;
+};
+
+/**
+ * _GRBmodel struct holds the variables of a model, its constraints in compressed sparse rows
+ * (the coefficients of constraint i being at indices constrsBegin[i] to constrsBegin[i + 1] - 1
+ * of constrsInd and constrsVal) along with the number of calls which added them, and the status
+ * and solution of its last optimization.
+ */
+struct _GRBmodel {
+	int numVars;
+	int varsCapacity;
+	double* obj;
+	double* lb;
+	double* ub;
+	char* vtype;
+
+	int numConstrs;
+	int constrsCapacity;
+	int* constrsBegin;
+	char* constrsSense;
+	double* constrsRhs;
+	int numNonZeros;
+	int nonZerosCapacity;
+	int* constrsInd;
+	double* constrsVal;
+	int numAddConstrsCalls;
+
+	int modelSense;
+	int status;
+	double* x;
+};
+
+/**
+ * GRBStubSearch struct holds the state of a search for a 0/1 point of a model: the value of
+ * each variable (0, 1 or GRB_STUB_VALUE_UNKNOWN), the constraints of each variable in
+ * compressed sparse rows, and per constraint the sum of the coefficients of the variables set
+ * to 1, the sums of the positive and the negative coefficients of the unknown variables, and
+ * the number of unknown variables with positive coefficients. The variables set to 0 while
+ * branching are stacked on the trail, to be made unknown again on backtracking.
+ */
+typedef struct {
+	const GRBmodel* model;
+	int* values;
+	int* varsBegin;
+	int* varsConstrs;
+	double* varsVal;
+	double* fixedSum;
+	double* positiveUnknownSum;
+	double* negativeUnknownSum;
+	int* numPositiveUnknowns;
+	int* trail;
+	int trailSize;
+} GRBStubSearch;
+
+int numGRBStubEnvironmentsLoaded = 0;
+int numGRBStubModelsCreated = 0;
+
+/**
+ * Grow an array so that it holds at least the requested number of items.
+ *
+ * @param arrayInOut 	[in, out] Pointer to the array, reassigned on success
+ * @param capacity 		[in] The number of items the array holds
+ * @param requested 	[in] The number of items requested
+ * @param itemSize 		[in] The size of an item
+ * @return true 		iff the array holds the requested number of items
+ * @return false 		iff a memory error occurred
+ */
+bool growGRBStubArray(void** arrayInOut, int capacity, int requested, size_t itemSize) {
+	void* array = NULL;
+
+	if (requested <= capacity)
+		return true;
+
+	array = realloc(*arrayInOut, requested * itemSize);
+	if (array == NULL)
+		return false;
+
+	*arrayInOut = array;
+	return true;
+}
+
+/**
+ * Make room in a model for more variables.
+ *
+ * @param model 	[in, out] The model
+ * @param numVars 	[in] The number of variables the model is to hold
+ * @return true 	iff there is room for the variables
+ * @return false 	iff a memory error occurred
+ */
+bool reserveGRBStubVars(GRBmodel* model, int numVars) {
+	int capacity = model->varsCapacity;
+
+	if (numVars <= capacity)
+		return true;
+	capacity = (numVars > 2 * capacity) ? numVars : 2 * capacity;
+
+	if (!growGRBStubArray((void**)&(model->obj), model->varsCapacity, capacity, sizeof(double)) ||
+		!growGRBStubArray((void**)&(model->lb), model->varsCapacity, capacity, sizeof(double)) ||
+		!growGRBStubArray((void**)&(model->ub), model->varsCapacity, capacity, sizeof(double)) ||
+		!growGRBStubArray((void**)&(model->vtype), model->varsCapacity, capacity, sizeof(char)))
+		return false;
+
+	model->varsCapacity = capacity;
+	return true;
+}
+
+/**
+ * Make room in a model for more constraints and coefficients.
+ *
+ * @param model 		[in, out] The model
+ * @param numConstrs 	[in] The number of constraints the model is to hold
+ * @param numNonZeros 	[in] The number of coefficients the model is to hold
+ * @return true 		iff there is room for the constraints and coefficients
+ * @return false 		iff a memory error occurred
+ */
+bool reserveGRBStubConstrs(GRBmodel* model, int numConstrs, int numNonZeros) {
+	if (numConstrs > model->constrsCapacity) {
+		int capacity = (numConstrs > 2 * model->constrsCapacity) ? numConstrs : 2 * model->constrsCapacity;
+		if (!growGRBStubArray((void**)&(model->constrsBegin), model->constrsCapacity + 1, capacity + 1, sizeof(int)) ||
+			!growGRBStubArray((void**)&(model->constrsSense), model->constrsCapacity, capacity, sizeof(char)) ||
+			!growGRBStubArray((void**)&(model->constrsRhs), model->constrsCapacity, capacity, sizeof(double)))
+			return false;
+		model->constrsCapacity = capacity;
+	}
+
+	if (numNonZeros > model->nonZerosCapacity) {
+		int capacity = (numNonZeros > 2 * model->nonZerosCapacity) ? numNonZeros : 2 * model->nonZerosCapacity;
+		if (!growGRBStubArray((void**)&(model->constrsInd), model->nonZerosCapacity, capacity, sizeof(int)) ||
+			!growGRBStubArray((void**)&(model->constrsVal), model->nonZerosCapacity, capacity, sizeof(double)))
+			return false;
+		model->nonZerosCapacity = capacity;
+	}
+
+	return true;
+}
+
+/**
+ * Discard the status and solution of a model's last optimization.
+ *
+ * @param model 	[in, out] The model
+ */
+void resetGRBStubModel(GRBmodel* model) {
+	model->status = GRB_LOADED;
+	free(model->x);
+	model->x = NULL;
+}
+
+int __stdcall GRBloadenv(GRBenv **envP, const char *logfilename) {
+	GRBenv* env = NULL;
+
+	UNUSED(logfilename);
+
+	if (envP == NULL)
+		return GRB_ERROR_NULL_ARGUMENT;
+
+	env = calloc(1, sizeof(GRBenv));
+	if (env == NULL)
+		return GRB_ERROR_OUT_OF_MEMORY;
+
+	env->logToConsole = 1;
+	numGRBStubEnvironmentsLoaded++;
+	fprintf(stderr, "GRB stub: GRBloadenv (environments loaded so far: %d)\n", numGRBStubEnvironmentsLoaded);
+
+	*envP = env;
+	return 0;
+}
+
+void __stdcall GRBfreeenv(GRBenv *env) {
+	if (env == NULL)
+		return;
+
+	fprintf(stderr, "GRB stub: GRBfreeenv (environments loaded so far: %d, models created so far: %d)\n", numGRBStubEnvironmentsLoaded, numGRBStubModelsCreated);
+	free(env);
+}
+
+int __stdcall GRBsetintparam(GRBenv *env, const char *paramname, int value) {
+	if ((env == NULL) || (paramname == NULL))
+		return GRB_ERROR_NULL_ARGUMENT;
+
+	if (strcmp(paramname, GRB_INT_PAR_LOGTOCONSOLE) != 0)
+		return GRB_ERROR_UNKNOWN_PARAMETER;
+
+	env->logToConsole = value;
+	return 0;
+}
+
+int __stdcall GRBnewmodel(GRBenv *env, GRBmodel **modelP, const char *Pname, int numvars,
+						  double *obj, double *lb, double *ub, char *vtype, char **varnames) {
+	GRBmodel* model = NULL;
+
+	UNUSED(Pname);
+	UNUSED(obj);
+	UNUSED(lb);
+	UNUSED(ub);
+	UNUSED(vtype);
+	UNUSED(varnames);
+
+	if ((env == NULL) || (modelP == NULL))
+		return GRB_ERROR_NULL_ARGUMENT;
+	if (numvars != 0)
+		return GRB_ERROR_NOT_SUPPORTED;
+
+	model = calloc(1, sizeof(GRBmodel));
+	if ((model == NULL) || !growGRBStubArray((void**)&(model->constrsBegin), 0, 1, sizeof(int))) {
+		free(model);
+		return GRB_ERROR_OUT_OF_MEMORY;
+	}
+
+	model->constrsBegin[0] = 0;
+	model->modelSense = 1;
+	model->status = GRB_LOADED;
+	numGRBStubModelsCreated++;
+	fprintf(stderr, "GRB stub: GRBnewmodel (models created so far: %d)\n", numGRBStubModelsCreated);
+
+	*modelP = model;
+	return 0;
+}
+
+int __stdcall GRBfreemodel(GRBmodel *model) {
+	if (model == NULL)
+		return 0;
+
+	fprintf(stderr, "GRB stub: GRBfreemodel\n");
+	free(model->obj);
+	free(model->lb);
+	free(model->ub);
+	free(model->vtype);
+	free(model->constrsBegin);
+	free(model->constrsSense);
+	free(model->constrsRhs);
+	free(model->constrsInd);
+	free(model->constrsVal);
+	free(model->x);
+	free(model);
+	return 0;
+}
+
+int __stdcall GRBaddvars(GRBmodel *model, int numvars, int numnz,
+						 int *vbeg, int *vind, double *vval,
+						 double *obj, double *lb, double *ub, char *vtype,
+						 char **varnames) {
+	int i = 0;
+
+	UNUSED(vbeg);
+	UNUSED(vind);
+	UNUSED(vval);
+	UNUSED(varnames);
+
+	if (model == NULL)
+		return GRB_ERROR_NULL_ARGUMENT;
+	if ((numvars < 0) || (numnz != 0))
+		return GRB_ERROR_NOT_SUPPORTED;
+	if (!reserveGRBStubVars(model, model->numVars + numvars))
+		return GRB_ERROR_OUT_OF_MEMORY;
+
+	for (i = 0; i < numvars; i++) {
+		model->obj[model->numVars + i] = (obj != NULL) ? obj[i] : 0.0;
+		model->lb[model->numVars + i] = (lb != NULL) ? lb[i] : 0.0;
+		model->ub[model->numVars + i] = (ub != NULL) ? ub[i] : GRB_INFINITY;
+		model->vtype[model->numVars + i] = (vtype != NULL) ? vtype[i] : GRB_CONTINUOUS;
+	}
+	model->numVars += numvars;
+
+	resetGRBStubModel(model);
+	return 0;
+}
+
+/**
+ * Append constraints, given in compressed sparse rows as GRBaddconstrs takes them, to a model.
+ *
+ * @param model 		[in, out] The model
+ * @param numconstrs 	[in] The number of constraints
+ * @param numnz 		[in] The number of coefficients of all constraints
+ * @param cbeg 			[in] The position in cind and cval of the first coefficient of each constraint
+ * @param cind 			[in] The indices of the variables of the coefficients
+ * @param cval 			[in] The coefficients
+ * @param sense 		[in] The sense of each constraint
+ * @param rhs 			[in] The right-hand side of each constraint
+ * @return int 			0 on success, or a GRB error code
+ */
+int appendGRBStubConstrs(GRBmodel* model, int numconstrs, int numnz, const int* cbeg, const int* cind, const double* cval, const char* sense, const double* rhs) {
+	int i = 0;
+
+	if (model == NULL)
+		return GRB_ERROR_NULL_ARGUMENT;
+	if ((numconstrs < 0) || (numnz < 0) || ((numconstrs > 0) && ((cbeg == NULL) || (sense == NULL) || (rhs == NULL))) ||
+		((numnz > 0) && ((cind == NULL) || (cval == NULL))))
+		return GRB_ERROR_INVALID_ARGUMENT;
+	for (i = 0; i < numconstrs; i++) {
+		int end = (i + 1 < numconstrs) ? cbeg[i + 1] : numnz;
+		if ((cbeg[i] < 0) || (cbeg[i] > end) || (end > numnz))
+			return GRB_ERROR_INVALID_ARGUMENT;
+		if ((sense[i] != GRB_LESS_EQUAL) && (sense[i] != GRB_GREATER_EQUAL) && (sense[i] != GRB_EQUAL))
+			return GRB_ERROR_INVALID_ARGUMENT;
+	}
+	for (i = 0; i < numnz; i++)
+		if ((cind[i] < 0) || (cind[i] >= model->numVars))
+			return GRB_ERROR_INDEX_OUT_OF_RANGE;
+	if (!reserveGRBStubConstrs(model, model->numConstrs + numconstrs, model->numNonZeros + numnz))
+		return GRB_ERROR_OUT_OF_MEMORY;
+
+	if (numnz > 0) {
+		memcpy(&(model->constrsInd[model->numNonZeros]), cind, numnz * sizeof(int));
+		memcpy(&(model->constrsVal[model->numNonZeros]), cval, numnz * sizeof(double));
+	}
+	for (i = 0; i < numconstrs; i++) {
+		int end = (i + 1 < numconstrs) ? cbeg[i + 1] : numnz;
+		model->constrsSense[model->numConstrs] = sense[i];
+		model->constrsRhs[model->numConstrs] = rhs[i];
+		model->numConstrs++;
+		model->constrsBegin[model->numConstrs] = model->numNonZeros + end;
+	}
+	model->numNonZeros += numnz;
+	model->numAddConstrsCalls++;
+
+	resetGRBStubModel(model);
+	return 0;
+}
+
+int __stdcall GRBaddconstr(GRBmodel *model, int numnz, int *cind, double *cval,
+						   char sense, double rhs, const char *constrname) {
+	int cbeg = 0;
+
+	UNUSED(constrname);
+
+	return appendGRBStubConstrs(model, 1, numnz, &cbeg, cind, cval, &sense, &rhs);
+}
+
+int __stdcall GRBaddconstrs(GRBmodel *model, int numconstrs, int numnz,
+							int *cbeg, int *cind, double *cval,
+							char *sense, double *rhs, char **constrnames) {
+	UNUSED(constrnames);
+
+	return appendGRBStubConstrs(model, numconstrs, numnz, cbeg, cind, cval, sense, rhs);
+}
+
+/**
+ * Mark the items whose indices are listed, in a freshly-allocated array.
+ *
+ * @param numItems 		[in] The number of items
+ * @param len 			[in] The number of indices listed
+ * @param ind 			[in] The indices listed
+ * @param isMarkedOut 	[out] Pointer to be assigned with the array of markers
+ * @return int 			0 on success, or a GRB error code
+ */
+int markGRBStubIndices(int numItems, int len, const int* ind, bool** isMarkedOut) {
+	bool* isMarked = NULL;
+	int i = 0;
+
+	if ((len < 0) || ((len > 0) && (ind == NULL)))
+		return GRB_ERROR_INVALID_ARGUMENT;
+	for (i = 0; i < len; i++)
+		if ((ind[i] < 0) || (ind[i] >= numItems))
+			return GRB_ERROR_INDEX_OUT_OF_RANGE;
+
+	isMarked = calloc(numItems + 1, sizeof(bool));
+	if (isMarked == NULL)
+		return GRB_ERROR_OUT_OF_MEMORY;
+
+	for (i = 0; i < len; i++)
+		isMarked[ind[i]] = true;
+
+	*isMarkedOut = isMarked;
+	return 0;
+}
+
+int __stdcall GRBdelconstrs(GRBmodel *model, int len, int *ind) {
+	bool* isDeleted = NULL;
+	int numConstrs = 0, numNonZeros = 0;
+	int error = 0, i = 0, k = 0;
+
+	if (model == NULL)
+		return GRB_ERROR_NULL_ARGUMENT;
+	error = markGRBStubIndices(model->numConstrs, len, ind, &isDeleted);
+	if (error)
+		return error;
+
+	for (i = 0; i < model->numConstrs; i++) {
+		int begin = model->constrsBegin[i], end = model->constrsBegin[i + 1];
+		if (isDeleted[i])
+			continue;
+		for (k = begin; k < end; k++) {
+			model->constrsInd[numNonZeros] = model->constrsInd[k];
+			model->constrsVal[numNonZeros] = model->constrsVal[k];
+			numNonZeros++;
+		}
+		model->constrsSense[numConstrs] = model->constrsSense[i];
+		model->constrsRhs[numConstrs] = model->constrsRhs[i];
+		numConstrs++;
+		model->constrsBegin[numConstrs] = numNonZeros;
+	}
+	model->numConstrs = numConstrs;
+	model->numNonZeros = numNonZeros;
+	if (numConstrs == 0)
+		model->numAddConstrsCalls = 0;
+
+	free(isDeleted);
+	resetGRBStubModel(model);
+	return 0;
+}
+
+int __stdcall GRBdelvars(GRBmodel *model, int len, int *ind) {
+	bool* isDeleted = NULL;
+	int* newIndices = NULL;
+	int numVars = 0, numNonZeros = 0;
+	int error = 0, i = 0, k = 0;
+
+	if (model == NULL)
+		return GRB_ERROR_NULL_ARGUMENT;
+	error = markGRBStubIndices(model->numVars, len, ind, &isDeleted);
+	if (error)
+		return error;
+	newIndices = calloc(model->numVars + 1, sizeof(int));
+	if (newIndices == NULL) {
+		free(isDeleted);
+		return GRB_ERROR_OUT_OF_MEMORY;
+	}
+
+	for (i = 0; i < model->numVars; i++) {
+		newIndices[i] = isDeleted[i] ? -1 : numVars;
+		if (isDeleted[i])
+			continue;
+		model->obj[numVars] = model->obj[i];
+		model->lb[numVars] = model->lb[i];
+		model->ub[numVars] = model->ub[i];
+		model->vtype[numVars] = model->vtype[i];
+		numVars++;
+	}
+	model->numVars = numVars;
+
+	for (i = 0; i < model->numConstrs; i++) {
+		int begin = model->constrsBegin[i], end = model->constrsBegin[i + 1];
+		model->constrsBegin[i] = numNonZeros;
+		for (k = begin; k < end; k++) {
+			if (newIndices[model->constrsInd[k]] < 0)
+				continue;
+			model->constrsInd[numNonZeros] = newIndices[model->constrsInd[k]];
+			model->constrsVal[numNonZeros] = model->constrsVal[k];
+			numNonZeros++;
+		}
+	}
+	model->constrsBegin[model->numConstrs] = numNonZeros;
+	model->numNonZeros = numNonZeros;
+
+	free(newIndices);
+	free(isDeleted);
+	resetGRBStubModel(model);
+	return 0;
+}
+
+int __stdcall GRBupdatemodel(GRBmodel *model) {
+	return (model == NULL) ? GRB_ERROR_NULL_ARGUMENT : 0;
+}
+
+int __stdcall GRBresetmodel(GRBmodel *model) {
+	if (model == NULL)
+		return GRB_ERROR_NULL_ARGUMENT;
+
+	resetGRBStubModel(model);
+	return 0;
+}
+
+int __stdcall GRBsetintattr(GRBmodel *model, const char *attrname, int newvalue) {
+	if ((model == NULL) || (attrname == NULL))
+		return GRB_ERROR_NULL_ARGUMENT;
+
+	if (strcmp(attrname, GRB_INT_ATTR_MODELSENSE) != 0)
+		return GRB_ERROR_UNKNOWN_ATTRIBUTE;
+
+	model->modelSense = newvalue;
+	return 0;
+}
+
+int __stdcall GRBgetintattr(GRBmodel *model, const char *attrname, int *valueP) {
+	if ((model == NULL) || (attrname == NULL) || (valueP == NULL))
+		return GRB_ERROR_NULL_ARGUMENT;
+
+	if (strcmp(attrname, GRB_INT_ATTR_NUMVARS) == 0)
+		*valueP = model->numVars;
+	else if (strcmp(attrname, GRB_INT_ATTR_NUMCONSTRS) == 0)
+		*valueP = model->numConstrs;
+	else if (strcmp(attrname, GRB_INT_ATTR_MODELSENSE) == 0)
+		*valueP = model->modelSense;
+	else if (strcmp(attrname, GRB_INT_ATTR_STATUS) == 0)
+		*valueP = model->status;
+	else
+		return GRB_ERROR_UNKNOWN_ATTRIBUTE;
+
+	return 0;
+}
+
+int __stdcall GRBgetdblattrarray(GRBmodel *model, const char *attrname,
+								 int first, int len, double *values) {
+	if ((model == NULL) || (attrname == NULL) || (values == NULL))
+		return GRB_ERROR_NULL_ARGUMENT;
+
+	if (strcmp(attrname, GRB_DBL_ATTR_X) != 0)
+		return GRB_ERROR_UNKNOWN_ATTRIBUTE;
+	if ((first < 0) || (len < 0) || (first + len > model->numVars))
+		return GRB_ERROR_INDEX_OUT_OF_RANGE;
+	if (model->x == NULL)
+		return GRB_ERROR_DATA_NOT_AVAILABLE;
+
+	memcpy(values, &(model->x[first]), len * sizeof(double));
+	return 0;
+}
+
+/**
+ * Append a model, in a textual form, to the file named by GRB_STUB_MODEL_DUMP_ENVIRONMENT_VARIABLE,
+ * if there is such a file.
+ *
+ * @param model 	[in] The model
+ */
+void dumpGRBStubModel(const GRBmodel* model) {
+	const char* filePath = getenv(GRB_STUB_MODEL_DUMP_ENVIRONMENT_VARIABLE);
+	FILE* file = NULL;
+	int i = 0, k = 0;
+
+	if ((filePath == NULL) || (filePath[0] == '\0'))
+		return;
+	file = fopen(filePath, "a");
+	if (file == NULL)
+		return;
+
+	fprintf(file, "model %d vars %d constrs %d nonzeros %d sense %d calls\n", model->numVars, model->numConstrs, model->numNonZeros, model->modelSense, model->numAddConstrsCalls);
+	for (i = 0; i < model->numVars; i++)
+		fprintf(file, "v %d %c %g [%g, %g]\n", i, model->vtype[i], model->obj[i], model->lb[i], model->ub[i]);
+	for (i = 0; i < model->numConstrs; i++) {
+		fprintf(file, "c %c %g", model->constrsSense[i], model->constrsRhs[i]);
+		for (k = model->constrsBegin[i]; k < model->constrsBegin[i + 1]; k++)
+			fprintf(file, " %g*%d", model->constrsVal[k], model->constrsInd[k]);
+		fprintf(file, "\n");
+	}
+
+	fclose(file);
+}
+
+/**
+ * Tell whether a constraint can still be satisfied, given the variables set so far.
+ *
+ * @param search 	[in] The search
+ * @param constr 	[in] The constraint
+ * @return true 	iff some assignment of the unknown variables satisfies the constraint
+ * @return false 	otherwise
+ */
+bool isGRBStubConstrSatisfiable(const GRBStubSearch* search, int constr) {
+	char sense = search->model->constrsSense[constr];
+	double rhs = search->model->constrsRhs[constr];
+	double minSum = search->fixedSum[constr] + search->negativeUnknownSum[constr];
+	double maxSum = search->fixedSum[constr] + search->positiveUnknownSum[constr];
+
+	if ((sense != GRB_GREATER_EQUAL) && (minSum > rhs + GRB_STUB_EPSILON))
+		return false;
+	if ((sense != GRB_LESS_EQUAL) && (maxSum < rhs - GRB_STUB_EPSILON))
+		return false;
+	return true;
+}
+
+/**
+ * Set an unknown variable, or make a variable unknown again, updating the sums of its constraints.
+ *
+ * @param search 	[in, out] The search
+ * @param var 		[in] The variable
+ * @param value 	[in] 0 or 1 to set the variable, GRB_STUB_VALUE_UNKNOWN to unset it
+ * @return true 	iff all the variable's constraints can still be satisfied
+ * @return false 	otherwise
+ */
+bool setGRBStubSearchValue(GRBStubSearch* search, int var, int value) {
+	bool isSatisfiable = true;
+	int isSetting = (value != GRB_STUB_VALUE_UNKNOWN) ? 1 : -1;
+	int setValue = (isSetting > 0) ? value : search->values[var];
+	int k = 0;
+
+	for (k = search->varsBegin[var]; k < search->varsBegin[var + 1]; k++) {
+		int constr = search->varsConstrs[k];
+		double coefficient = search->varsVal[k];
+		if (coefficient > 0) {
+			search->positiveUnknownSum[constr] -= isSetting * coefficient;
+			search->numPositiveUnknowns[constr] -= isSetting;
+		} else {
+			search->negativeUnknownSum[constr] -= isSetting * coefficient;
+		}
+		search->fixedSum[constr] += isSetting * setValue * coefficient;
+		if (!isGRBStubConstrSatisfiable(search, constr))
+			isSatisfiable = false;
+	}
+
+	search->values[var] = value;
+	return isSatisfiable;
+}
+
+/**
+ * Search for values of the unknown variables which satisfy all constraints. The search picks
+ * the unsatisfied lower-bounded constraint with the fewest unknown variables with positive
+ * coefficients, and tries setting each of them to 1 in turn (and to 0, once tried); once all
+ * lower bounds are met by the variables set to 1, the remaining variables are set to 0.
+ *
+ * @param search 	[in, out] The search. On success, all variables are set
+ * @return true 	iff such values were found
+ * @return false 	otherwise, in which case the variables are as they were
+ */
+bool searchGRBStubModel(GRBStubSearch* search) {
+	const GRBmodel* model = search->model;
+	int trailSize = search->trailSize;
+	int bestConstr = -1;
+	int constr = 0, k = 0, var = 0;
+	bool isFound = false;
+
+	for (constr = 0; constr < model->numConstrs; constr++) {
+		if ((model->constrsSense[constr] == GRB_LESS_EQUAL) ||
+			(search->fixedSum[constr] >= model->constrsRhs[constr] - GRB_STUB_EPSILON))
+			continue;
+		if ((bestConstr < 0) || (search->numPositiveUnknowns[constr] < search->numPositiveUnknowns[bestConstr]))
+			bestConstr = constr;
+	}
+
+	if (bestConstr < 0) {
+		for (constr = 0; constr < model->numConstrs; constr++)
+			if ((model->constrsSense[constr] != GRB_GREATER_EQUAL) &&
+				(search->fixedSum[constr] > model->constrsRhs[constr] + GRB_STUB_EPSILON))
+				return false;
+		for (var = 0; var < model->numVars; var++)
+			if (search->values[var] == GRB_STUB_VALUE_UNKNOWN)
+				setGRBStubSearchValue(search, var, 0);
+		return true;
+	}
+
+	for (k = model->constrsBegin[bestConstr]; k < model->constrsBegin[bestConstr + 1]; k++) {
+		bool isSatisfiable = false;
+		var = model->constrsInd[k];
+		if ((search->values[var] != GRB_STUB_VALUE_UNKNOWN) || (model->constrsVal[k] <= 0))
+			continue;
+
+		if (setGRBStubSearchValue(search, var, 1) && searchGRBStubModel(search)) {
+			isFound = true;
+			break;
+		}
+		setGRBStubSearchValue(search, var, GRB_STUB_VALUE_UNKNOWN);
+
+		isSatisfiable = setGRBStubSearchValue(search, var, 0);
+		search->trail[search->trailSize++] = var;
+		if (!isSatisfiable)
+			break;
+	}
+
+	if (!isFound)
+		while (search->trailSize > trailSize)
+			setGRBStubSearchValue(search, search->trail[--search->trailSize], GRB_STUB_VALUE_UNKNOWN);
+
+	return isFound;
+}
+
+/**
+ * Free the arrays of a search.
+ *
+ * @param search 	[in, out] The search
+ */
+void cleanupGRBStubSearch(GRBStubSearch* search) {
+	free(search->values);
+	free(search->varsBegin);
+	free(search->varsConstrs);
+	free(search->varsVal);
+	free(search->fixedSum);
+	free(search->positiveUnknownSum);
+	free(search->negativeUnknownSum);
+	free(search->numPositiveUnknowns);
+	free(search->trail);
+}
+
+/**
+ * Prepare a search of a model: all variables unknown, and the constraints of each variable
+ * listed.
+ *
+ * @param model 	[in] The model
+ * @param search 	[out] The search
+ * @return true 	iff the search was prepared
+ * @return false 	iff a memory error occurred
+ */
+bool initGRBStubSearch(const GRBmodel* model, GRBStubSearch* search) {
+	int numVars = model->numVars, numConstrs = model->numConstrs;
+	int var = 0, constr = 0, k = 0;
+
+	memset(search, 0, sizeof(GRBStubSearch));
+	search->model = model;
+	search->values = calloc(numVars + 1, sizeof(int));
+	search->varsBegin = calloc(numVars + 2, sizeof(int));
+	search->varsConstrs = calloc(model->numNonZeros + 1, sizeof(int));
+	search->varsVal = calloc(model->numNonZeros + 1, sizeof(double));
+	search->fixedSum = calloc(numConstrs + 1, sizeof(double));
+	search->positiveUnknownSum = calloc(numConstrs + 1, sizeof(double));
+	search->negativeUnknownSum = calloc(numConstrs + 1, sizeof(double));
+	search->numPositiveUnknowns = calloc(numConstrs + 1, sizeof(int));
+	search->trail = calloc(numVars + 1, sizeof(int));
+	if ((search->trail == NULL) || (search->values == NULL) || (search->varsBegin == NULL) || (search->varsConstrs == NULL) ||
+		(search->varsVal == NULL) || (search->fixedSum == NULL) || (search->positiveUnknownSum == NULL) ||
+		(search->negativeUnknownSum == NULL) || (search->numPositiveUnknowns == NULL)) {
+		cleanupGRBStubSearch(search);
+		return false;
+	}
+
+	for (var = 0; var < numVars; var++)
+		search->values[var] = GRB_STUB_VALUE_UNKNOWN;
+
+	for (k = 0; k < model->numNonZeros; k++)
+		search->varsBegin[model->constrsInd[k] + 2]++;
+	for (var = 0; var < numVars; var++)
+		search->varsBegin[var + 2] += search->varsBegin[var + 1];
+	for (constr = 0; constr < numConstrs; constr++)
+		for (k = model->constrsBegin[constr]; k < model->constrsBegin[constr + 1]; k++) {
+			int position = search->varsBegin[model->constrsInd[k] + 1]++;
+			double coefficient = model->constrsVal[k];
+			search->varsConstrs[position] = constr;
+			search->varsVal[position] = coefficient;
+			if (coefficient > 0) {
+				search->positiveUnknownSum[constr] += coefficient;
+				search->numPositiveUnknowns[constr]++;
+			} else {
+				search->negativeUnknownSum[constr] += coefficient;
+			}
+		}
+
+	return true;
+}
+
+int __stdcall GRBoptimize(GRBmodel *model) {
+	GRBStubSearch search;
+	bool isFeasible = true;
+	int constr = 0, var = 0;
+
+	if (model == NULL)
+		return GRB_ERROR_NULL_ARGUMENT;
+
+	dumpGRBStubModel(model);
+	resetGRBStubModel(model);
+
+	model->x = calloc(model->numVars + 1, sizeof(double));
+	if ((model->x == NULL) || !initGRBStubSearch(model, &search)) {
+		resetGRBStubModel(model);
+		return GRB_ERROR_OUT_OF_MEMORY;
+	}
+
+	for (constr = 0; constr < model->numConstrs; constr++)
+		if (!isGRBStubConstrSatisfiable(&search, constr))
+			isFeasible = false;
+	for (var = 0; var < model->numVars; var++) {
+		bool canBeZero = model->lb[var] <= GRB_STUB_EPSILON;
+		bool canBeOne = model->ub[var] >= 1.0 - GRB_STUB_EPSILON;
+		if (!canBeZero && !canBeOne)
+			isFeasible = false;
+		else if (!canBeZero)
+			isFeasible = setGRBStubSearchValue(&search, var, 1) && isFeasible;
+		else if (!canBeOne)
+			isFeasible = setGRBStubSearchValue(&search, var, 0) && isFeasible;
+	}
+
+	if (isFeasible && searchGRBStubModel(&search)) {
+		for (var = 0; var < model->numVars; var++)
+			model->x[var] = search.values[var];
+		model->status = GRB_OPTIMAL;
+	} else {
+		free(model->x);
+		model->x = NULL;
+		model->status = GRB_INFEASIBLE;
+	}
+
+	cleanupGRBStubSearch(&search);
+	return 0;
+}
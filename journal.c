@@ -0,0 +1,290 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "journal.h"
+
+#define ERROR_SUCCESS (0)
+
+#define JOURNAL_MARKER ("SDKJRNL2")
+#define JOURNAL_MARKER_LENGTH (8)
+#define JOURNAL_NUMBER_SIZE (4)
+#define JOURNAL_FIXEDNESS_SIZE (1)
+#define JOURNAL_RECORD_TYPE_SIZE (1)
+
+bool isJournalFile(char* filePath) {
+	char marker[JOURNAL_MARKER_LENGTH] = {0};
+	bool isJournal = false;
+	FILE* file = fopen(filePath, "rb");
+	if (file == NULL)
+		return false;
+
+	isJournal = (fread(marker, sizeof(char), JOURNAL_MARKER_LENGTH, file) == JOURNAL_MARKER_LENGTH) &&
+				(memcmp(marker, JOURNAL_MARKER, JOURNAL_MARKER_LENGTH) == 0);
+	fclose(file);
+	return isJournal;
+}
+
+/**
+ * Write a non-negative number to a journal as numBytes little-endian bytes, so that
+ * journals do not depend on the size or byte order of the platform's integers.
+ *
+ * @param journal 	[in, out] The journal to be written to
+ * @param number 	[in] The number to be written
+ * @param numBytes 	[in] The number of bytes the number is written in, at most JOURNAL_NUMBER_SIZE
+ * @return true 	iff the number was written successfully
+ * @return false 	iff a write error has occurred
+ */
+bool writeNumberToJournal(FILE* journal, unsigned long number, int numBytes) {
+	unsigned char bytes[JOURNAL_NUMBER_SIZE] = {0};
+	int i = 0;
+	for (i = 0; i < numBytes; i++) {
+		bytes[i] = (unsigned char)(number & 0xFF);
+		number >>= 8;
+	}
+	return fwrite(bytes, sizeof(unsigned char), numBytes, journal) == (size_t)numBytes;
+}
+
+/**
+ * Read a number from a journal, in which it is written as numBytes little-endian bytes.
+ *
+ * @param journal 	[in, out] The journal to be read from
+ * @param numBytes 	[in] The number of bytes the number is written in, at most JOURNAL_NUMBER_SIZE
+ * @param numberOut [in, out] Pointer to be assigned with the number read
+ * @return true 	iff the number was read successfully
+ * @return false 	iff the journal ended before it
+ */
+bool readNumberFromJournal(FILE* journal, int numBytes, int* numberOut) {
+	unsigned char bytes[JOURNAL_NUMBER_SIZE] = {0};
+	unsigned long number = 0;
+	int i = 0;
+	if (fread(bytes, sizeof(unsigned char), numBytes, journal) != (size_t)numBytes)
+		return false;
+	for (i = numBytes - 1; i >= 0; i--)
+		number = (number << 8) | bytes[i];
+	*numberOut = (int)number;
+	return true;
+}
+
+/**
+ * Write a board to a journal's header: its dimensions, then the value and isFixed marker of
+ * each of its cells, in row-major order.
+ *
+ * @param journal 	[in, out] The journal to be written to
+ * @param board 	[in] The board to be written
+ * @return true 	iff the board was written successfully
+ * @return false 	iff a write error has occurred
+ */
+bool writeBoardToJournal(FILE* journal, const Board* board) {
+	int MN2 = getBoardSize_MN2(board);
+	int index = 0;
+
+	if (!writeNumberToJournal(journal, board->numRowsInBlock_M, JOURNAL_NUMBER_SIZE) ||
+		!writeNumberToJournal(journal, board->numColumnsInBlock_N, JOURNAL_NUMBER_SIZE))
+		return false;
+
+	for (index = 0; index < MN2; index++) {
+		const Cell* cell = &(board->cells[index]);
+		if (!writeNumberToJournal(journal, getBoardCellValue(cell), JOURNAL_NUMBER_SIZE) ||
+			!writeNumberToJournal(journal, isBoardCellFixed(cell) ? 1 : 0, JOURNAL_FIXEDNESS_SIZE))
+			return false;
+	}
+
+	return true;
+}
+
+FILE* createJournal(char* filePath, const Board* board) {
+	FILE* journal = fopen(filePath, "wb");
+	if (journal == NULL)
+		return NULL;
+
+	if (fwrite(JOURNAL_MARKER, sizeof(char), JOURNAL_MARKER_LENGTH, journal) != JOURNAL_MARKER_LENGTH ||
+		!writeBoardToJournal(journal, board)) {
+		fclose(journal);
+		return NULL;
+	}
+
+	return journal;
+}
+
+bool writeMoveToJournal(FILE* journal, const Move* move) {
+	const CellChange* changes = getMoveCellChanges(move);
+	int numCellChanges = getMoveSize(move);
+	int i = 0;
+
+	if (!writeNumberToJournal(journal, JOURNAL_RECORD_TYPE_MOVE, JOURNAL_RECORD_TYPE_SIZE) ||
+		!writeNumberToJournal(journal, numCellChanges, JOURNAL_NUMBER_SIZE))
+		return false;
+
+	for (i = 0; i < numCellChanges; i++)
+		if (!writeNumberToJournal(journal, changes[i].row, JOURNAL_NUMBER_SIZE) ||
+			!writeNumberToJournal(journal, changes[i].col, JOURNAL_NUMBER_SIZE) ||
+			!writeNumberToJournal(journal, changes[i].prevVal, JOURNAL_NUMBER_SIZE) ||
+			!writeNumberToJournal(journal, changes[i].newVal, JOURNAL_NUMBER_SIZE))
+			return false;
+
+	return true;
+}
+
+bool writeRecordToJournal(FILE* journal, JournalRecordType type) {
+	return writeNumberToJournal(journal, type, JOURNAL_RECORD_TYPE_SIZE);
+}
+
+bool syncJournal(FILE* journal) {
+	return (fflush(journal) == 0) && (fsync(fileno(journal)) == 0);
+}
+
+bool appendMoveToJournal(FILE* journal, const Move* move) {
+	return writeMoveToJournal(journal, move) &&
+		   syncJournal(journal);
+}
+
+bool appendRecordToJournal(FILE* journal, JournalRecordType type) {
+	return writeRecordToJournal(journal, type) &&
+		   syncJournal(journal);
+}
+
+void closeJournal(FILE* journal) {
+	if (journal != NULL)
+		fclose(journal);
+}
+
+/**
+ * Read a board from a journal's header, as written by writeBoardToJournal.
+ *
+ * @param journal 						[in, out] The journal to be read from
+ * @param boardInOut 					[in, out] A pointer to a board to which the read board
+ * 										will be assigned, on success only
+ * @return LoadBoardFromFileErrorCode 	The error that has occurred, or 0 on success
+ */
+LoadBoardFromFileErrorCode readBoardFromJournal(FILE* journal, Board* boardInOut) {
+	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
+	Board tempBoard = {0};
+	int MN = 0, MN2 = 0, index = 0;
+
+	if (!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &(tempBoard.numRowsInBlock_M)) ||
+		!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &(tempBoard.numColumnsInBlock_N)))
+		return LOAD_BOARD_FROM_FILE_COULD_NOT_PARSE_BOARD_DIMENSIONS;
+	if (!((tempBoard.numRowsInBlock_M > 0) && (tempBoard.numColumnsInBlock_N > 0)))
+		return LOAD_BOARD_FROM_FILE_DIMENSION_ARE_NOT_POSITIVE;
+	if (!createEmptyBoard(&tempBoard))
+		return LOAD_BOARD_FROM_FILE_MEMORY_ALLOCATION_FAILURE;
+
+	MN = getBoardBlockSize_MN(&tempBoard);
+	MN2 = getBoardSize_MN2(&tempBoard);
+	for (index = 0; (index < MN2) && (retVal == ERROR_SUCCESS); index++) {
+		Cell* cell = &(tempBoard.cells[index]);
+		int value = 0;
+		int isFixed = 0;
+		if (!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &value) ||
+			!readNumberFromJournal(journal, JOURNAL_FIXEDNESS_SIZE, &isFixed)) {
+			retVal = LOAD_BOARD_FROM_FILE_BAD_FORMAT_FAILED_TO_READ_A_CELL;
+		} else if ((value != EMPTY_CELL_VALUE) && ((value < 1) || (value > MN))) {
+			retVal = LOAD_BOARD_FROM_FILE_CELL_VALUE_NOT_IN_RANGE;
+		} else {
+			setBoardCellValue(&tempBoard, index / MN, index % MN, value);
+			setBoardCellFixedness(cell, isFixed != 0);
+		}
+	}
+
+	if (retVal != ERROR_SUCCESS) {
+		cleanupBoard(&tempBoard);
+		return retVal;
+	}
+
+	*boardInOut = tempBoard;
+	return ERROR_SUCCESS;
+}
+
+LoadBoardFromFileErrorCode openJournal(char* filePath, FILE** journalOut, Board* boardInOut) {
+	LoadBoardFromFileErrorCode retVal = ERROR_SUCCESS;
+	char marker[JOURNAL_MARKER_LENGTH] = {0};
+	FILE* journal = fopen(filePath, "rb");
+	if (journal == NULL)
+		return LOAD_BOARD_FROM_FILE_FILE_COULD_NOT_BE_OPENED;
+
+	if (fread(marker, sizeof(char), JOURNAL_MARKER_LENGTH, journal) != JOURNAL_MARKER_LENGTH ||
+		memcmp(marker, JOURNAL_MARKER, JOURNAL_MARKER_LENGTH) != 0) {
+		retVal = LOAD_BOARD_FROM_FILE_COULD_NOT_PARSE_BOARD_DIMENSIONS;
+	} else {
+		retVal = readBoardFromJournal(journal, boardInOut);
+	}
+
+	if (retVal != ERROR_SUCCESS) {
+		fclose(journal);
+		return retVal;
+	}
+
+	*journalOut = journal;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * Read the CellChanges of a move record into a new Move struct. The record is rejected
+ * if any of its CellChanges lies outside the board or holds a value out of range.
+ *
+ * @param journal 						[in, out] The journal to be read from
+ * @param board 						[in] The board the journaled session is played on
+ * @param moveOut 						[in, out] Pointer to be assigned with the new Move
+ * @return ReadJournalRecordErrorCode 	The error that has occurred, or 0 on success
+ */
+ReadJournalRecordErrorCode readMoveFromJournal(FILE* journal, const Board* board, Move** moveOut) {
+	int MN = getBoardBlockSize_MN(board);
+	int numCellChanges = 0, i = 0;
+	Move* move = NULL;
+
+	if (!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &numCellChanges) ||
+		numCellChanges <= 0 || numCellChanges > getBoardSize_MN2(board))
+		return READ_JOURNAL_RECORD_NO_MORE_RECORDS;
+
+	move = createMove();
+	if (move == NULL || !reserveCellChangesInMove(move, numCellChanges)) {
+		destroyMove(move);
+		return READ_JOURNAL_RECORD_MEMORY_ALLOCATION_FAILURE;
+	}
+
+	for (i = 0; i < numCellChanges; i++) {
+		CellChange change = {0};
+		if (!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &(change.row)) ||
+			!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &(change.col)) ||
+			!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &(change.prevVal)) ||
+			!readNumberFromJournal(journal, JOURNAL_NUMBER_SIZE, &(change.newVal)) ||
+			change.row < 0 || change.row >= MN || change.col < 0 || change.col >= MN ||
+			change.prevVal < EMPTY_CELL_VALUE || change.prevVal > MN ||
+			change.newVal < EMPTY_CELL_VALUE || change.newVal > MN) {
+			destroyMove(move);
+			return READ_JOURNAL_RECORD_NO_MORE_RECORDS;
+		}
+		addCellChangeToMove(move, change.prevVal, change.newVal, change.row, change.col); /* Note: room was reserved, so this cannot fail */
+	}
+
+	*moveOut = move;
+	return ERROR_SUCCESS;
+}
+
+ReadJournalRecordErrorCode readJournalRecord(FILE* journal, const Board* board, JournalRecordType* typeOut, Move** moveOut) {
+	int typeNumber = 0;
+	if (!readNumberFromJournal(journal, JOURNAL_RECORD_TYPE_SIZE, &typeNumber))
+		return READ_JOURNAL_RECORD_NO_MORE_RECORDS;
+
+	switch ((JournalRecordType)typeNumber) {
+	case JOURNAL_RECORD_TYPE_MOVE:
+	{
+		ReadJournalRecordErrorCode retVal = readMoveFromJournal(journal, board, moveOut);
+		if (retVal != ERROR_SUCCESS)
+			return retVal;
+		break;
+	}
+	case JOURNAL_RECORD_TYPE_UNDO:
+	case JOURNAL_RECORD_TYPE_REDO:
+	case JOURNAL_RECORD_TYPE_RESET:
+		break;
+	default:
+		return READ_JOURNAL_RECORD_NO_MORE_RECORDS;
+	}
+
+	*typeOut = (JournalRecordType)typeNumber;
+	return ERROR_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/**
+ * The journal module keeps an append-only binary log of a sudoku game session in a file,
+ * so that the session may be restored after a crash without saving the whole board after
+ * every move.
+ * A journal starts with a header holding the board the session started from, and every
+ * change to the session's undo-redo list is then appended to it as a record of its own:
+ * a new move with its CellChanges, an Undo, a Redo or a Reset. Each record is synchronized
+ * to the storage device as soon as it is written (fsync), so that it survives a crash of the
+ * operating system or a power loss, not only one of the process, and appending one costs in
+ * proportion to the move, not the board.
+ * All numbers are written as fixed-width little-endian fields (4 bytes each, but for the
+ * 1 byte record types and isFixed markers), so a journal may be replayed on any platform.
+ * Replaying the records in order over the header's board restores the board and the
+ * list of moves the session had.
+ *
+ * isJournalFile - Checks whether a file is a journal.
+ * createJournal - Creates a journal file, starting from a provided board.
+ * writeMoveToJournal - Writes a new move record to a journal, without synchronizing it.
+ * writeRecordToJournal - Writes an Undo, Redo or Reset record to a journal, without synchronizing it.
+ * syncJournal - Synchronizes everything written to a journal to the storage device.
+ * appendMoveToJournal - Appends a new move record to a journal.
+ * appendRecordToJournal - Appends an Undo, Redo or Reset record to a journal.
+ * closeJournal - Closes a journal file.
+ * openJournal - Opens a journal file for replay and reads its header.
+ * readJournalRecord - Reads the next record of a journal opened for replay.
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "board.h"
+#include "move.h"
+
+/**
+ * The types of records a journal holds, one for each change to an undo-redo list.
+ */
+typedef enum {
+	JOURNAL_RECORD_TYPE_MOVE = 1,
+	JOURNAL_RECORD_TYPE_UNDO,
+	JOURNAL_RECORD_TYPE_REDO,
+	JOURNAL_RECORD_TYPE_RESET
+} JournalRecordType;
+
+/**
+ * Checks whether a file is a journal, by the marker its header starts with. Board files,
+ * which start with either the board's dimensions or the binary board file marker, never are.
+ *
+ * @param filePath 	[in] Path to the file to be examined
+ * @return true 	iff the file could be opened and is a journal
+ * @return false 	otherwise
+ */
+bool isJournalFile(char* filePath);
+
+/**
+ * Creates a journal file, overwriting any file in its path, and writes its header. The
+ * header is not synchronized to the storage device until syncJournal is called.
+ *
+ * @param filePath 	[in] Path to the file to be created
+ * @param board 	[in] The board the journaled session starts from
+ * @return FILE* 	The journal, open for appending records, or NULL if the file could not
+ * 					be created or written
+ */
+FILE* createJournal(char* filePath, const Board* board);
+
+/**
+ * Writes a record of a new move to a journal, without synchronizing it to the storage device,
+ * so that many records may be written before a single call to syncJournal.
+ *
+ * @param journal 	[in, out] The journal to be written to
+ * @param move 		[in] The move added to the undo-redo list
+ * @return true 	iff the record was written successfully
+ * @return false 	iff a write error has occurred
+ */
+bool writeMoveToJournal(FILE* journal, const Move* move);
+
+/**
+ * Writes a record of an Undo, a Redo or a Reset to a journal, without synchronizing it to
+ * the storage device.
+ *
+ * @param journal 	[in, out] The journal to be written to
+ * @param type 		[in] The type of the record, other than JOURNAL_RECORD_TYPE_MOVE
+ * @return true 	iff the record was written successfully
+ * @return false 	iff a write error has occurred
+ */
+bool writeRecordToJournal(FILE* journal, JournalRecordType type);
+
+/**
+ * Synchronizes everything written to a journal to the storage device (fsync), so that it
+ * survives a crash of the operating system or a power loss, and not only one of the process.
+ *
+ * @param journal 	[in, out] The journal to be synchronized
+ * @return true 	iff the journal was synchronized successfully
+ * @return false 	iff a write error has occurred
+ */
+bool syncJournal(FILE* journal);
+
+/**
+ * Appends a record of a new move to a journal, and synchronizes it to the storage device.
+ *
+ * @param journal 	[in, out] The journal to be appended to
+ * @param move 		[in] The move added to the undo-redo list
+ * @return true 	iff the record was written successfully
+ * @return false 	iff a write error has occurred
+ */
+bool appendMoveToJournal(FILE* journal, const Move* move);
+
+/**
+ * Appends a record of an Undo, a Redo or a Reset to a journal, and synchronizes it to the
+ * storage device.
+ *
+ * @param journal 	[in, out] The journal to be appended to
+ * @param type 		[in] The type of the record, other than JOURNAL_RECORD_TYPE_MOVE
+ * @return true 	iff the record was written successfully
+ * @return false 	iff a write error has occurred
+ */
+bool appendRecordToJournal(FILE* journal, JournalRecordType type);
+
+/**
+ * Closes a journal file.
+ *
+ * @param journal 	[in] The journal to be closed, or NULL
+ */
+void closeJournal(FILE* journal);
+
+/**
+ * Opens a journal file for replay, and reads the board in its header.
+ *
+ * @param filePath 						[in] Path to the journal
+ * @param journalOut 					[in, out] Pointer to be assigned with the journal, open
+ * 										at its first record
+ * @param boardInOut 					[in, out] A pointer to a board to which the board the
+ * 										journaled session started from will be assigned
+ * @return LoadBoardFromFileErrorCode 	The error that has occurred, or 0 on success. Both
+ * 										outputs are assigned on success only
+ */
+LoadBoardFromFileErrorCode openJournal(char* filePath, FILE** journalOut, Board* boardInOut);
+
+/**
+ * Errors that may occur while reading a record from a journal.
+ */
+typedef enum {
+	READ_JOURNAL_RECORD_NO_MORE_RECORDS = 1,
+	READ_JOURNAL_RECORD_MEMORY_ALLOCATION_FAILURE
+} ReadJournalRecordErrorCode;
+
+/**
+ * Reads the next record of a journal opened for replay. A record cut short, as the last
+ * one may be by a crash, or one that does not agree with the board's dimensions, ends the
+ * journal.
+ *
+ * @param journal 						[in, out] The journal to be read from
+ * @param board 						[in] The board the journaled session is played on
+ * @param typeOut 						[in, out] Pointer to be assigned with the record's type
+ * @param moveOut 						[in, out] Pointer to be assigned with a new Move, for a
+ * 										move record. It is then owned by the caller
+ * @return ReadJournalRecordErrorCode 	The error that has occurred, or 0 on success
+ */
+ReadJournalRecordErrorCode readJournalRecord(FILE* journal, const Board* board, JournalRecordType* typeOut, Move** moveOut);
+
+#endif /* JOURNAL_H */
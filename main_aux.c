@@ -6,6 +6,7 @@
 #include "main_aux.h"
 
 #include "commands.h"
+#include "LP_solver.h"
 
 #define INPUT_STRING_MAX_LENGTH (COMMAND_MAX_LENGTH + sizeof(COMMAND_END_MARKER) + 1) /* Note: One for COMMAND_END_MARKER, and one for the null terminator */
 
@@ -239,5 +240,9 @@ void runGame() {
 
 	cleanupGameState(state.gameState); state.gameState = NULL;
 
+	cleanupLinearProgramming();
+
+	cleanupBoardGeometries();
+
 	printString(EXIT_STR);
 }
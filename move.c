@@ -1,47 +1,55 @@
 #include "move.h"
 #include <stdlib.h>
 
+#define MOVE_INITIAL_CELL_CHANGES_CAPACITY (4)
+
 Move* createMove() {
     Move* move = (Move*) calloc(1, sizeof(Move));
 	if (move == NULL) { return NULL; }
 
-    initList(&(move->cellChanges));
     return move;
 }
 
 void destroyMove(Move* move) {
     if (move == NULL) { return; }
-    while (!isListEmpty(&(move->cellChanges))) {
-        CellChange* change = (CellChange*) popList(&(move->cellChanges));
-        free(change);
-    }
+    free(move->cellChanges);
     free(move);
 }
 
-CellChange* createCellChange(int prevVal, int newVal, int row, int col){
-    CellChange* change = (CellChange*) calloc(1, sizeof(CellChange));
-    if (change == NULL) { return NULL; }
+bool reserveCellChangesInMove(Move* move, int numCellChanges) {
+    int newCapacity = move->cellChangesCapacity > 0 ? move->cellChangesCapacity : MOVE_INITIAL_CELL_CHANGES_CAPACITY;
+    CellChange* newCellChanges = NULL;
+
+    if (numCellChanges <= move->cellChangesCapacity) { return true; }
+
+    while (newCapacity < numCellChanges) {
+        newCapacity *= 2;
+    }
+    newCellChanges = (CellChange*) realloc(move->cellChanges, newCapacity * sizeof(CellChange));
+    if (newCellChanges == NULL) { return false; }
+    move->cellChanges = newCellChanges;
+    move->cellChangesCapacity = newCapacity;
+    return true;
+}
+
+bool addCellChangeToMove(Move* move, int prevVal, int newVal, int row, int col) {
+    CellChange* change = NULL;
+
+    if (!reserveCellChangesInMove(move, move->numCellChanges + 1)) { return false; }
+
+    change = &(move->cellChanges[move->numCellChanges]);
     change->col = col;
     change->row = row;
     change->prevVal = prevVal;
     change->newVal = newVal;
-    return change;
-}
-
-bool addCellChangeToMove(Move* move, int prevVal, int newVal, int row, int col) {
-    CellChange* change = createCellChange(prevVal, newVal, row, col);
-    if (change == NULL) { return false; }
-    if (!pushList(&(move->cellChanges), change)) {
-        free(change);
-        return false;
-    }
+    move->numCellChanges++;
     return true;
 }
 
 int getMoveSize(const Move* move) {
-    return getListSize(&(move->cellChanges));
+    return move->numCellChanges;
 }
 
-const Node* getFirstCellChange(const Move* move) {
-    return getListHead(&(move->cellChanges));
+const CellChange* getMoveCellChanges(const Move* move) {
+    return move->cellChanges;
 }
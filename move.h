@@ -1,17 +1,17 @@
 #ifndef MOVE_H
 #define MOVE_H
 
-#include "linked_list.h"
+#include <stdbool.h>
 
 /**
  * The Move module is responsible for representing and updating moves in the undo-redo list.
  * 
  * createMove - Creates a new, initialized Move struct.
  * destroyMove - Destroys a Move struct by freeing all the memory allocated to it and its sub-structs.
- * createCellChange - Creates a new CellChange struct with provided parameters.
- * addCellChangeToMove - Adds a new CellChange to an existing Move struct, which consists of a list of CellChanges.
+ * reserveCellChangesInMove - Makes room for a number of CellChanges in a Move struct.
+ * addCellChangeToMove - Adds a new CellChange to an existing Move struct, which consists of an array of CellChanges.
  * getMoveSize - Get the number of CellChanges a particular Move struct contains. 
- * getFirstCellChange - Get the head of the list in a particular Move struct.
+ * getMoveCellChanges - Get the array of CellChanges in a particular Move struct.
  */
 
 /**
@@ -27,10 +27,12 @@ typedef struct {
 
 /**
  * Some commands cause extensive changes in the board at once. Thus each move is represented
- * by a list of CellChanges.  
+ * by an array of CellChanges, in the order they were added, which grows as needed.
  */
 typedef struct {
-	List cellChanges;
+	CellChange* cellChanges;
+	int numCellChanges;
+	int cellChangesCapacity;
 } Move;
 
 /**
@@ -48,19 +50,18 @@ Move* createMove();
 void destroyMove(Move* move);
 
 /**
- * Creates a new CellChange struct with provided parameters.
+ * Makes sure the Move struct's array has room for a provided number of CellChanges, so
+ * that adding up to that many does not allocate memory.
  * 
- * @param prevVal 		[in] The cell's value prior to the change
- * @param newVal 		[in] The cell's value after the change
- * @param row 			[in] The changed cell's row number
- * @param col 			[in] The changed cell's column number
- * @return CellChange* 	A pointer to the CellChange struct created, or NULL if there'd been
- * 						a memory error
+ * @param move 				[in, out] A pointer to the move struct whose array is grown
+ * @param numCellChanges 	[in] The number of CellChanges to make room for
+ * @return true 			iff the procedure was successful
+ * @return false 			iff there'd been a memory error
  */
-CellChange* createCellChange(int prevVal, int newVal, int row, int col);
+bool reserveCellChangesInMove(Move* move, int numCellChanges);
 
 /**
- * Adds a new CellChange to an existing Move struct, which consists of a list of CellChanges.
+ * Adds a new CellChange to an existing Move struct, which consists of an array of CellChanges.
  * 
  * @param move 		[in, out] A pointer to the move struct to which the new CellChange
  * 					will be added
@@ -77,15 +78,15 @@ bool addCellChangeToMove(Move* move, int prevVal, int newVal, int row, int col);
  * Get the number of CellChanges a particular Move struct contains.
  * 
  * @param move  [in] The Move struct to be examined.
- * @return int 	The number of elements in the CellChange list
+ * @return int 	The number of elements in the CellChange array
  */
 int getMoveSize(const Move* move);
 
 /**
- * Get the head of the list in a particular Move struct.
+ * Get the array of CellChanges in a particular Move struct, of getMoveSize elements.
  * 
- * @param move 				[in] The move struct to be examined
- * @return const Node* 		A read-only pointer to the first Node in the list
+ * @param move 					[in] The move struct to be examined
+ * @return const CellChange* 	A read-only pointer to the first CellChange in the array
  */
-const Node* getFirstCellChange(const Move* move);
+const CellChange* getMoveCellChanges(const Move* move);
 #endif /* MOVE_H */
@@ -0,0 +1,460 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include "parallel_solver.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define UNUSED(x) (void)(x)
+
+/**
+ * When expanding the search tree automatically, it is expanded until there are at least
+ * this many partial boards per thread, so that threads finishing early have work to steal.
+ */
+#define PARALLEL_SOLVER_NUM_TASKS_PER_THREAD (16)
+
+/**
+ * The maximal number of levels the search tree is expanded to automatically.
+ */
+#define PARALLEL_SOLVER_MAX_AUTO_SPLIT_DEPTH (8)
+
+/**
+ * The number of frontier boards at which the search tree is never expanded further,
+ * whatever the requested depth, to bound the memory the frontier takes. Expansion stops
+ * partway through a level once it is reached, so a frontier holds fewer than this many
+ * boards plus those of a single expansion.
+ */
+#define PARALLEL_SOLVER_MAX_NUM_TASKS (1 << 16)
+
+/**
+ * The ParallelSolverFrontier struct holds the partial boards at the frontier of the
+ * expanded search tree, along with the number of solutions met while expanding it,
+ * i.e. of boards which got full before reaching the frontier.
+ */
+typedef struct {
+	Board* boards;
+	int numBoards;
+	int capacity;
+	int numSolutionsAbove;
+} ParallelSolverFrontier;
+
+/**
+ * The ParallelSolverDeque struct is a thread's double-ended queue of tasks: the indices
+ * head to tail - 1 of frontier boards yet to be counted. The owning thread takes tasks
+ * from the tail, and other threads steal from the head.
+ */
+typedef struct {
+	pthread_mutex_t mutex;
+	int head;
+	int tail;
+} ParallelSolverDeque;
+
+/**
+ * The ParallelSolverShared struct holds what all threads of a count share: the frontier,
+ * the queues of all threads, the counter to count subtrees by, and the running sum of the
+ * counts, guarded by its own mutex, along with the number of solutions at which to stop.
+ */
+typedef struct {
+	const ParallelSolverFrontier* frontier;
+	ParallelSolverDeque* deques;
+	int numThreads;
+	SubtreeSolutionsCounter counter;
+	pthread_mutex_t sumMutex;
+	int sum;
+	int maxNumSolutions;
+} ParallelSolverShared;
+
+/**
+ * The ParallelSolverWorker struct holds the state of a single thread of a count: the index
+ * of its own queue, and whether all of its counts succeeded.
+ */
+typedef struct {
+	ParallelSolverShared* shared;
+	int index;
+	bool success;
+	pthread_t thread;
+	bool isThreadCreated;
+} ParallelSolverWorker;
+
+int getDefaultNumSolverThreads() {
+	long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (numProcessors < 1)
+		return 1;
+	if (numProcessors > PARALLEL_SOLVER_MAX_NUM_THREADS)
+		return PARALLEL_SOLVER_MAX_NUM_THREADS;
+	return (int)numProcessors;
+}
+
+/**
+ * Frees all memory allocated to the boards of a frontier.
+ *
+ * @param frontier 	[in, out] The frontier to be freed
+ */
+void cleanupParallelSolverFrontier(ParallelSolverFrontier* frontier) {
+	int i = 0;
+
+	if (frontier->boards != NULL) {
+		for (i = 0; i < frontier->numBoards; i++)
+			cleanupBoard(&(frontier->boards[i]));
+		free(frontier->boards);
+		frontier->boards = NULL;
+	}
+	frontier->numBoards = 0;
+	frontier->capacity = 0;
+}
+
+/**
+ * Grows a frontier, if it is full, so that there is room for another board.
+ *
+ * @param frontier 	[in, out] The frontier to be grown
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool reserveRoomInParallelSolverFrontier(ParallelSolverFrontier* frontier) {
+	if (frontier->numBoards == frontier->capacity) {
+		int newCapacity = (frontier->capacity > 0) ? frontier->capacity * 2 : 1;
+		Board* newBoards = realloc(frontier->boards, newCapacity * sizeof(Board));
+		if (newBoards == NULL)
+			return false;
+		frontier->boards = newBoards;
+		frontier->capacity = newCapacity;
+	}
+
+	return true;
+}
+
+/**
+ * Appends a copy of a board to a frontier, growing it as needed.
+ *
+ * @param frontier 	[in, out] The frontier to which the board is appended
+ * @param board 	[in] The board to be copied
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool appendBoardToParallelSolverFrontier(ParallelSolverFrontier* frontier, const Board* board) {
+	if (!reserveRoomInParallelSolverFrontier(frontier))
+		return false;
+
+	if (!copyBoard(board, &(frontier->boards[frontier->numBoards])))
+		return false;
+
+	frontier->numBoards++;
+	return true;
+}
+
+/**
+ * Moves a board to a frontier, growing it as needed. On success, the board's memory is
+ * owned by the frontier.
+ *
+ * @param frontier 	[in, out] The frontier to which the board is moved
+ * @param board 	[in] The board to be moved
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred, in which case the board is still owned by
+ * 					the caller
+ */
+bool moveBoardToParallelSolverFrontier(ParallelSolverFrontier* frontier, const Board* board) {
+	if (!reserveRoomInParallelSolverFrontier(frontier))
+		return false;
+
+	frontier->boards[frontier->numBoards] = *board;
+	frontier->numBoards++;
+	return true;
+}
+
+/**
+ * Expands a partial board by a single level: branches on its empty cell with the fewest
+ * legal values, appending a board per legal value to the next frontier. A full board is
+ * counted as a solution instead, and a board with an empty cell that has no legal values
+ * is dropped.
+ *
+ * @param board 		[in, out] The board to be expanded. It is restored before returning
+ * @param nextFrontier 	[in, out] The frontier to which the expanded boards are appended
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool expandParallelSolverBoard(Board* board, ParallelSolverFrontier* nextFrontier) {
+	CellLegalValues* cellsLegalValues = NULL;
+	int MN = getBoardBlockSize_MN(board);
+	int numWords = getNumCandidateSetWords(board);
+	int bestCell = -1;
+	int row = 0, col = 0, value = 0;
+	bool success = true;
+
+	if (!getSuperficiallyLegalValuesForAllBoardCells(board, &cellsLegalValues))
+		return false;
+
+	for (row = 0; row < MN; row++)
+		for (col = 0; col < MN; col++) {
+			int cell = row * MN + col;
+			if (isBoardCellEmpty(viewBoardCellByRow(board, row, col)) &&
+				((bestCell < 0) || (cellsLegalValues[cell].numLegalValues < cellsLegalValues[bestCell].numLegalValues)))
+				bestCell = cell;
+		}
+
+	if (bestCell < 0) {
+		/* no more empty cells, count as solved */
+		nextFrontier->numSolutionsAbove++;
+	} else {
+		row = bestCell / MN;
+		col = bestCell % MN;
+		for (value = getNextValueInCandidateSet(cellsLegalValues[bestCell].legalValues, numWords, EMPTY_CELL_VALUE);
+			 success && (value != EMPTY_CELL_VALUE);
+			 value = getNextValueInCandidateSet(cellsLegalValues[bestCell].legalValues, numWords, value)) {
+			setBoardCellValue(board, row, col, value);
+			success = appendBoardToParallelSolverFrontier(nextFrontier, board);
+		}
+		setBoardCellValue(board, row, col, EMPTY_CELL_VALUE);
+	}
+
+	freeCellsLegalValuesForAllBoardCells(board, cellsLegalValues);
+	return success;
+}
+
+/**
+ * Expands the search tree of a board until its frontier holds at least the requested
+ * number of partial boards, the requested depth is reached, or the tree is exhausted.
+ * Once expanding a level would take the frontier to PARALLEL_SOLVER_MAX_NUM_TASKS boards,
+ * the boards of the level yet to be expanded are kept in the frontier as they are.
+ *
+ * @param board 		[in] The board whose search tree is expanded
+ * @param minNumBoards 	[in] The number of frontier boards which suffices
+ * @param maxDepth 		[in] The maximal number of levels to expand
+ * @param frontierOut 	[in, out] The frontier to be created
+ * @return true 		iff the procedure was successful
+ * @return false 		iff a memory error occurred
+ */
+bool createParallelSolverFrontier(const Board* board, int minNumBoards, int maxDepth, ParallelSolverFrontier* frontierOut) {
+	ParallelSolverFrontier frontier = {0};
+	int depth = 0;
+
+	if (!appendBoardToParallelSolverFrontier(&frontier, board))
+		return false;
+
+	for (depth = 0; (depth < maxDepth) && (frontier.numBoards > 0) && (frontier.numBoards < minNumBoards); depth++) {
+		ParallelSolverFrontier nextFrontier = {0};
+		int i = 0;
+
+		int numExpanded = frontier.numBoards;
+
+		nextFrontier.numSolutionsAbove = frontier.numSolutionsAbove;
+		for (i = 0; i < frontier.numBoards; i++) {
+			if (nextFrontier.numBoards + (frontier.numBoards - i) >= PARALLEL_SOLVER_MAX_NUM_TASKS) {
+				numExpanded = i;
+				break;
+			}
+			if (!expandParallelSolverBoard(&(frontier.boards[i]), &nextFrontier)) {
+				cleanupParallelSolverFrontier(&nextFrontier);
+				cleanupParallelSolverFrontier(&frontier);
+				return false;
+			}
+		}
+
+		/* the boards left unexpanded are moved to the next frontier, so the current one only owns those expanded */
+		for (i = numExpanded; i < frontier.numBoards; i++)
+			if (!moveBoardToParallelSolverFrontier(&nextFrontier, &(frontier.boards[i])))
+				break;
+		if (i < frontier.numBoards) {
+			for (; i < frontier.numBoards; i++)
+				cleanupBoard(&(frontier.boards[i]));
+			frontier.numBoards = numExpanded;
+			cleanupParallelSolverFrontier(&nextFrontier);
+			cleanupParallelSolverFrontier(&frontier);
+			return false;
+		}
+		frontier.numBoards = numExpanded;
+
+		cleanupParallelSolverFrontier(&frontier);
+		frontier = nextFrontier;
+	}
+
+	*frontierOut = frontier;
+	return true;
+}
+
+/**
+ * Takes a task for a thread: from the tail of its own queue if it is not empty, and
+ * otherwise from the head of another thread's queue.
+ *
+ * @param shared 	[in] What the threads of the count share
+ * @param index 	[in] The index of the thread
+ * @param taskOut 	[in, out] A pointer to an integer to be assigned with the index of the
+ * 					frontier board to be counted
+ * @return true 	iff a task was taken
+ * @return false 	iff all queues are empty
+ */
+bool takeParallelSolverTask(ParallelSolverShared* shared, int index, int* taskOut) {
+	int i = 0;
+
+	for (i = 0; i < shared->numThreads; i++) {
+		ParallelSolverDeque* deque = &(shared->deques[(index + i) % shared->numThreads]);
+		bool isTaken = false;
+
+		pthread_mutex_lock(&(deque->mutex));
+		if (deque->head < deque->tail) {
+			*taskOut = (i == 0) ? --deque->tail : deque->head++;
+			isTaken = true;
+		}
+		pthread_mutex_unlock(&(deque->mutex));
+
+		if (isTaken)
+			return true;
+	}
+
+	return false;
+}
+
+/**
+ * Get the number of solutions a thread may still count before the limit of a count is
+ * reached.
+ *
+ * @param shared 	[in] What the threads of the count share
+ * @return int 		The number of solutions left to count, or 0 if the count has no limit
+ */
+int getParallelSolverRemainingNumSolutions(ParallelSolverShared* shared) {
+	int remaining = 0;
+
+	if (shared->maxNumSolutions <= 0)
+		return 0;
+
+	pthread_mutex_lock(&(shared->sumMutex));
+	remaining = shared->maxNumSolutions - shared->sum;
+	pthread_mutex_unlock(&(shared->sumMutex));
+
+	return remaining;
+}
+
+/**
+ * The routine of each thread of a count: counts the subtrees of tasks taken, until no
+ * tasks are left, the limit of the count is reached or a memory error occurs.
+ *
+ * @param arg 		[in, out] The thread's ParallelSolverWorker, cast to a void pointer
+ * @return void* 	NULL
+ */
+void* runParallelSolverWorker(void* arg) {
+	ParallelSolverWorker* worker = (ParallelSolverWorker*)arg;
+	ParallelSolverShared* shared = worker->shared;
+	int task = 0;
+
+	while (worker->success) {
+		int remaining = getParallelSolverRemainingNumSolutions(shared);
+		int numSolutions = 0;
+
+		if ((shared->maxNumSolutions > 0) && (remaining <= 0))
+			break; /* limit reached */
+
+		if (!takeParallelSolverTask(shared, worker->index, &task))
+			break;
+
+		if (!shared->counter(&(shared->frontier->boards[task]), remaining, &numSolutions)) {
+			worker->success = false;
+		} else {
+			pthread_mutex_lock(&(shared->sumMutex));
+			shared->sum += numSolutions;
+			pthread_mutex_unlock(&(shared->sumMutex));
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Counts the subtrees below a frontier on several threads, the calling thread included.
+ * If some threads cannot be created, the threads which were created share all the work.
+ * Once a limit is reached, threads take no more tasks; the sum may then exceed the limit,
+ * as threads counting concurrently may each reach it.
+ *
+ * @param frontier 			[in] The frontier whose subtrees are counted
+ * @param counter 			[in] Sequential counter for the subtrees
+ * @param numThreads 		[in] The number of threads to count on
+ * @param maxNumSolutions 	[in] The number of solutions at which counting stops, or 0
+ * 							to count all subtrees
+ * @param sumOut 			[in, out] A pointer to an integer to be assigned with the sum of
+ * 							the counts, the solutions met while expanding the frontier included
+ * @return true 			iff the procedure was successful
+ * @return false 			iff a memory error occurred
+ */
+bool countParallelSolverFrontier(const ParallelSolverFrontier* frontier, SubtreeSolutionsCounter counter, int numThreads, int maxNumSolutions, int* sumOut) {
+	ParallelSolverShared shared = {0};
+	ParallelSolverWorker* workers = NULL;
+	bool success = true;
+	int i = 0;
+
+	shared.frontier = frontier;
+	shared.numThreads = numThreads;
+	shared.counter = counter;
+	shared.sum = frontier->numSolutionsAbove;
+	shared.maxNumSolutions = maxNumSolutions;
+	shared.deques = calloc(numThreads, sizeof(ParallelSolverDeque));
+	workers = calloc(numThreads, sizeof(ParallelSolverWorker));
+	if ((shared.deques == NULL) || (workers == NULL)) {
+		free(shared.deques);
+		free(workers);
+		return false;
+	}
+
+	pthread_mutex_init(&(shared.sumMutex), NULL);
+	for (i = 0; i < numThreads; i++) {
+		pthread_mutex_init(&(shared.deques[i].mutex), NULL);
+		shared.deques[i].head = (int)(((long)frontier->numBoards * i) / numThreads);
+		shared.deques[i].tail = (int)(((long)frontier->numBoards * (i + 1)) / numThreads);
+		workers[i].shared = &shared;
+		workers[i].index = i;
+		workers[i].success = true;
+		workers[i].isThreadCreated = false;
+	}
+
+	for (i = 1; i < numThreads; i++)
+		workers[i].isThreadCreated = pthread_create(&(workers[i].thread), NULL, runParallelSolverWorker, &(workers[i])) == 0;
+	runParallelSolverWorker(&(workers[0]));
+
+	for (i = 1; i < numThreads; i++)
+		if (workers[i].isThreadCreated)
+			pthread_join(workers[i].thread, NULL);
+
+	for (i = 0; i < numThreads; i++) {
+		success = success && workers[i].success;
+		pthread_mutex_destroy(&(shared.deques[i].mutex));
+	}
+	pthread_mutex_destroy(&(shared.sumMutex));
+	*sumOut = shared.sum;
+
+	free(shared.deques);
+	free(workers);
+	return success;
+}
+
+bool calculateNumSolutionsInParallel(const Board* board, SubtreeSolutionsCounter counter, int numThreads, int splitDepth, int maxNumSolutions, int* numSolutions) {
+	ParallelSolverFrontier frontier = {0};
+	int minNumBoards = 0, maxDepth = 0;
+	int sum = 0;
+
+	if (numThreads <= 1)
+		return counter(board, maxNumSolutions, numSolutions);
+
+	if (numThreads > PARALLEL_SOLVER_MAX_NUM_THREADS)
+		numThreads = PARALLEL_SOLVER_MAX_NUM_THREADS;
+
+	if (splitDepth > 0) {
+		minNumBoards = PARALLEL_SOLVER_MAX_NUM_TASKS;
+		maxDepth = splitDepth;
+	} else {
+		minNumBoards = numThreads * PARALLEL_SOLVER_NUM_TASKS_PER_THREAD;
+		maxDepth = PARALLEL_SOLVER_MAX_AUTO_SPLIT_DEPTH;
+	}
+
+	if (!createParallelSolverFrontier(board, minNumBoards, maxDepth, &frontier))
+		return false;
+
+	if (!countParallelSolverFrontier(&frontier, counter, numThreads, maxNumSolutions, &sum)) {
+		cleanupParallelSolverFrontier(&frontier);
+		return false;
+	}
+
+	if ((maxNumSolutions > 0) && (sum > maxNumSolutions))
+		sum = maxNumSolutions;
+	*numSolutions = sum;
+	cleanupParallelSolverFrontier(&frontier);
+	return true;
+}
@@ -0,0 +1,64 @@
+#ifndef PARALLEL_SOLVER_H
+#define PARALLEL_SOLVER_H
+
+#include <stdbool.h>
+#include "board.h"
+
+/* This module is designed to calculate the number of solutions to a provided sudoku board
+on several threads. The search tree is first expanded, level after level, branching on the
+empty cell with the fewest legal values, until there are enough partial boards at its frontier
+to keep all threads busy. The subtrees below the frontier are then counted independently.
+Each thread starts with a share of the frontier in a double-ended queue of its own, and once
+its queue runs dry it steals work from the far ends of the other threads' queues. The totals
+of all threads are summed as they finish, so the result equals that of a sequential count.
+A count may be given a limit, at which threads stop taking tasks */
+
+/**
+ * The maximal number of threads a count may run on.
+ */
+#define PARALLEL_SOLVER_MAX_NUM_THREADS (256)
+
+/**
+ * Function pointer to a sequential counter of the solutions to a board, used to count
+ * each subtree below the frontier. It must be safe to call from several threads at once.
+ *
+ * @param board             [in] Board to calculate the number of solutions for
+ * @param maxNumSolutions   [in] The number of solutions at which the count may stop, or 0
+ *                          to exhaust the search
+ * @param numSolutions      [in, out] Pointer to an integer to be assigned with the result
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+typedef bool (*SubtreeSolutionsCounter)(const Board* board, int maxNumSolutions, int* numSolutions);
+
+/**
+ * Get the number of threads counts run on by default: the number of processors online.
+ *
+ * @return int      The default number of threads
+ */
+int getDefaultNumSolverThreads();
+
+/**
+ * Calculates the number of possible solutions to the provided sudoku board, counting
+ * subtrees of its search tree on several threads.
+ * pre-condition: the input board is not erroneous.
+ *
+ * @param board             [in] Board to calculate the number of solutions for
+ * @param counter           [in] Sequential counter for the subtrees below the frontier
+ * @param numThreads        [in] The number of threads to count on, the calling thread
+ *                          included. 1 counts sequentially, on the calling thread alone
+ * @param splitDepth        [in] The number of levels the search tree is expanded to
+ *                          before counting, or 0 to expand just enough to produce a few
+ *                          partial boards per thread. Either way, expansion stops early
+ *                          once the frontier grows too large
+ * @param maxNumSolutions   [in] The number of solutions at which counting stops, or 0
+ *                          to exhaust the search
+ * @param numSolutions      [in, out] Pointer to an integer to be assigned with the result:
+ *                          the number of solutions, or maxNumSolutions if there are at
+ *                          least as many
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error occurred
+ */
+bool calculateNumSolutionsInParallel(const Board* board, SubtreeSolutionsCounter counter, int numThreads, int splitDepth, int maxNumSolutions, int* numSolutions);
+
+#endif /* PARALLEL_SOLVER_H */
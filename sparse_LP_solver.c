@@ -0,0 +1,382 @@
+#include "sparse_LP_solver.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include <stdbool.h>
+
+/**
+ * The relative tolerance to which programs are solved: both the norm of the violation of the
+ * constraints and the gap between the objective and its bound must be within it (relative to
+ * the norm of rhs, and to the objective and the bound, respectively).
+ */
+#define SPARSE_LP_RELATIVE_TOLERANCE (1e-4)
+
+/**
+ * The number of iterations after which a program is given up on.
+ */
+#define SPARSE_LP_MAX_NUM_ITERATIONS (100000)
+
+/**
+ * The number of iterations between checks for termination and restarts.
+ */
+#define SPARSE_LP_CHECK_INTERVAL (64)
+
+/**
+ * The factor by which the step size of each variable (constraint) falls short of the inverse
+ * of the sum of the absolute values of its column (row) of A. Steps of exactly these inverses
+ * are the largest which diagonal preconditioning allows.
+ */
+#define SPARSE_LP_STEP_SIZE_FACTOR (0.99)
+
+/**
+ * The solver restarts once the residual of its iterate has fallen to this fraction of the
+ * residual at the last restart...
+ */
+#define SPARSE_LP_SUFFICIENT_RESTART_DECAY (0.2)
+
+/**
+ * ...or to this fraction, but has grown since the previous check...
+ */
+#define SPARSE_LP_NECESSARY_RESTART_DECAY (0.8)
+
+/**
+ * ...or once the iterations since the last restart make up this fraction of all iterations.
+ */
+#define SPARSE_LP_ARTIFICIAL_RESTART_FRACTION (0.36)
+
+/**
+ * The weight of the newly measured ratio between the dual and primal progress, when the primal
+ * weight is updated upon a restart (the old weight taking the rest).
+ */
+#define SPARSE_LP_PRIMAL_WEIGHT_SMOOTHING (0.5)
+
+/**
+ * The SparseLPSolverState struct holds the state of the solver, all arrays of which reside in a
+ * single memory allocation. An iteration applies the PDHG step to the current point (x, y),
+ * yielding (stepX, stepY), and then moves the current point to a weighted average of the
+ * reflected step, 2 * step - current, and the anchor point, the point of the last restart, whose
+ * weight decays as 1 / (k + 2) in the k-th iteration since then. A * x is kept for the current,
+ * step and anchor points alike, since it is linear in them. The primal and dual step sizes of the
+ * variables and constraints are divided and multiplied, respectively, by the primal weight.
+ * reducedCosts is scratch space for obj - A^T * y.
+ */
+typedef struct {
+	const SparseLinearProgram* program;
+	double* arena;
+	double* x;
+	double* stepX;
+	double* anchorX;
+	double* primalStepSizes;
+	double* reducedCosts;
+	double* y;
+	double* stepY;
+	double* anchorY;
+	double* dualStepSizes;
+	double* ax;
+	double* stepAx;
+	double* anchorAx;
+	double primalWeight;
+	double rhsNorm;
+	double leastBoxObjective;
+	int numIterationsSinceRestart;
+} SparseLPSolverState;
+
+/**
+ * Frees the memory of a solver state created by createSparseLPSolverState.
+ *
+ * @param state 	[in, out] The state to be freed
+ */
+void freeSparseLPSolverState(SparseLPSolverState* state) {
+	free(state->arena);
+	state->arena = NULL;
+}
+
+/**
+ * Creates the state of the solver for a program, starting from the point where each variable
+ * is at its lower bound and all dual values are zero.
+ *
+ * @param program 	[in] The program to be solved
+ * @param stateOut 	[in, out] The state to be filled
+ * @return true 	iff the procedure was successful
+ * @return false 	iff a memory error occurred
+ */
+bool createSparseLPSolverState(const SparseLinearProgram* program, SparseLPSolverState* stateOut) {
+	int n = program->numVars;
+	int m = program->numConstrs;
+	double objNorm = 0;
+	int i = 0, j = 0, k = 0;
+
+	stateOut->arena = calloc(5 * n + 7 * m + 1, sizeof(double));
+	if (stateOut->arena == NULL)
+		return false;
+
+	stateOut->program = program;
+	stateOut->x = stateOut->arena;
+	stateOut->stepX = stateOut->x + n;
+	stateOut->anchorX = stateOut->stepX + n;
+	stateOut->primalStepSizes = stateOut->anchorX + n;
+	stateOut->reducedCosts = stateOut->primalStepSizes + n;
+	stateOut->y = stateOut->reducedCosts + n;
+	stateOut->stepY = stateOut->y + m;
+	stateOut->anchorY = stateOut->stepY + m;
+	stateOut->dualStepSizes = stateOut->anchorY + m;
+	stateOut->ax = stateOut->dualStepSizes + m;
+	stateOut->stepAx = stateOut->ax + m;
+	stateOut->anchorAx = stateOut->stepAx + m;
+
+	stateOut->rhsNorm = 0;
+	stateOut->leastBoxObjective = 0;
+	stateOut->numIterationsSinceRestart = 0;
+
+	/* Note: the primal step sizes hold the sums of the columns until they are inverted */
+	for (i = 0; i < m; i++) {
+		double rowSum = 0;
+		for (k = program->beg[i]; k < program->beg[i + 1]; k++) {
+			rowSum += fabs(program->val[k]);
+			stateOut->primalStepSizes[program->ind[k]] += fabs(program->val[k]);
+		}
+		stateOut->dualStepSizes[i] = (rowSum > 0) ? SPARSE_LP_STEP_SIZE_FACTOR / rowSum : 1.0;
+		stateOut->rhsNorm += program->rhs[i] * program->rhs[i];
+	}
+	stateOut->rhsNorm = sqrt(stateOut->rhsNorm);
+
+	for (j = 0; j < n; j++) {
+		double columnSum = stateOut->primalStepSizes[j];
+		stateOut->primalStepSizes[j] = (columnSum > 0) ? SPARSE_LP_STEP_SIZE_FACTOR / columnSum : 1.0;
+		stateOut->x[j] = stateOut->anchorX[j] = program->lb[j];
+		stateOut->leastBoxObjective += program->obj[j] * ((program->obj[j] > 0) ? program->lb[j] : program->ub[j]);
+		objNorm += program->obj[j] * program->obj[j];
+	}
+	objNorm = sqrt(objNorm);
+
+	for (i = 0; i < m; i++) {
+		double sum = 0;
+		for (k = program->beg[i]; k < program->beg[i + 1]; k++)
+			sum += program->val[k] * stateOut->x[program->ind[k]];
+		stateOut->ax[i] = stateOut->anchorAx[i] = sum;
+	}
+
+	stateOut->primalWeight = ((objNorm > 0) && (stateOut->rhsNorm > 0)) ? objNorm / stateOut->rhsNorm : 1.0;
+
+	return true;
+}
+
+/**
+ * Computes the reduced costs of a dual point, obj - A^T * y, into state->reducedCosts.
+ *
+ * @param state 	[in, out] The solver state
+ * @param y 		[in] The dual point
+ */
+void computeSparseLPReducedCosts(SparseLPSolverState* state, const double* y) {
+	const SparseLinearProgram* program = state->program;
+	int i = 0, j = 0, k = 0;
+
+	for (j = 0; j < program->numVars; j++)
+		state->reducedCosts[j] = program->obj[j];
+
+	for (i = 0; i < program->numConstrs; i++)
+		for (k = program->beg[i]; k < program->beg[i + 1]; k++)
+			state->reducedCosts[program->ind[k]] -= program->val[k] * y[i];
+}
+
+/**
+ * Applies the PDHG step to the current point: a projected gradient step of the variables,
+ * followed by a step of the dual values along the violation of the constraints at the
+ * extrapolated point 2 * stepX - x.
+ *
+ * @param state 	[in, out] The solver state
+ */
+void takeSparseLPStep(SparseLPSolverState* state) {
+	const SparseLinearProgram* program = state->program;
+	int i = 0, j = 0, k = 0;
+
+	computeSparseLPReducedCosts(state, state->y);
+
+	for (j = 0; j < program->numVars; j++) {
+		double value = state->x[j] + state->primalStepSizes[j] / state->primalWeight * state->reducedCosts[j];
+		if (value < program->lb[j])
+			value = program->lb[j];
+		else if (value > program->ub[j])
+			value = program->ub[j];
+		state->stepX[j] = value;
+	}
+
+	for (i = 0; i < program->numConstrs; i++) {
+		double sum = 0;
+		for (k = program->beg[i]; k < program->beg[i + 1]; k++)
+			sum += program->val[k] * state->stepX[program->ind[k]];
+		state->stepAx[i] = sum;
+		state->stepY[i] = state->y[i] + state->dualStepSizes[i] * state->primalWeight * (2 * sum - state->ax[i] - program->rhs[i]);
+	}
+}
+
+/**
+ * Moves the current point to the average of the reflected step and the anchor point.
+ *
+ * @param state 	[in, out] The solver state
+ */
+void moveSparseLPToHalpernPoint(SparseLPSolverState* state) {
+	const SparseLinearProgram* program = state->program;
+	double stepWeight = (state->numIterationsSinceRestart + 1.0) / (state->numIterationsSinceRestart + 2.0);
+	int i = 0, j = 0;
+
+	for (j = 0; j < program->numVars; j++)
+		state->x[j] = stepWeight * (2 * state->stepX[j] - state->x[j]) + (1 - stepWeight) * state->anchorX[j];
+
+	for (i = 0; i < program->numConstrs; i++) {
+		state->y[i] = stepWeight * (2 * state->stepY[i] - state->y[i]) + (1 - stepWeight) * state->anchorY[i];
+		state->ax[i] = stepWeight * (2 * state->stepAx[i] - state->ax[i]) + (1 - stepWeight) * state->anchorAx[i];
+	}
+
+	state->numIterationsSinceRestart++;
+}
+
+/**
+ * Gets the norm of the difference between the current point and its step, each variable and
+ * constraint weighted by the inverse of its step size. It vanishes exactly at optimal points.
+ *
+ * @param state 	[in] The solver state
+ * @return double 	The norm
+ */
+double getSparseLPStepResidual(const SparseLPSolverState* state) {
+	const SparseLinearProgram* program = state->program;
+	double sum = 0;
+	int i = 0, j = 0;
+
+	for (j = 0; j < program->numVars; j++) {
+		double difference = state->x[j] - state->stepX[j];
+		sum += state->primalWeight * difference * difference / state->primalStepSizes[j];
+	}
+
+	for (i = 0; i < program->numConstrs; i++) {
+		double difference = state->y[i] - state->stepY[i];
+		sum += difference * difference / (state->primalWeight * state->dualStepSizes[i]);
+	}
+
+	return sqrt(sum);
+}
+
+/**
+ * Restarts the solver from the step of the current point, which becomes the new anchor point,
+ * and updates the primal weight according to the distances the variables and the dual values
+ * have moved since the last restart.
+ *
+ * @param state 	[in, out] The solver state
+ */
+void restartSparseLPSolver(SparseLPSolverState* state) {
+	const SparseLinearProgram* program = state->program;
+	double primalDistance = 0, dualDistance = 0;
+	int i = 0, j = 0;
+
+	for (j = 0; j < program->numVars; j++) {
+		double difference = state->stepX[j] - state->anchorX[j];
+		primalDistance += difference * difference;
+		state->x[j] = state->anchorX[j] = state->stepX[j];
+	}
+
+	for (i = 0; i < program->numConstrs; i++) {
+		double difference = state->stepY[i] - state->anchorY[i];
+		dualDistance += difference * difference;
+		state->y[i] = state->anchorY[i] = state->stepY[i];
+		state->ax[i] = state->anchorAx[i] = state->stepAx[i];
+	}
+
+	if ((primalDistance > 0) && (dualDistance > 0))
+		state->primalWeight = exp(SPARSE_LP_PRIMAL_WEIGHT_SMOOTHING * log(sqrt(dualDistance / primalDistance)) +
+								  (1 - SPARSE_LP_PRIMAL_WEIGHT_SMOOTHING) * log(state->primalWeight));
+
+	state->numIterationsSinceRestart = 0;
+}
+
+/**
+ * Checks whether the step of the current point is an optimal solution (within tolerance), or
+ * proves the program infeasible.
+ *
+ * @param state 								[in, out] The solver state
+ * @return SolveSparseLinearProgramErrorCode 	SOLVE_SPARSE_LINEAR_PROGRAM_SUCCESS if the step is an
+ * 												optimal solution, SOLVE_SPARSE_LINEAR_PROGRAM_INFEASIBLE
+ * 												if the program is infeasible, or
+ * 												SOLVE_SPARSE_LINEAR_PROGRAM_ITERATION_LIMIT_REACHED if
+ * 												neither is known yet
+ */
+SolveSparseLinearProgramErrorCode checkSparseLPStep(SparseLPSolverState* state) {
+	const SparseLinearProgram* program = state->program;
+	double violation = 0, objective = 0, bound = 0;
+	int i = 0, j = 0;
+
+	computeSparseLPReducedCosts(state, state->stepY);
+
+	for (i = 0; i < program->numConstrs; i++) {
+		double difference = state->stepAx[i] - program->rhs[i];
+		violation += difference * difference;
+		bound += program->rhs[i] * state->stepY[i];
+	}
+	violation = sqrt(violation);
+
+	for (j = 0; j < program->numVars; j++) {
+		double reducedCost = state->reducedCosts[j];
+		objective += program->obj[j] * state->stepX[j];
+		bound += reducedCost * ((reducedCost > 0) ? program->ub[j] : program->lb[j]);
+	}
+
+	if (bound < state->leastBoxObjective - SPARSE_LP_RELATIVE_TOLERANCE * (1 + fabs(state->leastBoxObjective)))
+		return SOLVE_SPARSE_LINEAR_PROGRAM_INFEASIBLE;
+
+	if ((violation <= SPARSE_LP_RELATIVE_TOLERANCE * (1 + state->rhsNorm)) &&
+		(fabs(bound - objective) <= SPARSE_LP_RELATIVE_TOLERANCE * (1 + fabs(bound) + fabs(objective))))
+		return SOLVE_SPARSE_LINEAR_PROGRAM_SUCCESS;
+
+	return SOLVE_SPARSE_LINEAR_PROGRAM_ITERATION_LIMIT_REACHED;
+}
+
+SolveSparseLinearProgramErrorCode solveSparseLinearProgram(const SparseLinearProgram* program, double* solutionOut, SparseLinearProgramStatistics* statisticsOut) {
+	SolveSparseLinearProgramErrorCode retVal = SOLVE_SPARSE_LINEAR_PROGRAM_ITERATION_LIMIT_REACHED;
+
+	SparseLPSolverState state = {0};
+	double restartResidual = -1, previousResidual = HUGE_VAL;
+	int iteration = 0, numRestarts = 0, j = 0;
+
+	if (!createSparseLPSolverState(program, &state))
+		return SOLVE_SPARSE_LINEAR_PROGRAM_MEMORY_ALLOCATION_FAILURE;
+
+	for (iteration = 0; iteration < SPARSE_LP_MAX_NUM_ITERATIONS; iteration++) {
+		takeSparseLPStep(&state);
+
+		if ((iteration + 1) % SPARSE_LP_CHECK_INTERVAL == 0) {
+			double residual = 0;
+
+			retVal = checkSparseLPStep(&state);
+			if (retVal != SOLVE_SPARSE_LINEAR_PROGRAM_ITERATION_LIMIT_REACHED)
+				break;
+
+			residual = getSparseLPStepResidual(&state);
+			if (restartResidual < 0)
+				restartResidual = residual;
+			if ((residual <= SPARSE_LP_SUFFICIENT_RESTART_DECAY * restartResidual) ||
+				((residual <= SPARSE_LP_NECESSARY_RESTART_DECAY * restartResidual) && (residual > previousResidual)) ||
+				(state.numIterationsSinceRestart >= SPARSE_LP_ARTIFICIAL_RESTART_FRACTION * iteration)) {
+				restartSparseLPSolver(&state);
+				restartResidual = residual;
+				previousResidual = HUGE_VAL;
+				numRestarts++;
+				continue;
+			}
+			previousResidual = residual;
+		}
+
+		moveSparseLPToHalpernPoint(&state);
+	}
+
+	if (retVal == SOLVE_SPARSE_LINEAR_PROGRAM_SUCCESS)
+		for (j = 0; j < program->numVars; j++)
+			solutionOut[j] = state.stepX[j];
+
+	if (statisticsOut != NULL) {
+		statisticsOut->numIterations = (iteration < SPARSE_LP_MAX_NUM_ITERATIONS) ? iteration + 1 : iteration;
+		statisticsOut->numRestarts = numRestarts;
+	}
+
+	freeSparseLPSolverState(&state);
+
+	return retVal;
+}
@@ -0,0 +1,68 @@
+#ifndef SPARSE_LP_SOLVER_H
+#define SPARSE_LP_SOLVER_H
+
+/* This module is designed to solve linear programs of the form
+		maximize obj * x  subject to  A * x = rhs  and  lb <= x <= ub
+where A is a sparse matrix given in compressed sparse rows and all bounds are finite, as the
+LP models of sudoku boards are, without any external library. It employs a first-order method,
+the primal-dual hybrid gradient method, with diagonal preconditioning, reflected Halpern
+iterations and adaptive restarts (as the PDLP family of solvers does). Each iteration takes two
+passes over the nonzeros of A and a few over the variables and constraints, and all the memory
+it needs is allocated before the first one, so no memory is allocated or freed while iterating.
+Since all bounds are finite, every dual point yields an upper bound on the objective: a program
+is solved once its constraints are met and its objective is within a relative tolerance of such
+a bound, and is proven infeasible once such a bound falls below the least value the objective
+takes within the bounds */
+
+/**
+ * SparseLinearProgram struct holds a linear program, whose constraint matrix is in compressed
+ * sparse rows: the indices and coefficients of the variables of constraint i are at positions
+ * beg[i] to beg[i + 1] - 1 of ind and val (beg having numConstrs + 1 entries). The objective
+ * coefficients and the bounds of variable j are obj[j], lb[j] and ub[j], where lb[j] <= ub[j],
+ * and the right-hand side of constraint i is rhs[i].
+ */
+typedef struct {
+	int numVars;
+	int numConstrs;
+	const int* beg;
+	const int* ind;
+	const double* val;
+	const double* rhs;
+	const double* obj;
+	const double* lb;
+	const double* ub;
+} SparseLinearProgram;
+
+/**
+ * SparseLinearProgramStatistics struct holds figures gathered while solving: the number of
+ * iterations taken, and the number of restarts among them.
+ */
+typedef struct {
+	int numIterations;
+	int numRestarts;
+} SparseLinearProgramStatistics;
+
+/**
+ * Errors that may occur while solving a sparse linear program.
+ */
+typedef enum {
+	SOLVE_SPARSE_LINEAR_PROGRAM_SUCCESS,
+	SOLVE_SPARSE_LINEAR_PROGRAM_MEMORY_ALLOCATION_FAILURE,
+	SOLVE_SPARSE_LINEAR_PROGRAM_INFEASIBLE,
+	SOLVE_SPARSE_LINEAR_PROGRAM_ITERATION_LIMIT_REACHED
+} SolveSparseLinearProgramErrorCode;
+
+/**
+ * Solves a sparse linear program.
+ *
+ * @param program 								[in] The program to be solved
+ * @param solutionOut 							[in, out] An array of program->numVars doubles, to be
+ * 												assigned with an optimal solution on success
+ * @param statisticsOut 						[in, out] Pointer to a SparseLinearProgramStatistics
+ * 												struct to be filled with the solver's statistics, or NULL
+ * @return SolveSparseLinearProgramErrorCode 	SOLVE_SPARSE_LINEAR_PROGRAM_SUCCESS if the program was
+ * 												solved, or else the error that has occurred
+ */
+SolveSparseLinearProgramErrorCode solveSparseLinearProgram(const SparseLinearProgram* program, double* solutionOut, SparseLinearProgramStatistics* statisticsOut);
+
+#endif /* SPARSE_LP_SOLVER_H */
@@ -1,30 +1,363 @@
 #include <stdlib.h>
+#include <string.h>
 
 #include "undo_redo_list.h"
 
-void initUndoRedo(UndoRedoList* moveList) {
+#define UNDO_REDO_LIST_INITIAL_NUM_BYTES (256)
+#define UNDO_REDO_LIST_INITIAL_NUM_MOVES (16)
+
+/**
+ * The number of bits of a varint byte that carry the encoded number. The remaining
+ * bit is set iff more bytes follow.
+ */
+#define VARINT_NUM_PAYLOAD_BITS (7)
+#define VARINT_PAYLOAD_MASK (0x7F)
+#define VARINT_CONTINUATION_BIT (0x80)
+
+void initUndoRedo(UndoRedoList* moveList, int numColumns) {
     if (moveList != NULL) {
-        initList(&(moveList->list));
-        moveList->current = getListHead(&(moveList->list));
+        moveList->bytes = NULL;
+        moveList->numBytes = 0;
+        moveList->bytesCapacity = 0;
+        moveList->movesEnds = NULL;
+        moveList->numMoves = 0;
+        moveList->movesCapacity = 0;
         moveList->numUndos = 0;
+        moveList->hasCheckpoint = false;
+        moveList->numColumns = numColumns;
+        moveList->memoryBudget = UNDO_REDO_LIST_MEMORY_BUDGET;
+        moveList->decodedMove.cellChanges = NULL;
+        moveList->decodedMove.numCellChanges = 0;
+        moveList->decodedMove.cellChangesCapacity = 0;
     }
 }
 
-/* returns false upon memory allocation error in pushList */
-bool addNewMoveToList(UndoRedoList* moveList, Move* newMove) {
-    while (canRedo(moveList)) { 
-        Move* move = (Move*)popList(&(moveList->list));
-        destroyMove(move);
-        moveList->numUndos--;
+/**
+ * Get the number of bytes a number takes as a varint.
+ *
+ * @param number        [in] The number to be encoded
+ * @return size_t       The number of bytes it takes
+ */
+size_t getVarintSize(unsigned long number) {
+    size_t size = 1;
+    while (number > VARINT_PAYLOAD_MASK) {
+        number >>= VARINT_NUM_PAYLOAD_BITS;
+        size++;
+    }
+    return size;
+}
+
+/**
+ * Encode a number as a varint: seven bits per byte, least significant first.
+ *
+ * @param out           [in, out] Pointer to the buffer the varint is written to
+ * @param number        [in] The number to be encoded
+ * @return size_t       The number of bytes written
+ */
+size_t encodeVarint(unsigned char* out, unsigned long number) {
+    size_t size = 0;
+    while (number > VARINT_PAYLOAD_MASK) {
+        out[size++] = (unsigned char)((number & VARINT_PAYLOAD_MASK) | VARINT_CONTINUATION_BIT);
+        number >>= VARINT_NUM_PAYLOAD_BITS;
+    }
+    out[size++] = (unsigned char)number;
+    return size;
+}
+
+/**
+ * Decode a varint written by encodeVarint.
+ *
+ * @param in            [in] Pointer to the first byte of the varint
+ * @param numberOut     [in, out] Pointer to be assigned with the decoded number
+ * @return size_t       The number of bytes read
+ */
+size_t decodeVarint(const unsigned char* in, unsigned long* numberOut) {
+    unsigned long number = 0;
+    size_t size = 0;
+    int shift = 0;
+    do {
+        number |= ((unsigned long)(in[size] & VARINT_PAYLOAD_MASK)) << shift;
+        shift += VARINT_NUM_PAYLOAD_BITS;
+    } while (in[size++] & VARINT_CONTINUATION_BIT);
+    *numberOut = number;
+    return size;
+}
+
+/**
+ * Map a signed difference between cell indices to an unsigned number, small differences
+ * of either sign to small numbers, so that they take few varint bytes.
+ *
+ * @param difference        [in] The difference to be mapped
+ * @return unsigned long    The mapped number
+ */
+unsigned long zigzagEncode(long difference) {
+    return difference >= 0 ? 2 * (unsigned long)difference : 2 * (unsigned long)(-difference) - 1;
+}
+
+/**
+ * Map a number produced by zigzagEncode back to the difference it was produced from.
+ *
+ * @param number        [in] The number to be mapped back
+ * @return long         The difference
+ */
+long zigzagDecode(unsigned long number) {
+    return (number & 1) ? -(long)((number + 1) / 2) : (long)(number / 2);
+}
+
+/**
+ * Compress an array of CellChanges as a move is stored in the list, or only measure it.
+ *
+ * @param moveList          [in] The move list the changes are compressed for
+ * @param changes           [in] The array of CellChanges to compress
+ * @param numCellChanges    [in] The number of CellChanges in the array
+ * @param out               [in, out] Pointer to the buffer the changes are written to, or
+ *                          NULL to only measure them
+ * @return size_t           The number of bytes the compressed changes take
+ */
+size_t encodeCellChanges(const UndoRedoList* moveList, const CellChange* changes, int numCellChanges, unsigned char* out) {
+    size_t size = 0;
+    long prevCell = 0;
+    int i = 0;
+
+    for (i = 0; i < numCellChanges; i++) {
+        long cell = (long)changes[i].row * moveList->numColumns + changes[i].col;
+        unsigned long cellDifference = zigzagEncode(cell - prevCell);
+        if (out == NULL) {
+            size += getVarintSize(cellDifference);
+            size += getVarintSize((unsigned long)changes[i].prevVal);
+            size += getVarintSize((unsigned long)changes[i].newVal);
+        } else {
+            size += encodeVarint(out + size, cellDifference);
+            size += encodeVarint(out + size, (unsigned long)changes[i].prevVal);
+            size += encodeVarint(out + size, (unsigned long)changes[i].newVal);
+        }
+        prevCell = cell;
+    }
+
+    return size;
+}
+
+/**
+ * Get the offset in the list's bytes at which a move's span starts.
+ *
+ * @param moveList      [in] The move list to be examined
+ * @param moveIndex     [in] The index of the move, the oldest move being 0
+ * @return size_t       The offset of the first byte of the move
+ */
+size_t getMoveStartInList(const UndoRedoList* moveList, int moveIndex) {
+    return moveIndex > 0 ? moveList->movesEnds[moveIndex - 1] : 0;
+}
+
+/**
+ * Decode a move in the list into the list's decoded Move struct. The struct is kept large
+ * enough for every move in the list, so this does not allocate memory.
+ *
+ * @param moveList      [in, out] The move list whose move is decoded
+ * @param moveIndex     [in] The index of the move, the oldest move being 0
+ * @return const Move*  A read-only pointer to the decoded move
+ */
+const Move* decodeMoveInList(UndoRedoList* moveList, int moveIndex) {
+    const unsigned char* in = moveList->bytes + getMoveStartInList(moveList, moveIndex);
+    const unsigned char* end = moveList->bytes + moveList->movesEnds[moveIndex];
+    Move* move = &(moveList->decodedMove);
+    long cell = 0;
+
+    move->numCellChanges = 0;
+    while (in < end) {
+        CellChange* change = &(move->cellChanges[move->numCellChanges]);
+        unsigned long number = 0;
+
+        in += decodeVarint(in, &number);
+        cell += zigzagDecode(number);
+        change->row = (int)(cell / moveList->numColumns);
+        change->col = (int)(cell % moveList->numColumns);
+        in += decodeVarint(in, &number);
+        change->prevVal = (int)number;
+        in += decodeVarint(in, &number);
+        change->newVal = (int)number;
+        move->numCellChanges++;
+    }
+
+    return move;
+}
+
+/**
+ * Make sure the list has room for another move, growing its arrays geometrically if
+ * needed.
+ *
+ * @param moveList          [in, out] The move list whose arrays are grown
+ * @param numBytes          [in] The number of bytes the compressed move takes
+ * @param numCellChanges    [in] The number of CellChanges in the move
+ * @return true             iff the procedure was successful
+ * @return false            iff a memory error has occurred
+ */
+bool reserveRoomForMoveInList(UndoRedoList* moveList, size_t numBytes, int numCellChanges) {
+    if (moveList->numBytes + numBytes > moveList->bytesCapacity) {
+        size_t newCapacity = moveList->bytesCapacity > 0 ? moveList->bytesCapacity : UNDO_REDO_LIST_INITIAL_NUM_BYTES;
+        unsigned char* newBytes = NULL;
+        while (moveList->numBytes + numBytes > newCapacity) {
+            newCapacity *= 2;
+        }
+        newBytes = (unsigned char*) realloc(moveList->bytes, newCapacity);
+        if (newBytes == NULL) { return false; }
+        moveList->bytes = newBytes;
+        moveList->bytesCapacity = newCapacity;
+    }
+
+    if (moveList->numMoves == moveList->movesCapacity) {
+        int newCapacity = moveList->movesCapacity > 0 ? 2 * moveList->movesCapacity : UNDO_REDO_LIST_INITIAL_NUM_MOVES;
+        size_t* newMovesEnds = (size_t*) realloc(moveList->movesEnds, newCapacity * sizeof(size_t));
+        if (newMovesEnds == NULL) { return false; }
+        moveList->movesEnds = newMovesEnds;
+        moveList->movesCapacity = newCapacity;
+    }
+
+    return reserveCellChangesInMove(&(moveList->decodedMove), numCellChanges);
+}
+
+/**
+ * Get the memory taken by the moves in the list, as measured against its budget.
+ *
+ * @param moveList      [in] The move list to be examined
+ * @return size_t       The number of bytes taken by the compressed moves and their offsets
+ */
+size_t getMemoryUsageOfList(const UndoRedoList* moveList) {
+    return moveList->numBytes + moveList->numMoves * sizeof(size_t);
+}
+
+/**
+ * Compact the oldest moves in the list, along with the checkpoint if there is one, into
+ * a new checkpoint. Enough moves are compacted to bring the list within half its budget,
+ * so that compacting is rare, but the newest move is always left alone.
+ * pre-condition: there are no moves to redo.
+ *
+ * @param moveList      [in, out] The move list to be compacted
+ * @return true         iff the procedure was successful
+ * @return false        iff a memory error has occurred
+ */
+bool compactOldestMovesInList(UndoRedoList* moveList) {
+    int numCells = moveList->numColumns * moveList->numColumns;
+    int numCompactedMoves = moveList->hasCheckpoint ? 1 : 0;
+    int moveIndex = 0, cell = 0, i = 0;
+    size_t compactedEnd = 0, checkpointSize = 0;
+    int* cellsPrevValues = NULL;
+    int* cellsNewValues = NULL;
+    Move* checkpoint = NULL;
+
+    if (moveList->numMoves < numCompactedMoves + 2) {
+        return true; /* only the newest move, and perhaps a checkpoint, are left */
+    }
+
+    /* pick the oldest moves whose removal brings the list within half its budget */
+    do {
+        numCompactedMoves++;
+        compactedEnd = moveList->movesEnds[numCompactedMoves - 1];
+    } while ((numCompactedMoves < moveList->numMoves - 1) &&
+             (getMemoryUsageOfList(moveList) - compactedEnd - numCompactedMoves * sizeof(size_t) > moveList->memoryBudget / 2));
+
+    cellsPrevValues = (int*) malloc(numCells * sizeof(int));
+    cellsNewValues = (int*) malloc(numCells * sizeof(int));
+    checkpoint = createMove();
+    if (cellsPrevValues == NULL || cellsNewValues == NULL || checkpoint == NULL) {
+        free(cellsPrevValues);
+        free(cellsNewValues);
+        destroyMove(checkpoint);
+        return false;
     }
-    if (!pushList(&(moveList->list), newMove)) { return false; }
-    moveList->current = getListHead(&(moveList->list));
+
+    /* replay the compacted moves, keeping the first previous value and the last new value of each cell */
+    for (cell = 0; cell < numCells; cell++) {
+        cellsPrevValues[cell] = -1;
+    }
+    for (moveIndex = 0; moveIndex < numCompactedMoves; moveIndex++) {
+        const Move* move = decodeMoveInList(moveList, moveIndex);
+        const CellChange* changes = getMoveCellChanges(move);
+        for (i = 0; i < getMoveSize(move); i++) {
+            cell = changes[i].row * moveList->numColumns + changes[i].col;
+            if (cellsPrevValues[cell] == -1) {
+                cellsPrevValues[cell] = changes[i].prevVal;
+            }
+            cellsNewValues[cell] = changes[i].newVal;
+        }
+    }
+
+    for (cell = 0; cell < numCells; cell++) {
+        if (cellsPrevValues[cell] != -1 && cellsPrevValues[cell] != cellsNewValues[cell]) {
+            if (!addCellChangeToMove(checkpoint, cellsPrevValues[cell], cellsNewValues[cell], cell / moveList->numColumns, cell % moveList->numColumns)) {
+                free(cellsPrevValues);
+                free(cellsNewValues);
+                destroyMove(checkpoint);
+                return false;
+            }
+        }
+    }
+    free(cellsPrevValues);
+    free(cellsNewValues);
+
+    checkpointSize = encodeCellChanges(moveList, getMoveCellChanges(checkpoint), getMoveSize(checkpoint), NULL);
+    if (checkpointSize > compactedEnd && !reserveRoomForMoveInList(moveList, checkpointSize - compactedEnd, getMoveSize(checkpoint))) {
+        destroyMove(checkpoint);
+        return false;
+    }
+    if (!reserveCellChangesInMove(&(moveList->decodedMove), getMoveSize(checkpoint))) {
+        destroyMove(checkpoint);
+        return false;
+    }
+
+    /* replace the compacted moves with the checkpoint, unless they cancel out entirely */
+    moveList->hasCheckpoint = getMoveSize(checkpoint) > 0;
+    if (!moveList->hasCheckpoint) {
+        checkpointSize = 0;
+    }
+    memmove(moveList->bytes + checkpointSize, moveList->bytes + compactedEnd, moveList->numBytes - compactedEnd);
+    encodeCellChanges(moveList, getMoveCellChanges(checkpoint), getMoveSize(checkpoint), moveList->bytes);
+    moveList->numBytes = moveList->numBytes - compactedEnd + checkpointSize;
+
+    moveIndex = moveList->hasCheckpoint ? 1 : 0;
+    for (i = numCompactedMoves; i < moveList->numMoves; i++) {
+        moveList->movesEnds[moveIndex++] = moveList->movesEnds[i] - compactedEnd + checkpointSize;
+    }
+    if (moveList->hasCheckpoint) {
+        moveList->movesEnds[0] = checkpointSize;
+    }
+    moveList->numMoves = moveIndex;
+
+    destroyMove(checkpoint);
+    return true;
+}
+
+/* returns false upon memory allocation error while growing the list, which is then left unchanged */
+bool addNewMoveToList(UndoRedoList* moveList, Move* newMove) {
+    int numCellChanges = getMoveSize(newMove);
+    size_t numBytes = encodeCellChanges(moveList, getMoveCellChanges(newMove), numCellChanges, NULL);
+
+    /* room is reserved before the moves to redo are discarded, so that a failure discards nothing */
+    if (!reserveRoomForMoveInList(moveList, numBytes, numCellChanges)) { return false; }
+
+    /* discard the moves to redo all at once */
+    moveList->numMoves -= moveList->numUndos;
+    moveList->numBytes = getMoveStartInList(moveList, moveList->numMoves);
     moveList->numUndos = 0;
+    if (moveList->numMoves == 0) {
+        moveList->hasCheckpoint = false;
+    }
+
+    encodeCellChanges(moveList, getMoveCellChanges(newMove), numCellChanges, moveList->bytes + moveList->numBytes);
+    moveList->numBytes += numBytes;
+    moveList->movesEnds[moveList->numMoves] = moveList->numBytes;
+    moveList->numMoves++;
+
+    destroyMove(newMove);
+
+    /* compacting only saves memory: should it fail, the list merely stays over its budget until the next move */
+    if (getMemoryUsageOfList(moveList) > moveList->memoryBudget) {
+        compactOldestMovesInList(moveList);
+    }
     return true;
 }
 
 bool canUndo(const UndoRedoList* moveList) {
-    return moveList->numUndos < getListSize(&(moveList->list));
+    return moveList->numUndos < moveList->numMoves;
 }
 
 bool canRedo(const UndoRedoList* moveList) {
@@ -33,15 +366,10 @@ bool canRedo(const UndoRedoList* moveList) {
 
 const Move* undoInList(UndoRedoList* moveList) {
     const Move* moveToUndo;
-    const Node* next;
     if (!canUndo(moveList)) {
         return NULL; /* no more moves to undo */
     }
-    moveToUndo = getCurrentMove(moveList);
-    next = getNodeNext(moveList->current);
-    if (next != NULL) {
-        moveList->current = next;
-    }
+    moveToUndo = decodeMoveInList(moveList, moveList->numMoves - moveList->numUndos - 1);
     moveList->numUndos++;
     return moveToUndo;
 }
@@ -51,23 +379,41 @@ const Move* redoInList(UndoRedoList* moveList) {
     if (!canRedo(moveList)) {
         return NULL; /* cannot advance current further */
     }
-    if (moveList->numUndos == getListSize(&(moveList->list))) {
-        moveToRedo = getCurrentMove(moveList);
-    } else {
-        moveList->current = getNodePrev(moveList->current);
-        moveToRedo = getCurrentMove(moveList);
-    }
+    moveToRedo = decodeMoveInList(moveList, moveList->numMoves - moveList->numUndos);
     moveList->numUndos--;
     return moveToRedo;
 }
 
+bool undoAllInList(UndoRedoList* moveList) {
+    if (!canUndo(moveList)) {
+        return false; /* no more moves to undo */
+    }
+    moveList->numUndos = moveList->numMoves;
+    return true;
+}
+
 const Move* getCurrentMove(UndoRedoList* moveList) {
-    return (Move*) getNodeData(moveList->current);
+    if (!canUndo(moveList)) {
+        return NULL; /* every move has been undone */
+    }
+    return decodeMoveInList(moveList, moveList->numMoves - moveList->numUndos - 1);
+}
+
+int getNumMovesInList(const UndoRedoList* moveList) {
+    return moveList->numMoves;
+}
+
+int getNumUndosInList(const UndoRedoList* moveList) {
+    return moveList->numUndos;
+}
+
+const Move* getMoveInList(UndoRedoList* moveList, int moveIndex) {
+    return decodeMoveInList(moveList, moveIndex);
 }
 
 void cleanupUndoRedoList(UndoRedoList* moveList) {
-	while (!isListEmpty(&(moveList->list))) {
-        Move* move = (Move*)popList(&(moveList->list));
-        destroyMove(move);
-	}
+    free(moveList->bytes);
+    free(moveList->movesEnds);
+    free(moveList->decodedMove.cellChanges);
+    initUndoRedo(moveList, moveList->numColumns);
 }
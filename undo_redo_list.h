@@ -3,13 +3,16 @@
  * in a suduko game session. It can be traveresed using the Undo and Redo commands.
  * 
  * initUndoRedo - Initializes an UndoRedoList struct.
- * addNewMoveToList -  Adds a new Move struct to the list right after the Node pointed to by the current
- * pointer.
+ * addNewMoveToList -  Adds a new Move struct to the list right after the last move not undone.
  * canUndo - Checks whether exists any move to undo in the list.
  * canRedo - Checks whether exists any move to redo in the list.
  * undoInList - Reflects the consequences of a Undo command on the UndoRedoList struct. 
  * redoInList - Reflects the consequences of a Redo command on the UndoRedoList struct. 
- * getCurrentMove - Get the Move contained in the the current Node.
+ * undoAllInList - Reflects the consequences of undoing every move on the UndoRedoList struct at once.
+ * getCurrentMove - Get the last move not undone in the list.
+ * getNumMovesInList - Get the number of moves in the list.
+ * getNumUndosInList - Get the number of moves in the list that have been undone.
+ * getMoveInList - Get a move in the list by its index.
  * cleanupUndoRedoList - Destroys a UndoRedoList struct by freeing all the memory allocated to it and its sub-structs.
  */
 
@@ -17,37 +20,71 @@
 #define UNDO_REDO_LIST_H
 
 #include <stdbool.h>
+#include <stddef.h>
 
-#include "linked_list.h"
 #include "move.h"
 
 /**
- * The UndoRedoList consists of a doubly linked list whose nodes contain Move structs,
- * a pointer to the current Node, represented the current latest move made during the game,
- * and a counter for the number of consecutive Undo commands the user made.
+ * The memory budget, in bytes, of the moves kept in an UndoRedoList. It may be set at
+ * build time by defining it.
+ */
+#ifndef UNDO_REDO_LIST_MEMORY_BUDGET
+#define UNDO_REDO_LIST_MEMORY_BUDGET (1 << 20)
+#endif
+
+/**
+ * The UndoRedoList is a log of moves kept in two growable arrays: the CellChanges of all
+ * moves one after the other, oldest move first, and the offset in it right past the
+ * CellChanges of each move. So a move is a span of the first array, and discarding the
+ * moves to redo only takes truncating both arrays.
+ * The CellChanges are compressed: each is stored as three varints, the difference between
+ * its cell's index and that of the previous CellChange in the move, its previous value and
+ * its new value. Moves spread over many cells, in row-major order, thus take about three
+ * bytes per cell.
+ * To keep the log within its memory budget, once it grows past it, its oldest moves are
+ * compacted into a checkpoint: a single move taking the board from its state before them
+ * straight to its state after them, changing each cell at most once. Then the states
+ * in between can no longer be visited, but undoing the checkpoint restores the exact state
+ * before it, and the checkpoint is never larger than the board.
+ * The list also holds a counter for the number of consecutive Undo commands the user made,
+ * and a Move struct into which the last move returned to the user is decoded.
+ * Note: a returned move stays valid until the list is changed again.
  * 
  */
 typedef struct {
-    List list; 
-    const Node* current;
+    unsigned char* bytes;
+    size_t numBytes;
+    size_t bytesCapacity;
+    size_t* movesEnds;
+    int numMoves;
+    int movesCapacity;
     int numUndos;
+    bool hasCheckpoint;
+    int numColumns;
+    size_t memoryBudget;
+    Move decodedMove;
 } UndoRedoList;
 
 /**
  * Initializes an UndoRedoList struct.
  * 
  * @param move_list     [in, out] Pointer to the UndoRedoList to be initialized.
+ * @param numColumns    [in] The number of columns in the board the moves are made on
  */
-void initUndoRedo(UndoRedoList* move_list);
+void initUndoRedo(UndoRedoList* move_list, int numColumns);
 /**
- * Adds a new Move struct to the list right after the Node pointed to by the current
- * pointer. That is, if exist any Moves to redo after the current Node, they are discraded
- * and repaced with the new node added to the list.
+ * Adds a new Move struct to the list right after the last move not undone. That is, if
+ * exist any Moves to redo, they are discraded and repaced with the new move. The move's
+ * CellChanges are compressed into the list, and on success the Move struct is destroyed.
+ * If the list then exceeds its memory budget, its oldest moves are compacted into a
+ * checkpoint. The new move itself is never compacted. Compacting is best-effort: should
+ * it run out of memory, the list is left over its budget and the move still counts as added.
  * 
  * @param move_list     [in, out] A pointer to the list to be added 
- * @param new_move      [in] The move to add at the head of the list
+ * @param new_move      [in] The move to add at the end of the list
  * @return true         iff the procedure was susccessful
- * @return false        iff a memory error has occurred
+ * @return false        iff a memory error has occurred, in which case neither the list
+ *                      nor the move are changed, and the move still belongs to the caller
  */
 bool addNewMoveToList(UndoRedoList* move_list, Move* new_move);
 
@@ -70,7 +107,7 @@ bool canUndo(const UndoRedoList* moveList);
 bool canRedo(const UndoRedoList* moveList);
 /**
  * Reflects the consequences of a Undo command on the UndoRedoList struct by 
- * moving the current pointer to the next node and incrementing numUndos. 
+ * incrementing numUndos. 
  * 
  * @param moveList          [in, out] Move list to be updated
  * @return const Move*       A read-only const pointer to a Move struct corresponding with
@@ -80,7 +117,7 @@ const Move* undoInList(UndoRedoList* moveList);
 
 /**
  * Reflects the consequences of a Redo command on the UndoRedoList struct by 
- * moving the current pointer to the previous node and decrementing numUndos. 
+ * decrementing numUndos. 
  * 
  * @param moveList          [in, out] Move list to be updated
  * @return const Move*      A read-only const pointer to a Move struct corresponding with
@@ -89,14 +126,52 @@ const Move* undoInList(UndoRedoList* moveList);
 const Move* redoInList(UndoRedoList* moveList);
 
 /**
- * Get the Move contained in the the current Node.
+ * Reflects the consequences of undoing every move that can be undone on the UndoRedoList
+ * struct at once, by setting numUndos to the number of moves in the list. The moves
+ * remain in the list to be redone.
+ * 
+ * @param moveList          [in, out] Move list to be updated
+ * @return true             iff there was any move to undo
+ * @return false            otherwise
+ */
+bool undoAllInList(UndoRedoList* moveList);
+
+/**
+ * Get the last move not undone in the list, that is, the move that would be undone next.
  * 
  * @param moveList          [in] Move list to be examined
  * @return const Move*      A read-only const pointer to a Move struct corresponding with
- *                          the current move
+ *                          the current move, or NULL if there is none
  */
 const Move* getCurrentMove(UndoRedoList* moveList);
 
+/**
+ * Get the number of moves in the list, those that may be redone included.
+ * 
+ * @param moveList          [in] Move list to be examined
+ * @return int              The number of moves in the list
+ */
+int getNumMovesInList(const UndoRedoList* moveList);
+
+/**
+ * Get the number of moves in the list that have been undone and may be redone.
+ * 
+ * @param moveList          [in] Move list to be examined
+ * @return int              The number of moves undone
+ */
+int getNumUndosInList(const UndoRedoList* moveList);
+
+/**
+ * Get a move in the list by its index, the oldest move being 0. If the oldest moves were
+ * compacted, the first move is their checkpoint.
+ * 
+ * @param moveList          [in] Move list to be examined
+ * @param moveIndex         [in] The index of the move, less than the number of moves
+ * @return const Move*      A read-only const pointer to a Move struct corresponding with
+ *                          the move
+ */
+const Move* getMoveInList(UndoRedoList* moveList, int moveIndex);
+
 /**
  * Destroys a UndoRedoList struct by freeing all the memory allocated to it and its sub-structs.
  * 